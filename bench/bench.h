@@ -0,0 +1,84 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_BENCH_H
+#define UPNP_DISPLAY_BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/utsname.h>
+#include <time.h>
+
+// Minimal microbenchmark harness. Each benchmark is a callable that does one
+// unit of work; it is run in growing batches until a batch takes long enough
+// to be measured reliably on a Raspberry Pi clock.
+//
+// If the environment variable BENCH_JSON names a file, every result is also
+// appended to it as a line of JSON, with the machine and compiler it ran
+// with, so runs on different machines and over time can be compared.
+
+static inline int64_t bench_now_nanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Keep the compiler from optimizing away a value computed in a benchmark.
+template <typename T> inline void bench_keep(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Appends one result to the BENCH_JSON file, if there is one.
+static inline void BenchRecord(const char *name, double value,
+                               const char *unit, int64_t iterations = 0) {
+  const char *file = getenv("BENCH_JSON");
+  if (file == NULL || *file == '\0') return;
+  FILE *out = fopen(file, "a");
+  if (out == NULL) {
+    perror(file);
+    return;
+  }
+  struct utsname host;
+  uname(&host);
+  fprintf(out, "{\"benchmark\": \"%s\", \"value\": %.3f, \"unit\": \"%s\", "
+          "\"iterations\": %lld, \"time\": %lld, \"host\": \"%s\", "
+          "\"machine\": \"%s\", \"compiler\": \"%s\"}\n",
+          name, value, unit, (long long) iterations, (long long) time(NULL),
+          host.nodename, host.machine, __VERSION__);
+  fclose(out);
+}
+
+// Runs "fn" and prints the time per call. Returns nanoseconds per call.
+template <typename Fn>
+double RunBenchmark(const char *name, Fn fn) {
+  static const int64_t kMinBatchNanos = 200 * 1000000LL;
+  for (int64_t iterations = 1; ; iterations *= 4) {
+    const int64_t start = bench_now_nanos();
+    for (int64_t i = 0; i < iterations; ++i) {
+      fn();
+    }
+    const int64_t duration = bench_now_nanos() - start;
+    if (duration >= kMinBatchNanos) {
+      const double per_call = (double) duration / iterations;
+      printf("%-40s %12.1f ns/op %12lld iterations\n", name, per_call,
+             (long long) iterations);
+      BenchRecord(name, per_call, "ns/op", iterations);
+      return per_call;
+    }
+  }
+}
+
+#endif  // UPNP_DISPLAY_BENCH_H
@@ -0,0 +1,490 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// A MediaRenderer that plays nothing, to test upnp-display end to end
+// without real renderers: it announces AVTransport and RenderingControl,
+// answers GetPositionInfo, Play, Pause and Stop, and sends LastChange events
+// at a given rate, walking through a list of tracks as if it played them.
+//
+// Each renderer is a process of its own with its own libupnp, as the
+// library handles one root device at a time well; with -n, that many are
+// forked, with friendly names "<name> 2", "<name> 3", ... after the first.
+//
+// Usage: bench/fake-renderer [options]; see -h.
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <upnp.h>
+#include <upnptools.h>
+
+static const char kAVTransportType[] =
+  "urn:schemas-upnp-org:service:AVTransport:1";
+static const char kAVTransportId[] = "urn:upnp-org:serviceId:AVTransport";
+static const char kRenderingControlType[] =
+  "urn:schemas-upnp-org:service:RenderingControl:1";
+static const char kRenderingControlId[] =
+  "urn:upnp-org:serviceId:RenderingControl";
+
+// AVTransport first: upnp-display sends all actions to the first controlURL.
+static const char kDescription[] =
+  "<?xml version=\"1.0\"?>\n"
+  "<root xmlns=\"urn:schemas-upnp-org:device-1-0\">"
+  "<specVersion><major>1</major><minor>0</minor></specVersion>"
+  "<device>"
+  "<deviceType>urn:schemas-upnp-org:device:MediaRenderer:1</deviceType>"
+  "<friendlyName>%s</friendlyName>"
+  "<manufacturer>upnp-display</manufacturer>"
+  "<modelName>fake-renderer</modelName>"
+  "<UDN>%s</UDN>"
+  "<serviceList>"
+  "<service><serviceType>%s</serviceType><serviceId>%s</serviceId>"
+  "<SCPDURL>/AVTransport.xml</SCPDURL>"
+  "<controlURL>/AVTransport/control</controlURL>"
+  "<eventSubURL>/AVTransport/event</eventSubURL></service>"
+  "<service><serviceType>%s</serviceType><serviceId>%s</serviceId>"
+  "<SCPDURL>/RenderingControl.xml</SCPDURL>"
+  "<controlURL>/RenderingControl/control</controlURL>"
+  "<eventSubURL>/RenderingControl/event</eventSubURL></service>"
+  "</serviceList>"
+  "</device>"
+  "</root>\n";
+
+struct Track {
+  std::string title;
+  std::string artist;
+  std::string album;
+  int seconds;
+};
+
+static const Track kDefaultTracks[] = {
+  { "Shine On You Crazy Diamond (Parts I-V)", "Pink Floyd",
+    "Wish You Were Here", 812 },
+  { "Svefn-g-englar", "Sigur R\xc3\xb3s", "\xc3\x81g\xc3\xa6tis byrjun", 604 },
+  { "Goldberg-Variationen, BWV 988: Aria", "Glenn Gould",
+    "Bach: The Goldberg Variations (1981)", 186 },
+};
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void StopHandler(int) {
+  stop_requested = 1;
+}
+
+static int64_t MonotonicNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static std::string XmlEscape(const std::string &in) {
+  std::string result;
+  for (const char c : in) {
+    switch (c) {
+    case '&':  result.append("&amp;"); break;
+    case '<':  result.append("&lt;"); break;
+    case '>':  result.append("&gt;"); break;
+    case '"':  result.append("&quot;"); break;
+    case '\'': result.append("&apos;"); break;
+    default:   result.push_back(c);
+    }
+  }
+  return result;
+}
+
+static std::string FormatTime(int seconds) {
+  char buffer[16];
+  snprintf(buffer, sizeof(buffer), "%d:%02d:%02d",
+           seconds / 3600, seconds / 60 % 60, seconds % 60);
+  return buffer;
+}
+
+namespace {
+class FakeRenderer {
+public:
+  FakeRenderer(const std::string &name, const std::string &udn,
+               const std::vector<Track> &tracks, int response_delay_millis)
+    : name_(name), udn_(udn), tracks_(tracks),
+      response_delay_millis_(response_delay_millis), device_(-1),
+      track_(0), playing_(true), position_nanos_(0),
+      resumed_nanos_(MonotonicNanos()) {}
+
+  bool Start(const char *interface) {
+    int rc = UpnpInit2(interface, 0);
+    if (rc != UPNP_E_SUCCESS) {
+      fprintf(stderr, "UpnpInit2(): %s\n", UpnpGetErrorMessage(rc));
+      return false;
+    }
+    char description[4096];
+    snprintf(description, sizeof(description), kDescription,
+             XmlEscape(name_).c_str(), udn_.c_str(),
+             kAVTransportType, kAVTransportId,
+             kRenderingControlType, kRenderingControlId);
+    rc = UpnpRegisterRootDevice2(UPNPREG_BUF_DESC, description,
+                                 strlen(description), 1,
+                                 &FakeRenderer::Callback, this, &device_);
+    if (rc == UPNP_E_SUCCESS) {
+      rc = UpnpSendAdvertisement(device_, 1800);
+    }
+    if (rc != UPNP_E_SUCCESS) {
+      fprintf(stderr, "%s: %s\n", name_.c_str(), UpnpGetErrorMessage(rc));
+      return false;
+    }
+    fprintf(stderr, "%s (%s) at %s:%d\n", name_.c_str(), udn_.c_str(),
+            UpnpGetServerIpAddress(), UpnpGetServerPort());
+    return true;
+  }
+
+  void Finish() {
+    if (device_ >= 0) UpnpUnRegisterRootDevice(device_);   // Says byebye.
+    UpnpFinish();
+  }
+
+  // Sends the state of the transport every so often until told to stop.
+  void SendEvents(double events_per_second) {
+    const int64_t period = events_per_second > 0
+      ? (int64_t)(1e9 / events_per_second) : 1000000000LL;
+    int64_t next = MonotonicNanos() + period;
+    while (!stop_requested) {
+      struct timespec ts;
+      ts.tv_sec = next / 1000000000LL;
+      ts.tv_nsec = next % 1000000000LL;
+      if (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0)
+        continue;   // Signal; check whether to stop.
+      const bool track_changed = AdvanceTrack();
+      if (events_per_second > 0 || track_changed) Notify();
+      next += period;
+      // Too far behind to catch up, e.g. while the network was stuck: keep
+      // the rate from now on instead of sending a burst.
+      const int64_t now = MonotonicNanos();
+      if (next < now - 1000000000LL) next = now + period;
+    }
+  }
+
+private:
+  static int Callback(Upnp_EventType_e event, const void *event_data,
+                      void *cookie) {
+    FakeRenderer *renderer = static_cast<FakeRenderer*>(cookie);
+    switch (event) {
+    case UPNP_CONTROL_ACTION_REQUEST:
+      renderer->HandleAction(
+        const_cast<UpnpActionRequest*>(
+          static_cast<const UpnpActionRequest*>(event_data)));
+      break;
+
+    case UPNP_EVENT_SUBSCRIPTION_REQUEST:
+      renderer->HandleSubscription(
+        static_cast<const UpnpSubscriptionRequest*>(event_data));
+      break;
+
+    default:
+      // don't care.
+      ;
+    }
+    return UPNP_E_SUCCESS;
+  }
+
+  void HandleAction(UpnpActionRequest *request) {
+    if (response_delay_millis_ > 0) usleep(response_delay_millis_ * 1000);
+    const std::string action = UpnpActionRequest_get_ActionName_cstr(request);
+    if (strcmp(UpnpActionRequest_get_ServiceID_cstr(request),
+               kAVTransportId) != 0) {
+      UpnpActionRequest_set_ErrCode(request, 401);   // Invalid Action.
+      return;
+    }
+
+    IXML_Document *response = UpnpMakeActionResponse(
+      action.c_str(), kAVTransportType, 0, NULL);
+    bool state_changed = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const int64_t now = MonotonicNanos();
+      if (action == "GetPositionInfo") {
+        const Track &track = tracks_[track_];
+        const std::string position
+          = FormatTime(PositionNanos(now) / 1000000000LL);
+        const struct { const char *name; std::string value; } args[] = {
+          { "Track", std::to_string(track_ + 1) },
+          { "TrackDuration", FormatTime(track.seconds) },
+          { "TrackMetaData", Didl(track) },
+          { "TrackURI", TrackURI() },
+          { "RelTime", position },
+          { "AbsTime", position },
+          { "RelCount", "2147483647" },
+          { "AbsCount", "2147483647" },
+        };
+        for (const auto &arg : args) {
+          UpnpAddToActionResponse(&response, action.c_str(), kAVTransportType,
+                                  arg.name, arg.value.c_str());
+        }
+      } else if (action == "Play") {
+        state_changed = !playing_;
+        if (!playing_) resumed_nanos_ = now;
+        playing_ = true;
+      } else if (action == "Pause" || action == "Stop") {
+        state_changed = playing_;
+        if (playing_) position_nanos_ = PositionNanos(now);
+        if (action == "Stop") position_nanos_ = 0;
+        playing_ = false;
+      } else {
+        ixmlDocument_free(response);
+        UpnpActionRequest_set_ErrCode(request, 401);
+        return;
+      }
+    }
+    UpnpActionRequest_set_ErrCode(request, UPNP_E_SUCCESS);
+    UpnpActionRequest_set_ActionResult(request, response);
+    if (state_changed) Notify();
+  }
+
+  void HandleSubscription(const UpnpSubscriptionRequest *request) {
+    const char *service_id
+      = UpnpSubscriptionRequest_get_ServiceId_cstr(request);
+    const std::string last_change = strcmp(service_id, kAVTransportId) == 0
+      ? TransportLastChange()
+      : "<Event xmlns=\"urn:schemas-upnp-org:metadata-1-0/RCS/\">"
+        "<InstanceID val=\"0\"><Volume channel=\"Master\" val=\"42\"/>"
+        "<Mute channel=\"Master\" val=\"0\"/></InstanceID></Event>";
+    const std::string value = XmlEscape(last_change);
+    const char *names[] = { "LastChange" };
+    const char *values[] = { value.c_str() };
+    UpnpAcceptSubscription(device_,
+                           UpnpSubscriptionRequest_get_UDN_cstr(request),
+                           service_id, names, values, 1,
+                           UpnpSubscriptionRequest_get_SID_cstr(request));
+  }
+
+  void Notify() {
+    const std::string value = XmlEscape(TransportLastChange());
+    const char *names[] = { "LastChange" };
+    const char *values[] = { value.c_str() };
+    UpnpNotify(device_, udn_.c_str(), kAVTransportId, names, values, 1);
+  }
+
+  // Moves on to the next track when the current one is over. Returns
+  // 'true' if it did.
+  bool AdvanceTrack() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int64_t now = MonotonicNanos();
+    if (!playing_
+        || PositionNanos(now) < tracks_[track_].seconds * 1000000000LL) {
+      return false;
+    }
+    track_ = (track_ + 1) % tracks_.size();
+    position_nanos_ = 0;
+    resumed_nanos_ = now;
+    return true;
+  }
+
+  std::string TransportLastChange() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Track &track = tracks_[track_];
+    const std::string didl = XmlEscape(Didl(track));
+    const std::string state = playing_ ? "PLAYING" : "PAUSED_PLAYBACK";
+    return "<Event xmlns=\"urn:schemas-upnp-org:metadata-1-0/AVT/\">"
+      "<InstanceID val=\"0\">"
+      "<TransportState val=\"" + state + "\"/>"
+      "<CurrentTrackDuration val=\"" + FormatTime(track.seconds) + "\"/>"
+      "<CurrentTrackMetaData val=\"" + didl + "\"/>"
+      "<AVTransportURIMetaData val=\"" + didl + "\"/>"
+      "<CurrentTrackURI val=\"" + TrackURI() + "\"/>"
+      "<CurrentTransportActions val=\"Play,Pause,Stop\"/>"
+      "</InstanceID></Event>";
+  }
+
+  // Requires mutex_ to be locked.
+  int64_t PositionNanos(int64_t now) const {
+    return playing_ ? position_nanos_ + now - resumed_nanos_ : position_nanos_;
+  }
+
+  std::string TrackURI() const {
+    return "http://127.0.0.1/fake/" + std::to_string(track_ + 1) + ".flac";
+  }
+
+  std::string Didl(const Track &track) const {
+    return "<DIDL-Lite xmlns=\"urn:schemas-upnp-org:metadata-1-0/DIDL-Lite/\" "
+      "xmlns:dc=\"http://purl.org/dc/elements/1.1/\" "
+      "xmlns:upnp=\"urn:schemas-upnp-org:metadata-1-0/upnp/\">"
+      "<item id=\"" + std::to_string(track_ + 1) + "\" parentID=\"0\" "
+      "restricted=\"1\">"
+      "<dc:title>" + XmlEscape(track.title) + "</dc:title>"
+      "<upnp:artist>" + XmlEscape(track.artist) + "</upnp:artist>"
+      "<upnp:album>" + XmlEscape(track.album) + "</upnp:album>"
+      "<upnp:class>object.item.audioItem.musicTrack</upnp:class>"
+      "</item></DIDL-Lite>";
+  }
+
+  const std::string name_;
+  const std::string udn_;
+  const std::vector<Track> tracks_;
+  const int response_delay_millis_;
+  UpnpDevice_Handle device_;
+
+  std::mutex mutex_;   // Actions come in on threads of the library.
+  size_t track_;
+  bool playing_;
+  int64_t position_nanos_;   // Up to when it was last paused.
+  int64_t resumed_nanos_;
+};
+}  // namespace
+
+// One track per line: title, artist, album and length in seconds,
+// separated by tabs.
+static bool ReadTracks(const char *filename, std::vector<Track> *tracks) {
+  std::ifstream in(filename);
+  if (!in) {
+    fprintf(stderr, "%s: %s\n", filename, strerror(errno));
+    return false;
+  }
+  std::string line;
+  while (std::getline(in, line)) {
+    std::vector<std::string> columns;
+    std::string::size_type start = 0, tab;
+    while ((tab = line.find('\t', start)) != std::string::npos) {
+      columns.push_back(line.substr(start, tab - start));
+      start = tab + 1;
+    }
+    columns.push_back(line.substr(start));
+    if (columns.size() != 4 || atoi(columns[3].c_str()) <= 0) continue;
+    tracks->push_back({ columns[0], columns[1], columns[2],
+                        atoi(columns[3].c_str()) });
+  }
+  if (tracks->empty()) {
+    fprintf(stderr, "%s: no tracks.\n", filename);
+    return false;
+  }
+  return true;
+}
+
+static int RunRenderer(int index, const std::string &name,
+                       const char *interface, const std::vector<Track> &tracks,
+                       double events_per_second, int response_delay_millis) {
+  char udn[64];
+  snprintf(udn, sizeof(udn), "uuid:fa4e0000-0000-4000-8000-%012d", index);
+  const std::string friendly_name
+    = index == 0 ? name : name + " " + std::to_string(index + 1);
+  FakeRenderer renderer(friendly_name, udn, tracks, response_delay_millis);
+  if (!renderer.Start(interface)) {
+    renderer.Finish();
+    return 1;
+  }
+  renderer.SendEvents(events_per_second);
+  renderer.Finish();
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  int count = 1;
+  std::string name = "Fake Renderer";
+  const char *interface = NULL;
+  double events_per_second = 1;
+  int response_delay_millis = 0;
+  std::vector<Track> tracks;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "hn:N:i:r:m:d:")) != -1) {
+    switch (opt) {
+    case 'n':
+      count = atoi(optarg);
+      break;
+    case 'N':
+      name = optarg;
+      break;
+    case 'i':
+      interface = optarg;
+      break;
+    case 'r':
+      events_per_second = atof(optarg);
+      break;
+    case 'm':
+      if (!ReadTracks(optarg, &tracks)) return 1;
+      break;
+    case 'd':
+      response_delay_millis = atoi(optarg);
+      break;
+    case 'h':
+    default:
+      fprintf(stderr, "Usage: %s <options>\n", argv[0]);
+      fprintf(stderr,
+              "\t-n <count>           : Number of renderers (default: 1).\n"
+              "\t-N <name>            : Friendly name (default: Fake Renderer).\n"
+              "\t-i <interface>       : Network interface (default: first one up).\n"
+              "\t-r <per-second>      : LastChange events per second and renderer;\n"
+              "\t                       0: only on changes (default: 1).\n"
+              "\t-m <tracks-file>     : Tracks to play, one per line: title, artist,\n"
+              "\t                       album, seconds; separated by tabs.\n"
+              "\t-d <milliseconds>    : Delay before answering actions.\n");
+      return 1;
+    }
+  }
+  if (count < 1) {
+    fprintf(stderr, "-n: need at least one renderer.\n");
+    return 1;
+  }
+  if (tracks.empty()) {
+    tracks.assign(kDefaultTracks, kDefaultTracks
+                  + sizeof(kDefaultTracks) / sizeof(kDefaultTracks[0]));
+  }
+
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = StopHandler;   // No SA_RESTART: interrupt the sleep.
+  sigaction(SIGINT, &sa, NULL);
+  sigaction(SIGTERM, &sa, NULL);
+
+  if (count == 1) {
+    return RunRenderer(0, name, interface, tracks, events_per_second,
+                       response_delay_millis);
+  }
+
+  // Before any threads of the library exist, so forking is safe.
+  std::vector<pid_t> children;
+  for (int i = 0; i < count && !stop_requested; ++i) {
+    const pid_t pid = fork();
+    if (pid < 0) {
+      perror("fork()");
+      break;
+    }
+    if (pid == 0) {
+      return RunRenderer(i, name, interface, tracks, events_per_second,
+                         response_delay_millis);
+    }
+    children.push_back(pid);
+  }
+
+  size_t running = children.size();
+  bool forwarded = false;
+  while (running > 0) {
+    if (stop_requested && !forwarded) {
+      for (const pid_t pid : children) kill(pid, SIGTERM);
+      forwarded = true;
+    }
+    if (waitpid(-1, NULL, 0) > 0) --running;
+    else if (errno != EINTR) break;
+  }
+  return 0;
+}
@@ -0,0 +1,111 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Latency of a nibble-sized GPIO update with the different backends:
+//  - a mock backend, which is the cost of the backend dispatch itself,
+//  - the memory mapped Raspberry Pi registers, if accessible,
+//  - a GPIO character device given as argument, e.g. /dev/gpiochip0 or a
+//    chip created with the gpio-sim kernel module (needs 26 lines).
+// Only the LCD data lines of the default wiring are toggled; the enable line
+// stays low, so a connected display ignores it.
+//
+// Usage: bench/gpio-bench [/dev/gpiochipN]
+
+#include <stdio.h>
+
+#include "bench.h"
+#include "../gpio.h"
+#include "../gpio-chardev.h"
+
+static const uint32_t kDataBits = (1 << 23) | (1 << 24) | (1 << 25) | (1 << 8);
+
+// Remembers the output state; checks that updates arrive in one piece.
+class MockBackend : public GPIOBackend {
+public:
+  MockBackend() : state_(0), updates_(0) {}
+  uint32_t InitOutputs(uint32_t outputs) override { return outputs; }
+  uint32_t InitInputs(uint32_t inputs) override { return inputs; }
+  void SetAndClearBits(uint32_t set, uint32_t clear) override {
+    state_ = (state_ | set) & ~clear;
+    ++updates_;
+  }
+  uint32_t GetBits(uint32_t mask) override { return state_ & mask; }
+
+  uint32_t state() const { return state_; }
+  int64_t updates() const { return updates_; }
+
+private:
+  uint32_t state_;
+  int64_t updates_;
+};
+
+static void BenchmarkNibbles(const char *name, GPIO *gpio) {
+  // Same bit patterns as the LCD driver would produce for nibbles.
+  uint32_t set[16], clear[16];
+  for (int n = 0; n < 16; ++n) {
+    set[n] = (((n & 1) ? (1 << 23) : 0) | ((n & 2) ? (1 << 24) : 0)
+              | ((n & 4) ? (1 << 25) : 0) | ((n & 8) ? (1 << 8) : 0));
+    clear[n] = kDataBits & ~set[n];
+  }
+  int nibble = 0;
+  RunBenchmark(name, [&]() {
+      gpio->SetAndClearBits(set[nibble], clear[nibble]);
+      nibble = (nibble + 1) & 0xf;
+    });
+  gpio->ClearBits(kDataBits);
+}
+
+int main(int argc, char *argv[]) {
+  {
+    MockBackend mock;
+    GPIO gpio;
+    gpio.SetBackend(&mock);
+    gpio.Init();
+    gpio.InitOutputs(kDataBits);
+    BenchmarkNibbles("GPIO nibble, mock backend", &gpio);
+    if (mock.state() != 0) {
+      fprintf(stderr, "Mock backend: lines not cleared.\n");
+      return 1;
+    }
+  }
+
+  {
+    GPIO gpio;
+    if (gpio.Init() && gpio.InitOutputs(kDataBits) == kDataBits) {
+      BenchmarkNibbles("GPIO nibble, mmap registers", &gpio);
+    } else {
+      printf("gpio-bench: no access to GPIO registers, skipping mmap.\n");
+    }
+  }
+
+  if (argc > 1) {
+    GPIOCharDevBackend *chardev = GPIOCharDevBackend::Open(argv[1]);
+    if (chardev == NULL)
+      return 1;
+    GPIO gpio;
+    gpio.SetBackend(chardev);
+    gpio.Init();
+    if (gpio.InitOutputs(kDataBits) != kDataBits) {
+      fprintf(stderr, "%s: could not request lines.\n", argv[1]);
+      delete chardev;
+      return 1;
+    }
+    BenchmarkNibbles("GPIO nibble, character device", &gpio);
+    gpio.InitOutputs(0);
+    delete chardev;
+  }
+  return 0;
+}
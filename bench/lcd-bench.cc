@@ -0,0 +1,95 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Time to write a full frame (every cell of both lines changes) to the LCD.
+// Runs against the HD44780 emulator, which also counts bytes and commands
+// and checks the result and the timing. With argument "hardware", writes to
+// the display connected to the Raspberry Pi instead.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "../gpio.h"
+#include "../hd44780-emulator.h"
+#include "../lcd-display.h"
+
+// Defined in the VFD library (vfd_interface.cc)
+extern GPIO gpio;
+
+int main(int argc, char *argv[]) {
+  const bool on_hardware = (argc > 1 && strcmp(argv[1], "hardware") == 0);
+  HD44780Emulator emulator(16);
+  if (!on_hardware) {
+    gpio.SetBackend(&emulator);
+  }
+
+  LCDDisplay lcd("", 16);
+  if (!lcd.Init()) {
+    printf("lcd-bench: no GPIO access, skipping.\n");
+    return 0;
+  }
+
+  // Alternate between two screens that differ in every cell.
+  static const std::u32string kScreens[2][2] = {
+    { U"ABCDEFGHIJKLMNOP", U"abcdefghijklmnop" },
+    { U"0123456789012345", U"-=-=-=-=-=-=-=-=" },
+  };
+  int screen = 0;
+  int64_t write_nanos = 0;
+  int64_t frames = 0;
+  emulator.ResetCounters();
+  RunBenchmark("LCD full frame", [&]() {
+      lcd.BeginFrame();
+      lcd.Print(0, kScreens[screen][0]);
+      lcd.Print(1, kScreens[screen][1]);
+      lcd.EndFrame();
+      screen ^= 1;
+      write_nanos += lcd.last_frame_write_nanos();
+      ++frames;
+    });
+  printf("%-40s %12.1f ns/frame written\n", "LCD frame write time",
+         (double) write_nanos / frames);
+  BenchRecord(on_hardware ? "LCD frame write time (hardware)"
+              : "LCD frame write time", (double) write_nanos / frames,
+              "ns/frame", frames);
+  if (on_hardware) {
+    lcd.SaveScreen();
+    return 0;
+  }
+
+  printf("%-40s %12.1f data bytes/frame %.1f commands/frame\n",
+         "LCD emulator", (double) emulator.data_bytes() / frames,
+         (double) emulator.commands() / frames);
+  BenchRecord("LCD data bytes", (double) emulator.data_bytes() / frames,
+              "bytes/frame", frames);
+  BenchRecord("LCD commands", (double) emulator.commands() / frames,
+              "commands/frame", frames);
+  const std::string expected = (utf8_encode(kScreens[screen ^ 1][0]) + "\n"
+                                + utf8_encode(kScreens[screen ^ 1][1]) + "\n");
+  if (emulator.RenderText() != expected) {
+    fprintf(stderr, "LCD emulator shows\n%sexpected\n%s",
+            emulator.RenderText().c_str(), expected.c_str());
+    return 1;
+  }
+  if (emulator.timing_violations() || emulator.short_enable_pulses()) {
+    fprintf(stderr, "LCD emulator: %lld bytes too early, %lld short pulses\n",
+            (long long) emulator.timing_violations(),
+            (long long) emulator.short_enable_pulses());
+    return 1;
+  }
+  return 0;
+}
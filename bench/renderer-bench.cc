@@ -0,0 +1,140 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Decoding of renderer events and composing the screen from them, on a
+// corpus of LastChange payloads as renderers send them: state-*.xml only
+// change variables, track-*.xml come with DIDL metadata of a new track.
+//
+// Usage: bench/renderer-bench [corpus-directory]   (default: bench/corpus)
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "../metrics.h"
+#include "../printer.h"
+#include "../renderer-state.h"
+
+static const std::string kAnyRenderer;
+
+// Composes like a 16x2 display would, without output.
+class NullPrinter : public Printer {
+public:
+  NullPrinter() : Printer(kAnyRenderer), characters_(0) {}
+  using Printer::Print;
+  void Print(int, const std::string &text) override {
+    characters_ += text.size();
+  }
+  void Print(int, const std::u32string &text) override {
+    characters_ += text.size();
+  }
+  int64_t characters() const { return characters_; }
+
+private:
+  int64_t characters_;
+};
+
+static bool ReadCorpus(const std::string &dir, const char *prefix,
+                       std::vector<std::string> *payloads) {
+  DIR *d = opendir(dir.c_str());
+  if (d == NULL) {
+    perror(dir.c_str());
+    return false;
+  }
+  std::vector<std::string> names;
+  while (struct dirent *entry = readdir(d)) {
+    if (strncmp(entry->d_name, prefix, strlen(prefix)) == 0)
+      names.push_back(entry->d_name);
+  }
+  closedir(d);
+  std::sort(names.begin(), names.end());
+  for (const std::string &name : names) {
+    std::ifstream in(dir + "/" + name);
+    std::stringstream content;
+    content << in.rdbuf();
+    payloads->push_back(content.str());
+  }
+  return !payloads->empty();
+}
+
+int main(int argc, char *argv[]) {
+  const std::string corpus = argc > 1 ? argv[1] : "bench/corpus";
+  std::vector<std::string> state_events, track_events;
+  if (!ReadCorpus(corpus, "state-", &state_events)
+      || !ReadCorpus(corpus, "track-", &track_events)) {
+    fprintf(stderr, "renderer-bench: no payloads in %s\n", corpus.c_str());
+    return 1;
+  }
+  printf("renderer: %zu state and %zu track events\n",
+         state_events.size(), track_events.size());
+
+  RendererState state(-1, "uuid:renderer-bench");
+  RunBenchmark("LastChange parse", [&]() {
+      for (const std::string &xml : state_events)
+        state.ReceiveLastChange(xml.c_str(), bench_now_nanos());
+    });
+  RunBenchmark("LastChange parse with DIDL", [&]() {
+      for (const std::string &xml : track_events)
+        state.ReceiveLastChange(xml.c_str(), bench_now_nanos());
+    });
+
+  // A track with a title long enough to scroll; every call is a frame.
+  NullPrinter printer;
+  state.ReceiveLastChange(track_events[0].c_str(), bench_now_nanos());
+  RunBenchmark("Printer fillVars+rendererPrint", [&]() {
+      printer.fillVars(&state);
+      printer.rendererPrint(&state);
+      printer.ScrollTick();
+    });
+  // When the track changes, the text values are folded for the display.
+  size_t track = 0;
+  RunBenchmark("Printer new track", [&]() {
+      state.ReceiveLastChange(track_events[track].c_str(), bench_now_nanos());
+      track = (track + 1) % track_events.size();
+      printer.fillVars(&state);
+      printer.rendererPrint(&state);
+    });
+  bench_keep(printer.characters());
+
+  // More renderers than there is room for metrics: they must leave room
+  // for the others, also those registered later.
+  for (int i = 0; i < 2 * MetricCounter::kMaxMetrics; ++i) {
+    RendererState other(-1, ("uuid:renderer-" + std::to_string(i)).c_str());
+  }
+  const MetricCounter late("upnp_display_bench_late_total",
+                           "Registered after many renderers.");
+  late.Add();
+  const std::string exposition = MetricsExposition();
+  static const char *const kExpected[] = {
+    "upnp_display_soap_action_seconds_count{action=\"Play\"}",
+    "upnp_display_events_received_total{renderer=\"other\"}",
+    "upnp_display_bench_late_total 1",
+  };
+  for (const char *expected : kExpected) {
+    if (exposition.find(expected) == std::string::npos) {
+      fprintf(stderr, "renderer-bench: metric %s missing.\n", expected);
+      return 1;
+    }
+  }
+  return 0;
+}
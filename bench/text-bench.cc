@@ -0,0 +1,64 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// The per-tick text work of the displays: scrolling and looking up glyphs
+// of the compiled-in font.
+
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "../font-data.h"
+#include "../scroller.h"
+
+static const std::vector<std::u32string> kTitles = {
+  U"Shine On You Crazy Diamond (Parts I-V)",
+  U"Symphonie Nr. 9 d-Moll, op. 125 – IV. Presto – Allegro assai",
+  U"Hoppípolla",
+  U"Raško Jovanović – Život je pesma",
+  U"坂本龍一 - Merry Christmas Mr. Lawrence",
+};
+
+int main() {
+  Scroller scroller(U"  -  ");
+  size_t title = 0;
+  RunBenchmark("Scroller SetValue (new value)", [&]() {
+      scroller.SetValue(kTitles[title], 16);
+      title = (title + 1) % kTitles.size();
+    });
+  RunBenchmark("Scroller SetValue (same value)", [&]() {
+      scroller.SetValue(kTitles[0], 16);
+    });
+  scroller.SetValue(kTitles[1], 16);
+  RunBenchmark("Scroller NextTick", [&]() {
+      scroller.NextTick();
+    });
+  RunBenchmark("Scroller GetScrolledContent", [&]() {
+      bench_keep(scroller.GetScrolledContent().size());
+      scroller.NextTick();
+    });
+
+  // All characters of the titles, as a display looks them up per frame.
+  std::u32string characters;
+  for (const std::u32string &t : kTitles) characters += t;
+  RunBenchmark("findGlyph", [&]() {
+      int found = 0;
+      for (const char32_t cp : characters) found += (findGlyph(cp) != NULL);
+      bench_keep(found);
+    });
+  printf("%-40s %12zu codepoints/op\n", "findGlyph", characters.size());
+  return 0;
+}
@@ -0,0 +1,120 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Compares the validating UTF-8 functions in utf8.h with the unchecked
+// decoder they replaced, on metadata as it is sent by typical renderers.
+
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "../utf8.h"
+
+// The decoder as it was before validation was added; kept as baseline.
+template <typename byte_iterator>
+static uint32_t legacy_next_codepoint(byte_iterator &it) {
+  uint32_t cp = (uint8_t) *it++;
+  if (cp < 0x80) {
+    return cp;
+  }
+  else if ((cp & 0xE0) == 0xC0) {
+    cp = ((cp & 0x1F) << 6) + (*it & 0x3F);
+  }
+  else if ((cp & 0xF0) == 0xE0) {
+    cp = ((cp & 0x0F) << 12) + ((*it & 0x3F) << 6);
+    cp += (*++it & 0x3F);
+  }
+  else if ((cp & 0xF8) == 0xF0) {
+    cp = ((cp & 0x07) << 18) + ((*it & 0x3F) << 12);
+    cp += (*++it & 0x3F) << 6;
+    cp += (*++it & 0x3F);
+  }
+  ++it;
+  return cp;
+}
+
+static int legacy_len(const std::string &str) {
+  int result = 0;
+  for (std::string::const_iterator it = str.begin(); it != str.end();
+       legacy_next_codepoint(it)) {
+    ++result;
+  }
+  return result;
+}
+
+// Titles, artists and albums as they show up in LastChange events.
+static const std::vector<std::string> kMetadata = {
+  "Shine On You Crazy Diamond (Parts I-V)",
+  "Pink Floyd",
+  "Wish You Were Here (2011 Remastered Version)",
+  "Beethoven: Symphonie Nr. 9 d-Moll, op. 125 – IV. Presto – Allegro assai",
+  "Wiener Philharmoniker/Herbert von Karajan",
+  "Sigur Rós",
+  "Hoppípolla",
+  "Björk – Jóga",
+  "Raško Jovanović – Život je pesma",
+  "Рахманинов: "
+  "Концерт №2",
+  "坂本龍一 - Merry Christmas Mr. Lawrence",
+  "Café del Mar – Volumen Cuatro",
+};
+
+int main() {
+  size_t total_bytes = 0;
+  for (const std::string &s : kMetadata) total_bytes += s.size();
+  printf("utf8: %zu strings, %zu bytes per round\n",
+         kMetadata.size(), total_bytes);
+
+  RunBenchmark("utf8_len/legacy", [] {
+    int sum = 0;
+    for (const std::string &s : kMetadata) sum += legacy_len(s);
+    bench_keep(sum);
+  });
+  RunBenchmark("utf8_len", [] {
+    int sum = 0;
+    for (const std::string &s : kMetadata) sum += utf8_len(s);
+    bench_keep(sum);
+  });
+  RunBenchmark("utf8_character_count/iterator", [] {
+    int sum = 0;
+    for (const std::string &s : kMetadata)
+      sum += utf8_character_count(s.begin(), s.end());
+    bench_keep(sum);
+  });
+
+  RunBenchmark("utf8_next_codepoint/legacy", [] {
+    uint32_t sum = 0;
+    for (const std::string &s : kMetadata) {
+      for (std::string::const_iterator it = s.begin(); it != s.end(); )
+        sum += legacy_next_codepoint(it);
+    }
+    bench_keep(sum);
+  });
+  RunBenchmark("utf8_next_codepoint", [] {
+    uint32_t sum = 0;
+    for (const std::string &s : kMetadata) {
+      for (std::string::const_iterator it = s.begin(); it != s.end(); )
+        sum += utf8_next_codepoint(it, s.end());
+    }
+    bench_keep(sum);
+  });
+  RunBenchmark("utf8_decode", [] {
+    size_t sum = 0;
+    for (const std::string &s : kMetadata) sum += utf8_decode(s).size();
+    bench_keep(sum);
+  });
+  return 0;
+}
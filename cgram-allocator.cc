@@ -0,0 +1,70 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "cgram-allocator.h"
+
+CGRAMAllocator::CGRAMAllocator() : frame_(0), usable_slots_(kSlots) {
+  for (int i = 0; i < kSlots; ++i) {
+    slot_codepoint_[i] = 0;
+    slot_valid_[i] = false;
+    slot_last_used_[i] = 0;
+  }
+}
+
+int CGRAMAllocator::SlotFor(Codepoint cp) const {
+  // This is a really small list, so this is faster to iterate than having
+  // a bulky map.
+  for (int i = 0; i < usable_slots_; ++i) {
+    if (slot_valid_[i] && slot_codepoint_[i] == cp) return i;
+  }
+  return -1;
+}
+
+uint8_t CGRAMAllocator::PlanFrame(const std::vector<Codepoint> &needed) {
+  ++frame_;
+
+  // First pin everything that is already there, so that it won't be evicted
+  // by a codepoint later in the list.
+  for (Codepoint cp : needed) {
+    const int slot = SlotFor(cp);
+    if (slot >= 0) slot_last_used_[slot] = frame_;
+  }
+
+  uint8_t upload_mask = 0;
+  for (Codepoint cp : needed) {
+    if (SlotFor(cp) >= 0) continue;
+
+    // Least recently used slot that is not needed in this frame. Empty slots
+    // have never been used, so they are picked first.
+    int victim = -1;
+    for (int i = 0; i < usable_slots_; ++i) {
+      if (slot_last_used_[i] == frame_) continue;
+      if (victim < 0 || !slot_valid_[i]
+          || (slot_valid_[victim]
+              && slot_last_used_[i] < slot_last_used_[victim])) {
+        victim = i;
+      }
+    }
+    if (victim < 0)
+      break;  // Working set exceeds what the display can hold.
+
+    slot_codepoint_[victim] = cp;
+    slot_valid_[victim] = true;
+    slot_last_used_[victim] = frame_;
+    upload_mask |= (1 << victim);
+  }
+  return upload_mask;
+}
@@ -0,0 +1,59 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_CGRAM_ALLOCATOR_
+#define UPNP_DISPLAY_CGRAM_ALLOCATOR_
+
+#include <stdint.h>
+#include <vector>
+
+// Assigns codepoints to the 8 user-definable characters (CGRAM) of an
+// HD44780 display.
+// Allocation is planned per frame: all codepoints needed on screen are
+// passed at once, so glyphs that stay visible are never overwritten. Slots
+// not needed by the frame are reused least-recently-used first.
+class CGRAMAllocator {
+public:
+  typedef uint32_t Codepoint;
+  static const int kSlots = 8;
+
+  CGRAMAllocator();
+
+  // Only allocate the first "count" slots; the others are left to the
+  // caller.
+  void set_usable_slots(int count) { usable_slots_ = count; }
+  int usable_slots() const { return usable_slots_; }
+
+  // Plan the slots for a frame that shows the given distinct codepoints.
+  // Codepoints already in a slot keep it, wherever they are in the list; if
+  // the others don't all fit in the usable slots, earlier entries win.
+  // Returns a bitmask of the slots whose glyph has to be uploaded.
+  uint8_t PlanFrame(const std::vector<Codepoint> &needed);
+
+  // Slot assigned to the codepoint, or -1 if it did not fit.
+  int SlotFor(Codepoint cp) const;
+
+  // Codepoint currently in slot.
+  Codepoint CodepointAt(int slot) const { return slot_codepoint_[slot]; }
+
+private:
+  Codepoint slot_codepoint_[kSlots];
+  bool slot_valid_[kSlots];
+  uint32_t slot_last_used_[kSlots];   // frame number of last use.
+  uint32_t frame_;
+  int usable_slots_;
+};
+
+#endif  // UPNP_DISPLAY_CGRAM_ALLOCATOR_
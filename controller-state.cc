@@ -21,9 +21,13 @@
 #include <assert.h>
 #include <string.h>
 #include <stdio.h>
+#include <time.h>
 
+#include "logging.h"
+#include "metrics.h"
 #include "observer.h"
 #include "renderer-state.h"
+#include "trace-events.h"
 
 #include <upnptools.h>
 
@@ -31,14 +35,23 @@
 static const char kMediaRendererDevicePrefix[] =
   "urn:schemas-upnp-org:device:MediaRenderer:";
 
+static const MetricCounter renewals(
+  "upnp_display_subscription_renewals_total",
+  "Event subscriptions renewed.");
+static const MetricCounter renewal_failures(
+  "upnp_display_subscription_renewal_failures_total",
+  "Event subscriptions that could not be renewed.");
+
 ControllerState::ControllerState(ControllerObserver *observer,
-                                 Printer *printer)
-  : observer_(observer) {
+                                 Printer *printer, const char *interface,
+                                 UpnpBackend *backend)
+  : observer_(observer), backend_(backend), own_library_(true),
+    device_(-1) {
   assert(observer != NULL);  // without, it wouldn't make much sense.
   ithread_mutex_init(&mutex_, NULL);
   // If network is not up yet, UpnpInit2() fails. Retry.
   // This can happen if system just booted and DHCP is not settled yet.
-  int rc = UpnpInit2(NULL, 0);
+  int rc = UpnpInit2(interface, 0);
   int retries_left = 60;
   static const int kRetryTimeMs = 1000;
   while (rc != UPNP_E_SUCCESS && retries_left--) {
@@ -46,16 +59,42 @@ ControllerState::ControllerState(ControllerObserver *observer,
     char buffer[40];
     snprintf(buffer, sizeof(buffer), "Network...%d", retries_left);
     printer->Print(0, buffer);
-    fprintf(stderr, "UpnpInit2() Error: %s (%d). Retrying...(%ds)",
-            UpnpGetErrorMessage(rc), rc, retries_left);
-    rc = UpnpInit2(NULL, 0);
+    LOG(kLogWarning, "UpnpInit2() Error: %s (%d). Retrying...(%ds)",
+        UpnpGetErrorMessage(rc), rc, retries_left);
+    rc = UpnpInit2(interface, 0);
   }
   if (rc != UPNP_E_SUCCESS) {
-    fprintf(stderr, "UpnpInit2() Error: %s (%d).", UpnpGetErrorMessage(rc), rc);
+    LOG(kLogError, "UpnpInit2() Error: %s (%d).", UpnpGetErrorMessage(rc), rc);
   }
   UpnpRegisterClient(&UpnpEventHandler, this, &device_);
 }
 
+ControllerState::ControllerState(ControllerObserver *observer,
+                                 UpnpBackend *backend)
+  : observer_(observer), backend_(backend), own_library_(false),
+    device_(-1) {
+  assert(observer != NULL);
+  ithread_mutex_init(&mutex_, NULL);
+}
+
+ControllerState::~ControllerState() {
+  // The library calls back with a pointer to us; UpnpFinish() only returns
+  // once its threads are done.
+  if (device_ >= 0) UpnpUnRegisterClient(device_);
+  if (own_library_) UpnpFinish();
+
+  ithread_mutex_lock(&mutex_);
+  for (RenderMap::iterator it = uuid2render_.begin();
+       it != uuid2render_.end(); ++it) {
+    observer_->RemoveRenderer(it->first);
+    delete it->second;
+  }
+  uuid2render_.clear();
+  subscription2render_.clear();
+  ithread_mutex_unlock(&mutex_);
+  ithread_mutex_destroy(&mutex_);
+}
+
 static bool prefixMatch(const char *str, const char *prefix) {
   return strncmp(str, prefix, strlen(prefix)) == 0;
 }
@@ -71,7 +110,7 @@ void ControllerState::Register(const UpnpDiscovery *discovery) {
   ithread_mutex_lock(&mutex_);
   renderer = uuid2render_[uuid];
   if (renderer == NULL) {
-    renderer = new RendererState(device_, UpnpDiscovery_get_Location_cstr(discovery));
+    renderer = new RendererState(device_, uuid.c_str(), backend_);
     uuid2render_[uuid] = renderer;
     if (renderer->InitDescription(UpnpDiscovery_get_Location_cstr(discovery))) {
       renderer->SubscribeTo(&subscription2render_);
@@ -87,19 +126,51 @@ void ControllerState::Unregister(const UpnpDiscovery *discovery) {
   ithread_mutex_lock(&mutex_);
   RenderMap::iterator found = uuid2render_.find(uuid);
   if (found != uuid2render_.end()) {
-    observer_->RemoveRenderer(uuid);
-    delete found->second;
-    uuid2render_.erase(uuid);
+    RemoveLocked(found);
   }
   ithread_mutex_unlock(&mutex_);
 }
 
-void ControllerState::ReceiveEvent(const UpnpEvent *data) {
+void ControllerState::RenewalFailed(const UpnpEventSubscribe *data) {
+  const std::string sid = UpnpEventSubscribe_get_SID_cstr(data);
+
+  // Forget the renderer; with its next announcement, it is subscribed anew.
+  ithread_mutex_lock(&mutex_);
+  RenderMap::iterator subscription = subscription2render_.find(sid);
+  if (subscription != subscription2render_.end()) {
+    for (RenderMap::iterator it = uuid2render_.begin();
+         it != uuid2render_.end(); ++it) {
+      if (it->second == subscription->second) {
+        RemoveLocked(it);
+        break;
+      }
+    }
+  }
+  ithread_mutex_unlock(&mutex_);
+}
+
+void ControllerState::RemoveLocked(RenderMap::iterator found) {
+  RendererState *const renderer = found->second;
+  for (RenderMap::iterator it = subscription2render_.begin();
+       it != subscription2render_.end(); /**/) {
+    if (it->second == renderer) {
+      subscription2render_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  observer_->RemoveRenderer(found->first);
+  delete renderer;
+  uuid2render_.erase(found);
+}
+
+void ControllerState::ReceiveEvent(const UpnpEvent *data,
+                                   int64_t received_nanos) {
   const std::string sid = UpnpEvent_get_SID_cstr(data);
   ithread_mutex_lock(&mutex_);
   RenderMap::iterator found = subscription2render_.find(sid);
   if (found != subscription2render_.end()) {
-    found->second->ReceiveEvent(data);
+    found->second->ReceiveEvent(data, received_nanos);
   }
   ithread_mutex_unlock(&mutex_);
 }
@@ -108,18 +179,32 @@ int ControllerState::UpnpEventHandler(Upnp_EventType_e event,
                                       const void *event_data,
                                       void *userdata) {
   ControllerState *state = static_cast<ControllerState*>(userdata);
+  state->backend_->Received(event, event_data);
   switch (event) {
   case UPNP_DISCOVERY_ADVERTISEMENT_ALIVE:
     state->Register(static_cast<const UpnpDiscovery*>(event_data));
     break;
 
-  case UPNP_DISCOVERY_ADVERTISEMENT_BYEBYE:
   case UPNP_EVENT_AUTORENEWAL_FAILED:
+    renewal_failures.Add();
+    state->RenewalFailed(static_cast<const UpnpEventSubscribe*>(event_data));
+    break;
+
+  case UPNP_DISCOVERY_ADVERTISEMENT_BYEBYE:
     state->Unregister(static_cast<const UpnpDiscovery*>(event_data));
     break;
 
-  case UPNP_EVENT_RECEIVED:
-    state->ReceiveEvent(static_cast<const UpnpEvent*>(event_data));
+  case UPNP_EVENT_RECEIVED: {
+    TraceSpan::SetThreadName("upnp");
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    state->ReceiveEvent(static_cast<const UpnpEvent*>(event_data),
+                        (int64_t)now.tv_sec * 1000000000LL + now.tv_nsec);
+    break;
+  }
+
+  case UPNP_EVENT_RENEWAL_COMPLETE:
+    renewals.Add();
     break;
 
   default:
@@ -18,6 +18,7 @@
 #ifndef UPNP_DISPLAY_CONTROLLER_STATE_
 #define UPNP_DISPLAY_CONTROLLER_STATE_
 
+#include <stdint.h>
 #include <upnp.h>
 #include <upnp/ithread.h>
 
@@ -25,30 +26,55 @@
 #include <map>
 
 #include "printer.h"
+#include "upnp-backend.h"
 
 class ControllerObserver;
 class RendererState;
 
 class ControllerState {
 public:
-  ControllerState(ControllerObserver *observer, Printer *printer);
+  // Discovers renderers on the network "interface" (NULL: the first one
+  // that is up); requests to them and the callbacks from the library go
+  // through "backend".
+  ControllerState(ControllerObserver *observer, Printer *printer,
+                  const char *interface = NULL,
+                  UpnpBackend *backend = LibUpnpBackend());
+
+  // Without network: nothing comes in except what is given to Deliver(),
+  // and requests are answered by "backend" alone.
+  ControllerState(ControllerObserver *observer, UpnpBackend *backend);
+
+  // Stops the callbacks of the library and waits for those that are
+  // running, then removes the renderers.
+  ~ControllerState();
+
+  // Handle "event" as if it came from the library.
+  void Deliver(Upnp_EventType_e event, const void *event_data) {
+    UpnpEventHandler(event, event_data, this);
+  }
 
 private:
   void Register(const UpnpDiscovery *discovery);
   void Unregister(const UpnpDiscovery *discovery);
-  void ReceiveEvent(const UpnpEvent *data);
+  void RenewalFailed(const UpnpEventSubscribe *data);
+  void ReceiveEvent(const UpnpEvent *data, int64_t received_nanos);
 
   // Callback from upnp library.
   static int UpnpEventHandler(Upnp_EventType_e event, const void *event_data,
                               void *userdata);
 
   ControllerObserver *const observer_;
+  UpnpBackend *const backend_;
 
+  const bool own_library_;   // UpnpInit2() was called by us.
   UpnpClient_Handle device_;
   ithread_mutex_t mutex_;
   typedef std::map<std::string, RendererState *> RenderMap;
   RenderMap uuid2render_;
   RenderMap subscription2render_;
+
+  // Removes the renderer and its subscriptions; with mutex_ held.
+  void RemoveLocked(RenderMap::iterator found);
 };
 
 #endif  // UPNP_DISPLAY_CONTROLLER_STATE_
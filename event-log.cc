@@ -0,0 +1,380 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "event-log.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <chrono>
+
+#include <ixml.h>
+
+#include "controller-state.h"
+#include "logging.h"
+
+static const char kMagic[] = "UPnPLOG1";
+
+// Record types and their fields.
+enum RecordType {
+  kAlive = 1,         // device id, device type, location
+  kByeBye,            // device id, device type, location
+  kEvent,             // subscription id, event key, changed variables XML
+  kDescription,       // url, description XML
+  kSubscription,      // url, subscription id, timeout
+  kAction,            // url, action name, response XML
+  kRecordTypes
+};
+static const size_t kFieldCount[kRecordTypes] = { 0, 3, 3, 3, 2, 3, 3 };
+
+static int64_t MonotonicNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void AppendVarint(uint64_t value, std::string *out) {
+  while (value >= 0x80) {
+    out->push_back((char)(value | 0x80));
+    value >>= 7;
+  }
+  out->push_back((char)value);
+}
+
+static bool ReadVarint(const std::string &in, size_t *pos, uint64_t *value) {
+  *value = 0;
+  for (int shift = 0; shift < 64 && *pos < in.size(); shift += 7) {
+    const uint8_t byte = in[(*pos)++];
+    *value |= (uint64_t)(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) return true;
+  }
+  return false;
+}
+
+static std::string ToString(IXML_Document *doc) {
+  if (doc == NULL) return "";
+  DOMString xml = ixmlDocumenttoString(doc);
+  if (xml == NULL) return "";
+  std::string result = xml;
+  ixmlFreeDOMString(xml);
+  return result;
+}
+
+// Name of the action element in a SOAP request, e.g. "u:Play".
+static std::string ActionName(IXML_Document *action) {
+  if (action == NULL) return "";
+  IXML_Node *element = ixmlNode_getFirstChild((IXML_Node*) action);
+  if (element == NULL) return "";
+  const char *name = ixmlNode_getNodeName(element);
+  return name ? name : "";
+}
+
+static std::string ActionKey(const char *action_url, IXML_Document *action) {
+  return std::string("A ") + action_url + " " + ActionName(action);
+}
+
+EventRecorder::EventRecorder(UpnpBackend *upstream)
+  : upstream_(upstream), out_(NULL), last_nanos_(0) {}
+
+EventRecorder::~EventRecorder() {
+  if (out_ != NULL) fclose(out_);
+}
+
+bool EventRecorder::Open(const char *filename) {
+  out_ = fopen(filename, "wb");
+  if (out_ == NULL) {
+    LOG(kLogError, "Event log: %s: %s", filename, strerror(errno));
+    return false;
+  }
+  fwrite(kMagic, 1, strlen(kMagic), out_);
+  fflush(out_);
+  last_nanos_ = MonotonicNanos();
+  return true;
+}
+
+void EventRecorder::Append(int type, int rc,
+                           const std::vector<std::string> &fields) {
+  std::string record;
+  record.push_back((char)type);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (out_ == NULL) return;
+  const int64_t now = MonotonicNanos();
+  AppendVarint(now - last_nanos_, &record);
+  last_nanos_ = now;
+  AppendVarint(((uint64_t)rc << 1) ^ (uint64_t)(rc >> 31), &record);
+  record.push_back((char)fields.size());
+  for (const std::string &field : fields) {
+    AppendVarint(field.size(), &record);
+    record.append(field);
+  }
+  // Flushed right away, so that all up to a crash is there to replay it.
+  if (fwrite(record.data(), 1, record.size(), out_) != record.size()
+      || fflush(out_) != 0) {
+    LOG(kLogError, "Event log: %s", strerror(errno));
+  }
+}
+
+int EventRecorder::DownloadXmlDoc(const char *url, IXML_Document **doc) {
+  const int rc = upstream_->DownloadXmlDoc(url, doc);
+  Append(kDescription, rc,
+         { url, rc == UPNP_E_SUCCESS ? ToString(*doc) : "" });
+  return rc;
+}
+
+int EventRecorder::Subscribe(UpnpClient_Handle client, const char *event_url,
+                             int *timeout, Upnp_SID sid) {
+  const int rc = upstream_->Subscribe(client, event_url, timeout, sid);
+  if (rc == UPNP_E_SUCCESS) {
+    Append(kSubscription, rc, { event_url, sid, std::to_string(*timeout) });
+  } else {
+    Append(kSubscription, rc, { event_url, "", "" });
+  }
+  return rc;
+}
+
+int EventRecorder::SendAction(UpnpClient_Handle client, const char *action_url,
+                              const char *service_type, IXML_Document *action,
+                              IXML_Document **response) {
+  const std::string name = ActionName(action);
+  const int rc = upstream_->SendAction(client, action_url, service_type,
+                                       action, response);
+  Append(kAction, rc, { action_url, name, ToString(*response) });
+  return rc;
+}
+
+void EventRecorder::Received(Upnp_EventType_e event, const void *event_data) {
+  switch (event) {
+  case UPNP_DISCOVERY_ADVERTISEMENT_ALIVE:
+  case UPNP_DISCOVERY_ADVERTISEMENT_BYEBYE: {
+    const UpnpDiscovery *discovery
+      = static_cast<const UpnpDiscovery*>(event_data);
+    Append(event == UPNP_DISCOVERY_ADVERTISEMENT_ALIVE ? kAlive : kByeBye,
+           UPNP_E_SUCCESS,
+           { UpnpDiscovery_get_DeviceID_cstr(discovery),
+             UpnpDiscovery_get_DeviceType_cstr(discovery),
+             UpnpDiscovery_get_Location_cstr(discovery) });
+    break;
+  }
+
+  case UPNP_EVENT_RECEIVED: {
+    const UpnpEvent *data = static_cast<const UpnpEvent*>(event_data);
+    Append(kEvent, UPNP_E_SUCCESS,
+           { UpnpEvent_get_SID_cstr(data),
+             std::to_string(UpnpEvent_get_EventKey(data)),
+             ToString(UpnpEvent_get_ChangedVariables(data)) });
+    break;
+  }
+
+  default:
+    // Nothing the display looks at.
+    ;
+  }
+}
+
+EventReplay::EventReplay() : stop_(false) {}
+
+EventReplay::~EventReplay() {
+  Stop();
+}
+
+void EventReplay::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wakeup_.notify_all();
+  if (thread_.joinable()) thread_.join();
+}
+
+bool EventReplay::Open(const char *filename) {
+  FILE *in = fopen(filename, "rb");
+  if (in == NULL) {
+    LOG(kLogError, "Event log: %s: %s", filename, strerror(errno));
+    return false;
+  }
+  std::string content;
+  char buffer[65536];
+  size_t r;
+  while ((r = fread(buffer, 1, sizeof(buffer), in)) > 0) {
+    content.append(buffer, r);
+  }
+  fclose(in);
+  if (content.compare(0, strlen(kMagic), kMagic) != 0) {
+    LOG(kLogError, "Event log: %s is not an event log.", filename);
+    return false;
+  }
+
+  size_t pos = strlen(kMagic);
+  int64_t offset = 0;
+  while (pos < content.size()) {
+    Record record;
+    record.type = (uint8_t)content[pos++];
+    uint64_t delta, rc, count = 0;
+    bool complete = ReadVarint(content, &pos, &delta)
+      && ReadVarint(content, &pos, &rc) && pos < content.size();
+    if (complete) count = (uint8_t)content[pos++];
+    for (uint64_t i = 0; complete && i < count; ++i) {
+      uint64_t length;
+      complete = ReadVarint(content, &pos, &length)
+        && length <= content.size() - pos;
+      if (complete) {
+        record.fields.push_back(content.substr(pos, length));
+        pos += length;
+      }
+    }
+    if (!complete) {
+      LOG(kLogWarning, "Event log: %s cut short; replaying what's there.",
+          filename);
+      break;
+    }
+    offset += delta;
+    record.offset_nanos = offset;
+    record.rc = (int)((rc >> 1) ^ -(rc & 1));
+    if (record.type <= 0 || record.type >= kRecordTypes
+        || record.fields.size() < kFieldCount[record.type]) {
+      continue;   // Unknown; maybe from a newer version.
+    }
+    records_.push_back(record);
+  }
+
+  // Answers, by what was asked, in order.
+  for (const Record &record : records_) {
+    switch (record.type) {
+    case kDescription:
+      answers_["D " + record.fields[0]].push_back(&record);
+      break;
+    case kSubscription:
+      answers_["S " + record.fields[0]].push_back(&record);
+      break;
+    case kAction:
+      answers_["A " + record.fields[0] + " " + record.fields[1]]
+        .push_back(&record);
+      break;
+    }
+  }
+  return true;
+}
+
+void EventReplay::Start(ControllerState *controller, bool as_fast_as_possible,
+                        const std::function<void()> &done) {
+  thread_ = std::thread(&EventReplay::Run, this, controller,
+                        as_fast_as_possible, done);
+}
+
+void EventReplay::Run(ControllerState *controller, bool as_fast_as_possible,
+                      std::function<void()> done) {
+  const std::chrono::steady_clock::time_point start
+    = std::chrono::steady_clock::now();
+  int delivered = 0;
+  for (const Record &record : records_) {
+    if (record.type != kAlive && record.type != kByeBye
+        && record.type != kEvent) {
+      continue;   // Answers; given out when asked for.
+    }
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (as_fast_as_possible) {
+        if (stop_) return;
+      } else if (wakeup_.wait_until(
+                   lock, start + std::chrono::nanoseconds(record.offset_nanos),
+                   [this]() { return stop_; })) {
+        return;
+      }
+    }
+    Deliver(controller, record);
+    ++delivered;
+  }
+  LOG(kLogInfo, "Replay: done after %d events.", delivered);
+  if (done) done();
+}
+
+void EventReplay::Deliver(ControllerState *controller, const Record &record) {
+  switch (record.type) {
+  case kAlive:
+  case kByeBye: {
+    UpnpDiscovery *discovery = UpnpDiscovery_new();
+    UpnpDiscovery_strcpy_DeviceID(discovery, record.fields[0].c_str());
+    UpnpDiscovery_strcpy_DeviceType(discovery, record.fields[1].c_str());
+    UpnpDiscovery_strcpy_Location(discovery, record.fields[2].c_str());
+    controller->Deliver(record.type == kAlive
+                        ? UPNP_DISCOVERY_ADVERTISEMENT_ALIVE
+                        : UPNP_DISCOVERY_ADVERTISEMENT_BYEBYE,
+                        discovery);
+    UpnpDiscovery_delete(discovery);
+    break;
+  }
+
+  case kEvent: {
+    UpnpEvent *event = UpnpEvent_new();
+    UpnpEvent_strcpy_SID(event, record.fields[0].c_str());
+    UpnpEvent_set_EventKey(event, atoi(record.fields[1].c_str()));
+    IXML_Document *changed = ixmlParseBuffer(record.fields[2].c_str());
+    UpnpEvent_set_ChangedVariables(event, changed);
+    controller->Deliver(UPNP_EVENT_RECEIVED, event);
+    // Not all versions of the library free it with the event.
+    UpnpEvent_set_ChangedVariables(event, NULL);
+    if (changed) ixmlDocument_free(changed);
+    UpnpEvent_delete(event);
+    break;
+  }
+  }
+}
+
+const EventReplay::Record *EventReplay::Answer(const std::string &key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::deque<const Record*> &queue = answers_[key];
+  if (queue.empty()) {
+    const std::map<std::string, const Record*>::const_iterator found
+      = last_answer_.find(key);
+    return found == last_answer_.end() ? NULL : found->second;
+  }
+  const Record *answer = queue.front();
+  queue.pop_front();
+  last_answer_[key] = answer;
+  return answer;
+}
+
+int EventReplay::DownloadXmlDoc(const char *url, IXML_Document **doc) {
+  const Record *answer = Answer(std::string("D ") + url);
+  if (answer == NULL) return UPNP_E_INTERNAL_ERROR;
+  if (answer->rc != UPNP_E_SUCCESS) return answer->rc;
+  *doc = ixmlParseBuffer(answer->fields[1].c_str());
+  return *doc != NULL ? UPNP_E_SUCCESS : UPNP_E_INTERNAL_ERROR;
+}
+
+int EventReplay::Subscribe(UpnpClient_Handle, const char *event_url,
+                           int *timeout, Upnp_SID sid) {
+  const Record *answer = Answer(std::string("S ") + event_url);
+  if (answer == NULL) return UPNP_E_INTERNAL_ERROR;
+  if (answer->rc != UPNP_E_SUCCESS) return answer->rc;
+  snprintf(sid, sizeof(Upnp_SID), "%s", answer->fields[1].c_str());
+  *timeout = atoi(answer->fields[2].c_str());
+  return UPNP_E_SUCCESS;
+}
+
+int EventReplay::SendAction(UpnpClient_Handle, const char *action_url,
+                            const char *, IXML_Document *action,
+                            IXML_Document **response) {
+  *response = NULL;
+  const Record *answer = Answer(ActionKey(action_url, action));
+  if (answer == NULL) return UPNP_E_INTERNAL_ERROR;
+  if (!answer->fields[2].empty()) {
+    *response = ixmlParseBuffer(answer->fields[2].c_str());
+  }
+  return answer->rc;
+}
@@ -0,0 +1,126 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_EVENT_LOG_H
+#define UPNP_DISPLAY_EVENT_LOG_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "upnp-backend.h"
+
+class ControllerState;
+
+// Log of everything that came in from the network: device announcements,
+// events, and the answers to our requests, so that a session can be played
+// back later without network and renderer.
+//
+// The file starts with "UPnPLOG1", followed by records of
+//   type       (one byte, see event-log.cc)
+//   time       (nanoseconds since the previous record, varint)
+//   result     (libupnp return code, zigzag varint)
+//   fields     (count as one byte, then each as varint length and bytes)
+// Varints are little endian base 128, as in protocol buffers. Records are
+// appended as they happen, so a log cut short by a crash is usable up to
+// the last complete record.
+
+// Passes everything on to "upstream", logging what comes back.
+class EventRecorder : public UpnpBackend {
+public:
+  explicit EventRecorder(UpnpBackend *upstream = LibUpnpBackend());
+  ~EventRecorder();
+
+  bool Open(const char *filename);
+
+  int DownloadXmlDoc(const char *url, IXML_Document **doc) override;
+  int Subscribe(UpnpClient_Handle client, const char *event_url,
+                int *timeout, Upnp_SID sid) override;
+  int SendAction(UpnpClient_Handle client, const char *action_url,
+                 const char *service_type, IXML_Document *action,
+                 IXML_Document **response) override;
+  void Received(Upnp_EventType_e event, const void *event_data) override;
+
+private:
+  void Append(int type, int rc, const std::vector<std::string> &fields);
+
+  UpnpBackend *const upstream_;
+  std::mutex mutex_;   // Requests and callbacks come from different threads.
+  FILE *out_;
+  int64_t last_nanos_;
+};
+
+// Plays back a log: hands announcements and events to a ControllerState
+// at the times they were recorded, and answers its requests with the
+// recorded answers, in the order they were given.
+class EventReplay : public UpnpBackend {
+public:
+  EventReplay();
+  ~EventReplay();
+
+  // Reads the whole log. Returns 'false' if it can't be read.
+  bool Open(const char *filename);
+
+  // Starts handing over to "controller" in a thread of its own, keeping the
+  // recorded pace unless "as_fast_as_possible". Calls "done" at the end.
+  void Start(ControllerState *controller, bool as_fast_as_possible,
+             const std::function<void()> &done);
+
+  // Stops handing over and waits for the thread to finish.
+  void Stop();
+
+  int DownloadXmlDoc(const char *url, IXML_Document **doc) override;
+  int Subscribe(UpnpClient_Handle client, const char *event_url,
+                int *timeout, Upnp_SID sid) override;
+  int SendAction(UpnpClient_Handle client, const char *action_url,
+                 const char *service_type, IXML_Document *action,
+                 IXML_Document **response) override;
+
+private:
+  struct Record {
+    int type;
+    int64_t offset_nanos;   // Since the start of the log.
+    int rc;
+    std::vector<std::string> fields;
+  };
+
+  void Run(ControllerState *controller, bool as_fast_as_possible,
+           std::function<void()> done);
+  void Deliver(ControllerState *controller, const Record &record);
+
+  // Next recorded answer to the request "key", or the last one again if the
+  // display asks more often than it did while recording. NULL if none.
+  const Record *Answer(const std::string &key);
+
+  std::vector<Record> records_;
+
+  std::mutex mutex_;
+  std::map<std::string, std::deque<const Record*> > answers_;
+  std::map<std::string, const Record*> last_answer_;
+
+  std::condition_variable wakeup_;
+  bool stop_;
+  std::thread thread_;
+};
+
+#endif  // UPNP_DISPLAY_EVENT_LOG_H
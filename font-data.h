@@ -23,12 +23,33 @@
 
 // Fixed font. Defined in font-data.c, that is generated from public domain
 // font 5x8.bdf
-struct Font5x8 {
-  uint32_t codepoint;
-  uint8_t bitmap[8];
+//
+// Glyphs are 8 rows, right aligned to the 5 pixel LCD character cell (bit 4
+// is the leftmost pixel). They are found with a two-level table: the upper
+// byte of the codepoint selects a page in kFontPageIndex, the page has a bit
+// for each codepoint in it that has a glyph. Counting the bits before the
+// one of the codepoint gives the index into the dense kFontGlyphs array.
+struct FontPage {
+  uint32_t present[8];  // Bit (cp & 0x1f) of word (cp & 0xff) >> 5.
+  uint16_t rank[8];     // Index in kFontGlyphs of first glyph in each word.
 };
 
-extern const struct Font5x8 kFontData[];
-extern const int kFontDataSize;
+extern const uint8_t kFontGlyphs[][8];
+extern const int kFontGlyphCount;
+extern const struct FontPage kFontPages[];
+extern const uint8_t kFontPageIndex[256];   // Page + 1; 0 if no glyphs.
+
+// Find glyph for codepoint. Returns NULL if there is none.
+static inline const uint8_t *findGlyph(uint32_t codepoint) {
+  if (codepoint > 0xFFFF) return 0;
+  const uint8_t page = kFontPageIndex[codepoint >> 8];
+  if (page == 0) return 0;
+  const struct FontPage *p = &kFontPages[page - 1];
+  const int word = (codepoint & 0xff) >> 5;
+  const uint32_t bit = 1U << (codepoint & 0x1f);
+  if ((p->present[word] & bit) == 0) return 0;
+  return kFontGlyphs[p->rank[word]
+                     + __builtin_popcount(p->present[word] & (bit - 1))];
+}
 
 #endif  // FONT_DATA_H
@@ -1,30 +1,122 @@
-# To be executed with awk.
+# To be executed with awk (in the C locale, so that strings are bytes).
 # Generates a data file out of a BDF font file.
+#
+# The glyphs are written to a dense array, with the bitmaps already shifted
+# to the 5 pixel wide LCD character cell. A two-level page table maps
+# codepoints to indexes into that array; see font-data.h for the layout.
+#
+# Optional: -v repertoire=<file> only keeps the characters that are listed
+# in the given UTF-8 text file (such as 5x8.repertoire-utf8). ASCII is
+# always kept.
+
+function hex_value(str,    i, result) {
+    result = 0;
+    str = toupper(str);
+    for (i = 1; i <= length(str); i++) {
+        result = result * 16 + index("0123456789ABCDEF", substr(str, i, 1)) - 1;
+    }
+    return result;
+}
+
+# Mark all codepoints of an UTF-8 encoded line as wanted.
+function add_repertoire_line(line,    i, b, cp, follow) {
+    follow = 0;
+    for (i = 1; i <= length(line); i++) {
+        b = byte_value[substr(line, i, 1)];
+        if (follow > 0) {
+            cp = cp * 64 + (b % 64);
+            if (--follow == 0) wanted[cp] = 1;
+        } else if (b < 128) {
+            wanted[b] = 1;
+        } else if (b >= 240) {
+            cp = b % 8; follow = 3;
+        } else if (b >= 224) {
+            cp = b % 16; follow = 2;
+        } else if (b >= 192) {
+            cp = b % 32; follow = 1;
+        }
+    }
+}
+
 BEGIN {
+    for (i = 1; i < 256; i++) byte_value[sprintf("%c", i)] = i;
+    subset = (repertoire != "");
+    if (subset) {
+        while ((getline line < repertoire) > 0) add_repertoire_line(line);
+        close(repertoire);
+    }
     count = 0;
-    print("// Generated code. Do not edit.");
-    print("#include \"font-data.h\"");
-    print;
-    print("const struct Font5x8 kFontData[] = {");
 }
 
-/^STARTCHAR/              { val=$2 }
-/^ENCODING/               { enc=$2; printf("  { %5d, {", enc); }
-/^BITMAP/                 { in_bitmap=1; byte_count=0; }
+/^STARTCHAR/              { name = $2 }
+/^ENCODING/               { enc = $2 + 0; }
+/^BITMAP/                 { in_bitmap = 1; row_count = 0; bitmap = ""; }
 
 /^[0-9a-fA-F][0-9a-fA-F]/ {
     if (in_bitmap) {
-	if (byte_count > 0) { printf (","); }
-	printf("0x%s", $1);
-	byte_count++;
+        if (row_count > 0) { bitmap = bitmap ","; }
+        # Font is left aligned in the byte, the LCD uses the lower 5 bits.
+        bitmap = bitmap sprintf("0x%02X", int(hex_value($1) / 8));
+        row_count++;
     }
 }
 
 /^ENDCHAR/                {
-    printf("}}, // U+%04X %s\n", enc, val);
-    in_bitmap=0; count++; 
+    in_bitmap = 0;
+    if (enc < 65536 && (!subset || enc < 128 || (enc in wanted))) {
+        glyph_codepoint[count] = enc;
+        glyph_name[count] = name;
+        glyph_bitmap[count] = bitmap;
+        count++;
+    }
 }
 
 END {
-    printf("};\nconst int kFontDataSize = %d;\n", count);
+    print("// Generated code. Do not edit.");
+    print("#include \"font-data.h\"");
+    print("");
+
+    printf("const uint8_t kFontGlyphs[][8] = {\n");
+    for (g = 0; g < count; g++) {
+        printf("  {%s}, // U+%04X %s\n",
+               glyph_bitmap[g], glyph_codepoint[g], glyph_name[g]);
+    }
+    printf("};\nconst int kFontGlyphCount = %d;\n\n", count);
+
+    # Pages are 256 codepoints; glyphs are sorted, so each page is a range.
+    pages = 0;
+    printf("const struct FontPage kFontPages[] = {\n");
+    for (g = 0; g < count; ) {
+        page = int(glyph_codepoint[g] / 256);
+        page_number[page] = ++pages;
+        for (w = 0; w < 8; w++) { present[w] = 0; rank[w] = -1; }
+        for (; g < count && int(glyph_codepoint[g] / 256) == page; g++) {
+            low = glyph_codepoint[g] % 256;
+            w = int(low / 32);
+            present[w] += 2 ^ (low % 32);
+            if (rank[w] < 0) rank[w] = g;
+        }
+        # Words without glyphs get the index of the next glyph; never read.
+        next_index = g;
+        for (w = 7; w >= 0; w--) {
+            if (rank[w] < 0) rank[w] = next_index; else next_index = rank[w];
+        }
+        printf("  { // U+%04X\n    {", page * 256);
+        for (w = 0; w < 8; w++) {
+            # Print in halves; some awks only have 32 bit signed integers.
+            printf("%s0x%04X%04XU", (w ? "," : ""),
+                   int(present[w] / 65536), present[w] % 65536);
+        }
+        printf("},\n    {");
+        for (w = 0; w < 8; w++) printf("%s%d", (w ? "," : ""), rank[w]);
+        printf("} },\n");
+    }
+    printf("};\n\n");
+
+    printf("const uint8_t kFontPageIndex[256] = {");
+    for (p = 0; p < 256; p++) {
+        if (p % 16 == 0) printf("\n ");
+        printf(" %d,", (p in page_number) ? page_number[p] : 0);
+    }
+    printf("\n};\n");
 }
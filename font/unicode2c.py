@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+# Generates the constant tables for text-fold.cc from the Unicode database
+# that comes with Python:
+#  - canonical combining classes,
+#  - canonical composition pairs (to compose NFD input to NFC),
+#  - fallback folds for characters a display can't show: one level of
+#    accent stripping, compatibility forms, typographic punctuation and
+#    transliteration of letters without decomposition.
+# Only the Basic Multilingual Plane is considered; our font has nothing
+# beyond it.
+#
+# The output is checked in as text-fold-data.h, so building doesn't depend
+# on the Python of the build host. Regenerate with 'make fold-tables' when
+# moving to another Unicode version, and update UNICODE_VERSION with it.
+
+import sys
+import unicodedata
+
+MAX_FOLD_LEN = 4
+
+# The Unicode version text-fold-data.h is generated from.
+UNICODE_VERSION = "14.0.0"
+
+# Folds that are not in the Unicode database: punctuation to ASCII and
+# letters that have no decomposition.
+EXTRA_FOLDS = {
+    # Quotes, dashes and other typography.
+    0x2018: "'", 0x2019: "'", 0x201A: "'", 0x201B: "'",
+    0x2032: "'", 0x2035: "'", 0x02BB: "'", 0x02BC: "'",
+    0x201C: '"', 0x201D: '"', 0x201E: '"', 0x201F: '"',
+    0x2033: '"', 0x00AB: '<<', 0x00BB: '>>', 0x2039: '<', 0x203A: '>',
+    0x2010: '-', 0x2011: '-', 0x2012: '-', 0x2013: '-', 0x2014: '-',
+    0x2015: '-', 0x2212: '-', 0x00AD: '',
+    0x2022: '*', 0x00B7: '.', 0x2026: '...',
+    0x00D7: 'x', 0x00F7: '/', 0x00A9: '(c)', 0x00AE: '(R)',
+    0x00A0: ' ', 0x2007: ' ', 0x202F: ' ', 0x200B: '',
+    0x2190: '<-', 0x2192: '->', 0x21D0: '<=', 0x21D2: '=>',
+    0x266A: '*', 0x266B: '*', 0x2669: '*',
+    # Latin letters without decomposition.
+    0x00C6: 'AE', 0x00E6: 'ae', 0x0152: 'OE', 0x0153: 'oe',
+    0x00D8: 'O', 0x00F8: 'o', 0x0141: 'L', 0x0142: 'l',
+    0x0110: 'D', 0x0111: 'd', 0x00D0: 'D', 0x00F0: 'd',
+    0x00DE: 'Th', 0x00FE: 'th', 0x00DF: 'ss', 0x1E9E: 'SS',
+    0x0131: 'i', 0x0126: 'H', 0x0127: 'h', 0x0166: 'T', 0x0167: 't',
+    0x014A: 'N', 0x014B: 'n', 0x0138: 'q', 0x018F: 'E', 0x0259: 'e',
+    0x0192: 'f',
+}
+
+# Transliteration of Greek and Cyrillic letters.
+GREEK = ("ΑA ΒB ΓG ΔD ΕE ΖZ ΗI ΘTh ΙI ΚK ΛL ΜM ΝN ΞX ΟO ΠP ΡR ΣS ΤT ΥY ΦF "
+         "ΧCh ΨPs ΩO αa βb γg δd εe ζz ηi θth ιi κk λl μm νn ξx οo πp ρr "
+         "σs ςs τt υy φf χch ψps ωo")
+CYRILLIC = ("АA БB ВV ГG ДD ЕE ЁYo ЖZh ЗZ ИI ЙY КK ЛL МM НN ОO ПP РR СS ТT "
+            "УU ФF ХKh ЦTs ЧCh ШSh ЩShch Ъ' ЫY Ь' ЭE ЮYu ЯYa "
+            "аa бb вv гg дd еe ёyo жzh зz иi йy кk лl мm нn оo пp рr сs тt "
+            "уu фf хkh цts чch шsh щshch ъ' ыy ь' эe юyu яya "
+            "ЄYe єye ІI іi ЇYi їyi ЎU ўu ҐG ґg")
+for table in (GREEK, CYRILLIC):
+    for entry in table.split():
+        EXTRA_FOLDS[ord(entry[0])] = entry[1:]
+
+# Compatibility decompositions that make sense as display fallback.
+COMPAT_TAGS = ("<compat>", "<font>", "<wide>", "<narrow>", "<super>",
+               "<sub>", "<fraction>", "<noBreak>", "<small>")
+
+
+def is_mark(ch):
+    return unicodedata.category(ch).startswith("M")
+
+
+def bmp_chars():
+    for cp in range(0x80, 0x10000):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        yield cp, chr(cp)
+
+
+def combining_class_ranges():
+    ranges = []
+    for cp in range(0, 0x10000):
+        ccc = unicodedata.combining(chr(cp))
+        if ccc == 0:
+            continue
+        if ranges and ranges[-1][1] == cp - 1 and ranges[-1][2] == ccc:
+            ranges[-1][1] = cp
+        else:
+            ranges.append([cp, cp, ccc])
+    return ranges
+
+
+def composition_pairs():
+    pairs = []
+    for cp, ch in bmp_chars():
+        decomposition = unicodedata.decomposition(ch)
+        if not decomposition or decomposition.startswith("<"):
+            continue
+        parts = [int(p, 16) for p in decomposition.split()]
+        if len(parts) != 2 or max(parts) > 0xFFFF:
+            continue
+        # Composition exclusions and non-starter decompositions don't
+        # recompose in NFC.
+        if unicodedata.normalize("NFC", chr(parts[0]) + chr(parts[1])) != ch:
+            continue
+        pairs.append(((parts[0] << 16) | parts[1], cp))
+    return sorted(pairs)
+
+
+def fold_for(cp, ch):
+    if cp in EXTRA_FOLDS:
+        return EXTRA_FOLDS[cp]
+    decomposition = unicodedata.decomposition(ch)
+    if not decomposition:
+        return None
+    if decomposition.startswith("<"):
+        tag, rest = decomposition.split(" ", 1)
+        if tag not in COMPAT_TAGS:
+            return None
+        result = "".join(chr(int(p, 16)) for p in rest.split())
+        if tag == "<fraction>":
+            result = result.replace("⁄", "/")
+    else:
+        # One level of canonical decomposition; the display fallback
+        # applies folds repeatedly, so ǖ becomes ü and, if needed, u.
+        result = chr(int(decomposition.split()[0], 16))
+    result = "".join(c for c in result if not is_mark(c))
+    if result == ch or not all(foldable(ord(c)) for c in result):
+        return None
+    return result
+
+
+def foldable(cp):
+    # Alphabetic scripts, symbols, ligatures and full-width forms. Folds of
+    # CJK and Hangul don't lead to anything a 5x8 display can show.
+    return cp < 0x3000 or 0xFB00 <= cp <= 0xFB4F or 0xFF00 <= cp <= 0xFFEF
+
+
+def folds():
+    result = []
+    for cp, ch in bmp_chars():
+        if is_mark(ch) or not foldable(cp):
+            continue      # Marks that don't compose are dropped at runtime.
+        fold = fold_for(cp, ch)
+        if fold is None or len(fold) > MAX_FOLD_LEN:
+            continue
+        result.append((cp, fold))
+    return result
+
+
+def main():
+    if (unicodedata.unidata_version != UNICODE_VERSION
+            and "--any-version" not in sys.argv[1:]):
+        sys.exit("This Python has Unicode %s, the tables are for %s; use a "
+                 "matching Python, or --any-version to move to it."
+                 % (unicodedata.unidata_version, UNICODE_VERSION))
+    out = sys.stdout
+    out.write("// Generated by font/unicode2c.py from Unicode %s. Do not edit.\n"
+              % unicodedata.unidata_version)
+    out.write("// Included by text-fold.cc only.\n\n")
+
+    ranges = combining_class_ranges()
+    out.write("constexpr CombiningClassRange kCombiningClasses[] = {\n")
+    for first, last, ccc in ranges:
+        out.write("  { 0x%04X, 0x%04X, %d },\n" % (first, last, ccc))
+    out.write("};\n\n")
+
+    pairs = composition_pairs()
+    out.write("constexpr CompositionPair kCompositions[] = {\n")
+    for key, composite in pairs:
+        out.write("  { 0x%08XU, 0x%04X },  // %s\n"
+                  % (key, composite, unicodedata.name(chr(composite), "")))
+    out.write("};\n\n")
+
+    out.write("constexpr FoldEntry kFolds[] = {\n")
+    for cp, fold in folds():
+        codes = ", ".join("0x%04X" % ord(c) for c in fold) or "0"
+        out.write("  { 0x%04X, %d, { %s } },  // %s\n"
+                  % (cp, len(fold), codes, unicodedata.name(chr(cp), "")))
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,149 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gpio-chardev.h"
+
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#ifdef GPIO_V2_GET_LINE_IOCTL
+
+GPIOCharDevBackend *GPIOCharDevBackend::Open(const char *chip_path) {
+  const int fd = open(chip_path, O_RDWR | O_CLOEXEC);
+  if (fd < 0) {
+    perror(chip_path);
+    return NULL;
+  }
+  struct gpiochip_info info;
+  if (ioctl(fd, GPIO_GET_CHIPINFO_IOCTL, &info) < 0) {
+    fprintf(stderr, "%s: not a GPIO chip.\n", chip_path);
+    close(fd);
+    return NULL;
+  }
+  return new GPIOCharDevBackend(fd);
+}
+
+GPIOCharDevBackend::GPIOCharDevBackend(int chip_fd)
+  : chip_fd_(chip_fd), output_fd_(-1), input_fd_(-1),
+    output_bits_(0), input_bits_(0), write_failed_(false) {
+  memset(output_index_, 0, sizeof(output_index_));
+  memset(input_index_, 0, sizeof(input_index_));
+}
+
+GPIOCharDevBackend::~GPIOCharDevBackend() {
+  if (output_fd_ >= 0) close(output_fd_);
+  if (input_fd_ >= 0) close(input_fd_);
+  close(chip_fd_);
+}
+
+int GPIOCharDevBackend::RequestLines(uint32_t bits, uint64_t flags,
+                                     uint8_t *line_index) {
+  struct gpio_v2_line_request request;
+  memset(&request, 0, sizeof(request));
+  for (int b = 0; b < 32; ++b) {
+    if ((bits & (1u << b)) == 0) continue;
+    line_index[b] = request.num_lines;
+    request.offsets[request.num_lines++] = b;
+  }
+  strncpy(request.consumer, "upnp-display", sizeof(request.consumer) - 1);
+  request.config.flags = flags;
+  if (ioctl(chip_fd_, GPIO_V2_GET_LINE_IOCTL, &request) < 0) {
+    perror("Requesting GPIO lines");
+    return -1;
+  }
+  return request.fd;
+}
+
+uint32_t GPIOCharDevBackend::InitOutputs(uint32_t outputs) {
+  if (output_fd_ >= 0) close(output_fd_);
+  output_bits_ = 0;
+  output_fd_ = -1;
+  write_failed_ = false;
+  if (outputs == 0) return 0;
+  output_fd_ = RequestLines(outputs, GPIO_V2_LINE_FLAG_OUTPUT,
+                            output_index_);
+  if (output_fd_ >= 0) output_bits_ = outputs;
+  return output_bits_;
+}
+
+uint32_t GPIOCharDevBackend::InitInputs(uint32_t inputs) {
+  if (input_fd_ >= 0) close(input_fd_);
+  input_bits_ = 0;
+  input_fd_ = -1;
+  if (inputs == 0) return 0;
+  input_fd_ = RequestLines(inputs, GPIO_V2_LINE_FLAG_INPUT, input_index_);
+  if (input_fd_ >= 0) input_bits_ = inputs;
+  return input_bits_;
+}
+
+void GPIOCharDevBackend::SetAndClearBits(uint32_t set, uint32_t clear) {
+  struct gpio_v2_line_values values = { 0, 0 };
+  for (uint32_t b = (set | clear) & output_bits_; b != 0; b &= b - 1) {
+    const int gpio = __builtin_ctz(b);
+    const uint64_t line = 1ULL << output_index_[gpio];
+    values.mask |= line;
+    if (set & (1u << gpio)) values.bits |= line;
+  }
+  if (values.mask == 0) return;
+  if (ioctl(output_fd_, GPIO_V2_LINE_SET_VALUES_IOCTL, &values) < 0
+      && !write_failed_) {
+    // E.g. the lines were taken away; once is enough, this is per byte.
+    perror("Setting GPIO lines");
+    write_failed_ = true;
+  }
+}
+
+uint32_t GPIOCharDevBackend::GetBits(uint32_t mask) {
+  struct gpio_v2_line_values values = { 0, 0 };
+  for (uint32_t b = mask & input_bits_; b != 0; b &= b - 1) {
+    values.mask |= 1ULL << input_index_[__builtin_ctz(b)];
+  }
+  if (values.mask == 0
+      || ioctl(input_fd_, GPIO_V2_LINE_GET_VALUES_IOCTL, &values) < 0) {
+    return 0;
+  }
+  uint32_t result = 0;
+  for (uint32_t b = mask & input_bits_; b != 0; b &= b - 1) {
+    const int gpio = __builtin_ctz(b);
+    if (values.bits & (1ULL << input_index_[gpio])) result |= 1u << gpio;
+  }
+  return result;
+}
+
+#else  // Kernel headers before Linux 5.10 don't have the v2 interface.
+
+GPIOCharDevBackend *GPIOCharDevBackend::Open(const char *chip_path) {
+  fprintf(stderr, "%s: compiled without GPIO character device v2 support.\n",
+          chip_path);
+  return NULL;
+}
+
+GPIOCharDevBackend::GPIOCharDevBackend(int chip_fd)
+  : chip_fd_(chip_fd), write_failed_(false) {}
+GPIOCharDevBackend::~GPIOCharDevBackend() {}
+uint32_t GPIOCharDevBackend::InitOutputs(uint32_t) { return 0; }
+uint32_t GPIOCharDevBackend::InitInputs(uint32_t) { return 0; }
+void GPIOCharDevBackend::SetAndClearBits(uint32_t, uint32_t) {}
+uint32_t GPIOCharDevBackend::GetBits(uint32_t) { return 0; }
+int GPIOCharDevBackend::RequestLines(uint32_t, uint64_t, uint8_t *) {
+  return -1;
+}
+
+#endif
@@ -0,0 +1,52 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef RPI_GPIO_CHARDEV_H
+#define RPI_GPIO_CHARDEV_H
+
+#include "gpio.h"
+
+// GPIO through the Linux GPIO character device (/dev/gpiochipN, uAPI v2).
+// Works on any board the kernel has a driver for, including the Pi 5, and
+// with the gpio-sim module for testing. Bit n in the masks is line n of the
+// chip. All outputs are requested together, so each update is one ioctl().
+class GPIOCharDevBackend : public GPIOBackend {
+ public:
+  // Open the chip. Returns NULL and prints why if it can't be used.
+  static GPIOCharDevBackend *Open(const char *chip_path);
+  ~GPIOCharDevBackend();
+
+  uint32_t InitOutputs(uint32_t outputs) override;
+  uint32_t InitInputs(uint32_t inputs) override;
+  void SetAndClearBits(uint32_t set, uint32_t clear) override;
+  uint32_t GetBits(uint32_t mask) override;
+
+ private:
+  explicit GPIOCharDevBackend(int chip_fd);
+
+  // Request the lines in "bits" with the given flags; -1 on failure.
+  int RequestLines(uint32_t bits, uint64_t flags, uint8_t *line_index);
+
+  const int chip_fd_;
+  int output_fd_;
+  int input_fd_;
+  uint32_t output_bits_;
+  uint32_t input_bits_;
+  uint8_t output_index_[32];   // GPIO number -> position in request.
+  uint8_t input_index_[32];
+  bool write_failed_;          // Reported already.
+};
+
+#endif  // RPI_GPIO_CHARDEV_H
@@ -0,0 +1,175 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gpio-trace.h"
+
+#include <time.h>
+
+#include <algorithm>
+#include <vector>
+
+static int64_t MonotonicNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+GPIOTracer::GPIOTracer(GPIO *target, int capacity)
+  : target_(target), capacity_(capacity), ring_(new Change[capacity]),
+    written_(0), pins_(0), traced_bits_(0) {
+  for (int i = 0; i < 32; ++i) {
+    names_[i] = "gpio" + std::to_string(i);
+  }
+}
+
+GPIOTracer::~GPIOTracer() {
+  delete [] ring_;
+}
+
+void GPIOTracer::SetPinName(int gpio, const std::string &name) {
+  if (gpio >= 0 && gpio < 32) names_[gpio] = name;
+}
+
+uint32_t GPIOTracer::InitOutputs(uint32_t outputs) {
+  const uint32_t result = target_->InitOutputs(outputs);
+  traced_bits_ |= result;
+  return result;
+}
+
+uint32_t GPIOTracer::InitInputs(uint32_t inputs) {
+  return target_->InitInputs(inputs);
+}
+
+void GPIOTracer::SetAndClearBits(uint32_t set, uint32_t clear) {
+  target_->SetAndClearBits(set, clear);
+  const uint32_t pins = (pins_ | set) & ~clear;
+  if (pins == pins_) return;
+  pins_ = pins;
+  // Single writer: fill the slot, then publish it.
+  const uint64_t index = written_.load(std::memory_order_relaxed);
+  Change &change = ring_[index % capacity_];
+  change.nanos = MonotonicNanos();
+  change.pins = pins;
+  written_.store(index + 1, std::memory_order_release);
+}
+
+uint32_t GPIOTracer::GetBits(uint32_t mask) {
+  return target_->GetBits(mask);
+}
+
+int GPIOTracer::Snapshot(Change *out) const {
+  const uint64_t end = written_.load(std::memory_order_acquire);
+  const uint64_t begin = end > (uint64_t) capacity_ ? end - capacity_ : 0;
+  int count = 0;
+  for (uint64_t i = begin; i < end; ++i) {
+    out[count++] = ring_[i % capacity_];
+  }
+  // Drop entries the writer may have overwritten while we copied; that
+  // includes the slot it is filling right now.
+  const uint64_t now = written_.load(std::memory_order_acquire);
+  const uint64_t unsafe_end = now + 1 > (uint64_t) capacity_
+    ? now + 1 - capacity_ : 0;
+  const int overwritten = unsafe_end > begin
+    ? (int) std::min<uint64_t>(count, unsafe_end - begin) : 0;
+  std::copy(out + overwritten, out + count, out);
+  return count - overwritten;
+}
+
+bool GPIOTracer::WriteVCD(const char *filename) const {
+  std::vector<Change> changes(capacity_);
+  const int count = Snapshot(changes.data());
+
+  FILE *out = fopen(filename, "w");
+  if (out == NULL) {
+    perror(filename);
+    return false;
+  }
+  fprintf(out, "$timescale 1ns $end\n$scope module gpio $end\n");
+  for (int b = 0; b < 32; ++b) {
+    if (traced_bits_ & (1u << b))
+      fprintf(out, "$var wire 1 %c %s $end\n", '!' + b, names_[b].c_str());
+  }
+  fprintf(out, "$upscope $end\n$enddefinitions $end\n");
+
+  uint32_t previous = 0;
+  for (int i = 0; i < count; ++i) {
+    const Change &change = changes[i];
+    fprintf(out, "#%lld\n", (long long)(change.nanos - changes[0].nanos));
+    for (int b = 0; b < 32; ++b) {
+      const uint32_t bit = 1u << b;
+      if ((traced_bits_ & bit) && (i == 0 || ((change.pins ^ previous) & bit)))
+        fprintf(out, "%d%c\n", (change.pins & bit) ? 1 : 0, '!' + b);
+    }
+    previous = change.pins;
+  }
+  return fclose(out) == 0;
+}
+
+void GPIOTracer::PrintSummary(FILE *out, int clock_gpio,
+                              int pulses_per_byte) const {
+  std::vector<Change> changes(capacity_);
+  const int count = Snapshot(changes.data());
+  const uint32_t clock = 1u << clock_gpio;
+
+  int pulses = 0;
+  int64_t min_width = INT64_MAX;
+  std::vector<int64_t> gaps;    // From end of each pulse to the next one.
+  int64_t rise = -1, last_fall = -1;
+  bool high = false;
+  for (int i = 0; i < count; ++i) {
+    const bool now_high = changes[i].pins & clock;
+    if (now_high == high) continue;
+    high = now_high;
+    if (high) {
+      rise = changes[i].nanos;
+      if (last_fall >= 0) gaps.push_back(rise - last_fall);
+    } else if (rise >= 0) {
+      min_width = std::min(min_width, changes[i].nanos - rise);
+      last_fall = changes[i].nanos;
+      ++pulses;
+    }
+  }
+
+  // The recording may start anywhere within a byte. Gaps within a byte are
+  // short, so the phase with the longest minimum gap is between bytes.
+  int64_t min_gap = 0, max_gap = 0, sum_gap = 0;
+  int byte_gaps = 0;
+  for (int phase = 0; phase < pulses_per_byte; ++phase) {
+    int64_t phase_min = INT64_MAX, phase_max = 0, phase_sum = 0;
+    int phase_count = 0;
+    for (size_t i = phase; i < gaps.size(); i += pulses_per_byte) {
+      phase_min = std::min(phase_min, gaps[i]);
+      phase_max = std::max(phase_max, gaps[i]);
+      phase_sum += gaps[i];
+      ++phase_count;
+    }
+    if (phase_count > 0 && (byte_gaps == 0 || phase_min > min_gap)) {
+      min_gap = phase_min;
+      max_gap = phase_max;
+      sum_gap = phase_sum;
+      byte_gaps = phase_count;
+    }
+  }
+
+  fprintf(out, "GPIO trace: %d changes, %d pulses on %s\n",
+          count, pulses, names_[clock_gpio].c_str());
+  if (pulses > 0)
+    fprintf(out, "  shortest pulse %lldns\n", (long long) min_width);
+  if (byte_gaps > 0)
+    fprintf(out, "  gap between bytes: min %lldns, avg %lldns, max %lldns\n",
+            (long long) min_gap, (long long)(sum_gap / byte_gaps),
+            (long long) max_gap);
+}
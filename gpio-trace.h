@@ -0,0 +1,74 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef RPI_GPIO_TRACE_H
+#define RPI_GPIO_TRACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <string>
+
+#include "gpio.h"
+
+// Records every change of the output pins with a CLOCK_MONOTONIC timestamp,
+// then passes it on to another GPIO that does the actual work (registers or
+// any backend). Set as backend of the GPIO the displays use; without it,
+// nothing is recorded and the register access stays inline.
+//
+// The recording is a fixed size ring that keeps the most recent changes.
+// Recording happens from one thread; writing the files may happen from
+// another one while recording goes on.
+class GPIOTracer : public GPIOBackend {
+ public:
+  // "target" has to be initialized. Keeps the last "capacity" changes.
+  GPIOTracer(GPIO *target, int capacity);
+  ~GPIOTracer();
+
+  // Name to use for the pin in the dump instead of gpioN.
+  void SetPinName(int gpio, const std::string &name);
+
+  uint32_t InitOutputs(uint32_t outputs) override;
+  uint32_t InitInputs(uint32_t inputs) override;
+  void SetAndClearBits(uint32_t set, uint32_t clear) override;
+  uint32_t GetBits(uint32_t mask) override;
+
+  // Write the recorded changes as Value Change Dump, e.g. for GTKWave.
+  bool WriteVCD(const char *filename) const;
+
+  // Print shortest high pulse on the "clock_gpio" (e.g. the LCD enable),
+  // and the gaps between bytes made of "pulses_per_byte" pulses each.
+  void PrintSummary(FILE *out, int clock_gpio, int pulses_per_byte) const;
+
+ private:
+  struct Change {
+    int64_t nanos;
+    uint32_t pins;
+  };
+
+  // Copy recorded changes, oldest first. Returns count.
+  int Snapshot(Change *out) const;
+
+  GPIO *const target_;
+  const int capacity_;
+  Change *const ring_;
+  std::atomic<uint64_t> written_;
+  uint32_t pins_;
+  uint32_t traced_bits_;
+  std::string names_[32];
+};
+
+#endif  // RPI_GPIO_TRACE_H
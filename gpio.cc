@@ -12,8 +12,11 @@
 #include <string.h>
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <time.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #define REGISTER_BLOCK_SIZE (4*1024)
 
 // GPIO setup macros. Always use INP_GPIO(x) before using OUT_GPIO(x) or SET_GPIO_ALT(x,y)
@@ -124,39 +127,151 @@ static volatile uint32_t *mmap_bcm_register(off_t register_offset) {
   return result;
 }
 
-static void busy_wait_nanos_rpi_1(long nanos) {
-  if (nanos < 70) return;
-  // The following loop is determined empirically on a 700Mhz RPi
-  for (uint32_t i = (nanos - 70) >> 2; i != 0; --i) {
-    asm("nop");
+static int64_t MonotonicNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/*static*/ bool GPIO::backends_in_use_ = false;
+// Conservative until calibrated: waits several times too long.
+/*static*/ long GPIO::spin_loops_per_usec_ = 5000;
+/*static*/ long GPIO::spin_overhead_nanos_ = 0;
+
+// GPIOs running on a backend; there are only ever a few.
+namespace {
+struct BackendSlot {
+  const GPIO *gpio;
+  GPIOBackend *backend;
+};
+BackendSlot backend_slots[4];
+}
+
+// Stands in for the registers of GPIOs on a backend, so that code that
+// still writes registers directly (libpt6312) does not crash.
+static volatile uint32_t backend_registers[REGISTER_BLOCK_SIZE / sizeof(uint32_t)];
+
+// Not inlined, so that the loop measured in calibration is the same machine
+// code that is used for waiting.
+/*static*/ void __attribute__((noinline)) GPIO::Spin(uint32_t loops) {
+  for (; loops != 0; --loops) {
+    asm volatile("");
   }
 }
 
-static void busy_wait_nanos_rpi_2(long nanos) {
-  if (nanos < 20) return;
-  // The following loop is determined empirically on a 900Mhz RPi 2
-  for (uint32_t i = (nanos - 20) * 100 / 110; i != 0; --i) {
-    asm("");
+// The busy_nano_sleep() loop, for code that calls it through
+// busy_wait_impl_.
+/*static*/ void GPIO::CalibratedBusyWait(long nanos) {
+  if (nanos <= spin_overhead_nanos_) return;
+  Spin((nanos - spin_overhead_nanos_) * spin_loops_per_usec_ / 1000);
+}
+
+/*static*/ GPIOBackend *GPIO::BackendOf(const GPIO *gpio) {
+  for (const BackendSlot &slot : backend_slots) {
+    if (slot.gpio == gpio) return slot.backend;
   }
+  return NULL;
 }
 
-static void busy_wait_nanos_rpi_3(long nanos) {
-  if (nanos < 20) return;
-  for (uint32_t i = (nanos - 15) * 100 / 73; i != 0; --i) {
-    asm("");
+void GPIO::CalibrateBusyWait(bool report) {
+  // Keep the CPU busy for a bit first, so that a frequency governor has
+  // ramped up. Calibrating on a slow clock would make waits too short later.
+  const int64_t warmup_end = MonotonicNanos() + 20 * 1000000LL;
+  while (MonotonicNanos() < warmup_end) {
+    Spin(1000);
+  }
+
+  // The fastest of a few runs; slower ones have been interrupted. Using the
+  // fastest rate means we err on the side of waiting longer.
+  static const uint32_t kCalibrationLoops = 20000;
+  static const int kRuns = 20;
+  int64_t best = INT64_MAX;
+  for (int i = 0; i < kRuns; ++i) {
+    const int64_t start = MonotonicNanos();
+    Spin(kCalibrationLoops);
+    best = std::min(best, MonotonicNanos() - start);
+  }
+  spin_loops_per_usec_ = std::max(1L, (long)(kCalibrationLoops * 1000LL
+                                             / std::max(best, (int64_t) 1)));
+
+  // Fixed cost of a call, which short waits subtract.
+  static const int kOverheadCalls = 1000;
+  best = INT64_MAX;
+  for (int i = 0; i < kRuns; ++i) {
+    const int64_t start = MonotonicNanos();
+    for (int j = 0; j < kOverheadCalls; ++j) {
+      Spin(1);
+    }
+    best = std::min(best, MonotonicNanos() - start);
+  }
+  spin_overhead_nanos_ = best / kOverheadCalls;
+
+  // Check; if the clock was faster than during calibration, waits would be
+  // too short. Never let that happen.
+  static const long kCheckWait = 2000;
+  for (int attempt = 0; attempt < 3; ++attempt) {
+    const long measured = MeasureBusyWait(kCheckWait);
+    if (measured >= kCheckWait) break;
+    if (measured <= 0) {   // Too short for the clock to see; can't scale.
+      spin_loops_per_usec_ *= 2;
+      continue;
+    }
+    spin_loops_per_usec_ = spin_loops_per_usec_ * kCheckWait / measured + 1;
+  }
+
+  if (report) {
+    static const long kWaits[] = { 400, kCheckWait };
+    for (const long wait : kWaits) {
+      const long measured = MeasureBusyWait(wait);
+      fprintf(stderr, "GPIO busy-wait %5ldns: measured %5ldns (%+.1f%%)\n",
+              wait, measured, 100.0 * (measured - wait) / wait);
+    }
   }
 }
 
-static void busy_wait_nanos_rpi_4(long nanos) {
-  if (nanos < 20) return;
-  // Interesting, the Pi4 is _slower_ than the Pi3 ? At least for this busy loop
-  for (uint32_t i = (nanos - 5) * 100 / 132; i != 0; --i) {
-    asm("");
+// Shortest time a busy_nano_sleep(nanos) took over a few runs.
+long GPIO::MeasureBusyWait(long nanos) {
+  static const int kRuns = 20;
+  static const int kCalls = 100;
+  int64_t best = INT64_MAX;
+  for (int i = 0; i < kRuns; ++i) {
+    const int64_t start = MonotonicNanos();
+    for (int j = 0; j < kCalls; ++j) {
+      busy_nano_sleep(nanos);
+    }
+    best = std::min(best, MonotonicNanos() - start);
   }
+  return best / kCalls;
 }
 
 // -- public interface
-GPIO::GPIO() : input_bits_(0), output_bits_(0), gpio_port_(NULL) {}
+GPIO::GPIO() : input_bits_(0), output_bits_(0), gpio_port_(NULL),
+               busy_wait_impl_(CalibratedBusyWait) {}
+
+GPIO::~GPIO() {
+  if (backends_in_use_) SetBackend(NULL);
+}
+
+void GPIO::SetBackend(GPIOBackend *backend) {
+  BackendSlot *free_slot = NULL;
+  for (BackendSlot &slot : backend_slots) {
+    if (slot.gpio == this) {
+      free_slot = &slot;
+      break;
+    }
+    if (slot.gpio == NULL && free_slot == NULL) free_slot = &slot;
+  }
+  if (backend == NULL) {
+    if (free_slot != NULL && free_slot->gpio == this) *free_slot = {};
+    return;
+  }
+  if (free_slot == NULL) {
+    fprintf(stderr, "GPIO: too many backends.\n");
+    abort();
+  }
+  *free_slot = { this, backend };
+  backends_in_use_ = true;
+}
 
 uint32_t GPIO::InitInputs(uint32_t inputs) {
   if (gpio_port_ == NULL) {
@@ -164,6 +279,10 @@ uint32_t GPIO::InitInputs(uint32_t inputs) {
     return 0;
   }
   inputs &= kValidBits;   // Sanitize input.
+  if (GPIOBackend *b = backend()) {
+    input_bits_ = b->InitInputs(inputs);
+    return input_bits_;
+  }
   input_bits_ = inputs;
   for (uint32_t b = 0; b < 27; ++b) {
     if (inputs & (1 << b)) {
@@ -179,6 +298,10 @@ uint32_t GPIO::InitOutputs(uint32_t outputs) {
     return 0;
   }
   outputs &= kValidBits;   // Sanitize input.
+  if (GPIOBackend *b = backend()) {
+    output_bits_ = b->InitOutputs(outputs);
+    return output_bits_;
+  }
   output_bits_ = outputs;
   for (uint32_t b = 0; b < 27; ++b) {
     if (outputs & (1 << b)) {
@@ -190,17 +313,17 @@ uint32_t GPIO::InitOutputs(uint32_t outputs) {
 }
 
 bool GPIO::Init() {
+  if (gpio_port_ != NULL)
+    return true;
 
-  if (gpio_port_ == NULL) {
-    const RaspberryPiModel model = DetermineRaspberryModel();
+  if (backend() == NULL) {
     gpio_port_ = mmap_bcm_register(GPIO_REGISTER_OFFSET);
-    switch (model) {
-    case PI_MODEL_1: busy_wait_impl_ = busy_wait_nanos_rpi_1; break;
-    case PI_MODEL_2: busy_wait_impl_ = busy_wait_nanos_rpi_2; break;
-    case PI_MODEL_3: busy_wait_impl_ = busy_wait_nanos_rpi_3; break;
-    case PI_MODEL_4: busy_wait_impl_ = busy_wait_nanos_rpi_4; break;
-    }
+    if (gpio_port_ == NULL)
+      return false;
+  } else {
+    gpio_port_ = backend_registers;
   }
-  return gpio_port_ != NULL;
+  CalibrateBusyWait(true);
+  busy_wait_impl_ = CalibratedBusyWait;
+  return true;
 }
-
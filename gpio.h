@@ -2,8 +2,25 @@
 #ifndef RPI_GPIO_H
 #define RPI_GPIO_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+// Alternative to the memory mapped registers of the Raspberry Pi, e.g. the
+// Linux GPIO character device. Bits are GPIO numbers like with the mmap
+// access.
+class GPIOBackend {
+ public:
+  virtual ~GPIOBackend() {}
+
+  // Returns the bits that are actually set up.
+  virtual uint32_t InitOutputs(uint32_t outputs) = 0;
+  virtual uint32_t InitInputs(uint32_t inputs) = 0;
+
+  // Set the bits in "set" and clear the bits in "clear" in one update.
+  virtual void SetAndClearBits(uint32_t set, uint32_t clear) = 0;
+  virtual uint32_t GetBits(uint32_t mask) = 0;
+};
+
 // For now, everything is initialized as output.
 class GPIO {
  public:
@@ -11,6 +28,11 @@ class GPIO {
   static const uint32_t kValidBits;
 
   GPIO();
+  ~GPIO();
+
+  // Use the given backend instead of the Raspberry Pi registers. Needs to be
+  // called before Init(). Does not take ownership.
+  void SetBackend(GPIOBackend *backend);
 
   // Initialize before use. Returns 'true' if successful, 'false' otherwise
   // (e.g. due to a permission problem).
@@ -26,35 +48,71 @@ class GPIO {
 
   // Set the bits that are '1' in the output. Leave the rest untouched.
   inline void SetBits(uint32_t value) {
+    if (GPIOBackend *b = backend()) { b->SetAndClearBits(value, 0); return; }
     gpio_port_[0x1C / sizeof(uint32_t)] = value;
   }
 
   // Get the bit input status of the bits that are '1' in the mask
   inline uint32_t GetBits(uint32_t mask) {
+    if (GPIOBackend *b = backend()) return b->GetBits(mask);
     return gpio_port_[13] & mask;
   }
 
   // Clear the bits that are '1' in the output. Leave the rest untouched.
   inline void ClearBits(uint32_t value) {
+    if (GPIOBackend *b = backend()) { b->SetAndClearBits(0, value); return; }
     gpio_port_[0x28 / sizeof(uint32_t)] = value;
   }
 
+  // Set and clear bits at once. With the registers, these are two writes,
+  // setting first; backends can do it in one update.
+  inline void SetAndClearBits(uint32_t set, uint32_t clear) {
+    if (GPIOBackend *b = backend()) { b->SetAndClearBits(set, clear); return; }
+    gpio_port_[0x1C / sizeof(uint32_t)] = set;
+    gpio_port_[0x28 / sizeof(uint32_t)] = clear;
+  }
+
   inline void Write(uint32_t value) {
     // Writing a word is two operations. The IO is actually pretty slow, so
     // this should probably  be unnoticable.
-    SetBits(value & output_bits_);
-    ClearBits(~value & output_bits_);
+    SetAndClearBits(value & output_bits_, ~value & output_bits_);
   }
 
+  // Wait at least "nanos" without giving up the CPU; for delays that are
+  // much shorter than what the scheduler can do. Calibrated in Init().
   inline void busy_nano_sleep(long nanos) {
-    busy_wait_impl_(nanos);
+    if (nanos <= spin_overhead_nanos_) return;
+    Spin((nanos - spin_overhead_nanos_) * spin_loops_per_usec_ / 1000);
   }
 
+  // Measure the speed of the busy_nano_sleep() loop against the monotonic
+  // clock. Called by Init(); call again if the CPU frequency might have
+  // changed. If "report" is set, prints the remaining error to stderr.
+  void CalibrateBusyWait(bool report);
+
  private:
+  static void Spin(uint32_t loops);
+  static void CalibratedBusyWait(long nanos);
+  static GPIOBackend *BackendOf(const GPIO *gpio);
+  long MeasureBusyWait(long nanos);
+
+  inline GPIOBackend *backend() const {
+    return backends_in_use_ ? BackendOf(this) : NULL;
+  }
+
+  // Shared by all instances: backends are looked up by instance, and the
+  // calibration is a property of the CPU.
+  static bool backends_in_use_;
+  static long spin_loops_per_usec_;
+  static long spin_overhead_nanos_;
+
+  // libpt6312 defines the global 'gpio' and inlines Write() and
+  // busy_nano_sleep() with its own copy of this class, so the members must
+  // stay exactly these. New state goes into the statics above.
   uint32_t input_bits_;
   uint32_t output_bits_;
   volatile uint32_t *gpio_port_;
-  void (*busy_wait_impl_)(long);
+  void (*busy_wait_impl_)(long);   // For code compiled by libpt6312.
 };
 
 #endif  // RPI_GPIO_H
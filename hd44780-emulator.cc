@@ -0,0 +1,248 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "hd44780-emulator.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "font-data.h"
+#include "utf8.h"
+
+// Execution times from the datasheet (270kHz) and minimum enable pulse.
+#define HD44780_OPERATION_NSEC 37000
+#define HD44780_CLEAR_HOME_NSEC 1520000
+#define HD44780_ENABLE_PULSE_MIN_NSEC 230
+
+static const int kLineLength = 40;
+
+static int64_t MonotonicNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+HD44780Emulator::HD44780Emulator(int width, HD44780Rom rom,
+                                 const LCDPinMap &pins)
+  : width_(width), rom_(rom), pins_state_(0), enable_rise_(0),
+    four_bit_mode_(false), have_high_nibble_(false), high_nibble_(0),
+    busy_until_(0), address_counter_(0), address_is_cgram_(false),
+    increment_(true), shift_display_(false), display_on_(false),
+    display_shift_(0) {
+  rs_bit_ = 1u << pins.rs;
+  e_bit_ = 1u << pins.e;
+  for (int i = 0; i < 4; ++i) data_bits_[i] = 1u << pins.data[i];
+  memset(ddram_, ' ', sizeof(ddram_));
+  memset(cgram_, 0, sizeof(cgram_));
+  ResetCounters();
+}
+
+void HD44780Emulator::ResetCounters() {
+  data_bytes_ = 0;
+  commands_ = 0;
+  timing_violations_ = 0;
+  short_enable_pulses_ = 0;
+}
+
+void HD44780Emulator::SetAndClearBits(uint32_t set, uint32_t clear) {
+  const uint32_t before = pins_state_;
+  pins_state_ = (pins_state_ | set) & ~clear;
+  if (!(before & e_bit_) && (pins_state_ & e_bit_)) {
+    enable_rise_ = MonotonicNanos();
+  }
+  else if ((before & e_bit_) && !(pins_state_ & e_bit_)) {
+    // Falling edge of enable: the controller latches the data lines.
+    const int64_t now = MonotonicNanos();
+    if (now - enable_rise_ < HD44780_ENABLE_PULSE_MIN_NSEC)
+      ++short_enable_pulses_;
+    uint8_t nibble = 0;
+    for (int i = 0; i < 4; ++i) {
+      if (pins_state_ & data_bits_[i]) nibble |= 1 << i;
+    }
+    ReceiveNibble(nibble, pins_state_ & rs_bit_, now);
+  }
+}
+
+void HD44780Emulator::ReceiveNibble(uint8_t nibble, bool is_data,
+                                    int64_t now) {
+  if (!four_bit_mode_) {
+    // 8 bit mode: the lower data lines are not connected, read as 0.
+    Execute(nibble << 4, is_data, now);
+    return;
+  }
+  if (!have_high_nibble_) {
+    high_nibble_ = nibble;
+    have_high_nibble_ = true;
+    if (now < busy_until_) ++timing_violations_;
+    return;
+  }
+  have_high_nibble_ = false;
+  Execute((high_nibble_ << 4) | nibble, is_data, now);
+}
+
+void HD44780Emulator::Execute(uint8_t byte, bool is_data, int64_t now) {
+  if (!four_bit_mode_ && now < busy_until_) ++timing_violations_;
+  int64_t duration = HD44780_OPERATION_NSEC;
+  if (is_data) {
+    WriteData(byte);
+    ++data_bytes_;
+  } else {
+    ExecuteCommand(byte);
+    ++commands_;
+    if (byte == 0x01 || (byte & 0xfe) == 0x02)
+      duration = HD44780_CLEAR_HOME_NSEC;
+  }
+  busy_until_ = now + duration;
+}
+
+void HD44780Emulator::ExecuteCommand(uint8_t cmd) {
+  if (cmd & 0x80) {              // Set DDRAM address.
+    address_counter_ = cmd & 0x7f;
+    address_is_cgram_ = false;
+  } else if (cmd & 0x40) {       // Set CGRAM address.
+    address_counter_ = cmd & 0x3f;
+    address_is_cgram_ = true;
+  } else if (cmd & 0x20) {       // Function set; we only care for the width.
+    const bool eight_bit = cmd & 0x10;
+    if (four_bit_mode_ == eight_bit) have_high_nibble_ = false;
+    four_bit_mode_ = !eight_bit;
+  } else if (cmd & 0x10) {       // Cursor or display shift.
+    const bool right = cmd & 0x04;
+    if (cmd & 0x08) {
+      // Shifting the display left brings later columns into view.
+      display_shift_ = (display_shift_ + (right ? -1 : 1) + kLineLength)
+        % kLineLength;
+    } else {
+      MoveAddressCounter(right);
+    }
+  } else if (cmd & 0x08) {       // Display control. Cursor isn't shown.
+    display_on_ = cmd & 0x04;
+  } else if (cmd & 0x04) {       // Entry mode.
+    increment_ = cmd & 0x02;
+    shift_display_ = cmd & 0x01;
+  } else if (cmd & 0x02) {       // Return home.
+    address_counter_ = 0;
+    address_is_cgram_ = false;
+    display_shift_ = 0;
+  } else if (cmd & 0x01) {       // Clear display.
+    memset(ddram_, ' ', sizeof(ddram_));
+    address_counter_ = 0;
+    address_is_cgram_ = false;
+    increment_ = true;
+    display_shift_ = 0;
+  }
+}
+
+void HD44780Emulator::WriteData(uint8_t byte) {
+  if (address_is_cgram_) {
+    cgram_[address_counter_ & 0x3f] = byte & 0x1f;
+    address_counter_ = (address_counter_ + (increment_ ? 1 : -1)) & 0x3f;
+    return;
+  }
+  const int line = (address_counter_ & 0x40) ? 1 : 0;
+  const int column = address_counter_ & 0x3f;
+  if (column < kLineLength) ddram_[line * kLineLength + column] = byte;
+  MoveAddressCounter(increment_);
+  if (shift_display_) {
+    // Display follows the cursor: moves left when incrementing.
+    display_shift_ = (display_shift_ + (increment_ ? 1 : -1) + kLineLength)
+      % kLineLength;
+  }
+}
+
+void HD44780Emulator::MoveAddressCounter(bool increment) {
+  if (address_is_cgram_) {
+    address_counter_ = (address_counter_ + (increment ? 1 : -1)) & 0x3f;
+    return;
+  }
+  // The two lines form one ring: 0x27 is followed by 0x40, 0x67 by 0x00.
+  int line = (address_counter_ & 0x40) ? 1 : 0;
+  int column = (address_counter_ & 0x3f) + (increment ? 1 : -1);
+  if (column >= kLineLength) { column = 0; line = 1 - line; }
+  if (column < 0) { column = kLineLength - 1; line = 1 - line; }
+  address_counter_ = (line ? 0x40 : 0) | column;
+}
+
+int HD44780Emulator::DDRAMIndex(int row, int column) const {
+  return row * kLineLength + (column + display_shift_) % kLineLength;
+}
+
+const uint8_t *HD44780Emulator::CellBitmap(uint8_t code) const {
+  if (code < 0x10) return cgram_ + (code & 0x07) * 8;
+  const uint32_t cp = HD44780RomCodepointAt(rom_, code);
+  return cp ? findGlyph(cp) : NULL;
+}
+
+std::string HD44780Emulator::RenderText() const {
+  std::string result;
+  for (int row = 0; row < 2; ++row) {
+    for (int column = 0; column < width_; ++column) {
+      const uint8_t code = display_on_ ? ddram_[DDRAMIndex(row, column)] : ' ';
+      uint32_t cp = 0;
+      if (code < 0x10) {
+        // Custom character: find which one the bitmap is.
+        const uint8_t *bitmap = CellBitmap(code);
+        for (uint32_t c = 0x80; c <= 0xFFFF && cp == 0; ++c) {
+          const uint8_t *glyph = findGlyph(c);
+          if (glyph && memcmp(glyph, bitmap, 8) == 0) cp = c;
+        }
+      } else {
+        cp = HD44780RomCodepointAt(rom_, code);
+      }
+      utf8_append_codepoint(cp ? cp : '?', &result);
+    }
+    result.push_back('\n');
+  }
+  return result;
+}
+
+bool HD44780Emulator::WritePPM(const char *filename, int scale) const {
+  // Cells are 5x8 pixels with one pixel gap, plus a border of one cell gap.
+  const int pixel_width = (width_ * 6 + 1) * scale;
+  const int pixel_height = (2 * 9 + 1) * scale;
+  FILE *out = fopen(filename, "wb");
+  if (out == NULL) {
+    perror(filename);
+    return false;
+  }
+  fprintf(out, "P6\n%d %d\n255\n", pixel_width, pixel_height);
+  static const uint8_t kOn[3] = { 0x10, 0x20, 0x60 };
+  static const uint8_t kOff[3] = { 0x80, 0xc0, 0xff };
+  static const uint8_t kBackground[3] = { 0x70, 0xb0, 0xf0 };
+  for (int y = 0; y < pixel_height; ++y) {
+    const int py = y / scale;
+    const int row = (py - 1) / 9;
+    const int cell_y = (py - 1) % 9;
+    for (int x = 0; x < pixel_width; ++x) {
+      const int px = x / scale;
+      const int column = (px - 1) / 6;
+      const int cell_x = (px - 1) % 6;
+      const uint8_t *color = kBackground;
+      if (px > 0 && py > 0 && cell_x < 5 && cell_y < 8 && row < 2
+          && column < width_) {
+        color = kOff;
+        if (display_on_) {
+          const uint8_t *bitmap = CellBitmap(ddram_[DDRAMIndex(row, column)]);
+          if (bitmap && (bitmap[cell_y] & (0x10 >> cell_x)))
+            color = kOn;
+        }
+      }
+      fwrite(color, 3, 1, out);
+    }
+  }
+  return fclose(out) == 0;
+}
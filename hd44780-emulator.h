@@ -0,0 +1,94 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_HD44780_EMULATOR_
+#define UPNP_DISPLAY_HD44780_EMULATOR_
+
+#include <stdint.h>
+
+#include <string>
+
+#include "gpio.h"
+#include "hd44780-rom.h"
+#include "lcd-display.h"
+
+// A two-line HD44780 controller in software, connected like LCDDisplay
+// expects it. Set it as GPIO backend to run the LCD code without hardware:
+// it decodes the nibbles on the falling edge of the enable line and keeps
+// DDRAM, CGRAM, address counter, entry mode and display control like the
+// real controller. Bytes that arrive while the controller would still be
+// busy with the previous instruction are executed, but counted as timing
+// violations.
+class HD44780Emulator : public GPIOBackend {
+public:
+  HD44780Emulator(int width, HD44780Rom rom = HD44780_ROM_ASCII,
+                  const LCDPinMap &pins = kDefaultLCDPins);
+
+  uint32_t InitOutputs(uint32_t outputs) override { return outputs; }
+  uint32_t InitInputs(uint32_t) override { return 0; }
+  void SetAndClearBits(uint32_t set, uint32_t clear) override;
+  uint32_t GetBits(uint32_t mask) override { return pins_state_ & mask; }
+
+  // The visible screen, one line per row, in UTF-8. Custom characters are
+  // shown as the font character with the same bitmap, or '?'. A display
+  // that is switched off shows spaces.
+  std::string RenderText() const;
+
+  // Write the visible screen as binary PPM image, each pixel "scale" wide.
+  bool WritePPM(const char *filename, int scale) const;
+
+  // Statistics since construction or ResetCounters().
+  int64_t data_bytes() const { return data_bytes_; }
+  int64_t commands() const { return commands_; }
+  int64_t timing_violations() const { return timing_violations_; }
+  int64_t short_enable_pulses() const { return short_enable_pulses_; }
+  void ResetCounters();
+
+private:
+  void ReceiveNibble(uint8_t nibble, bool is_data, int64_t now);
+  void Execute(uint8_t byte, bool is_data, int64_t now);
+  void ExecuteCommand(uint8_t cmd);
+  void WriteData(uint8_t byte);
+  void MoveAddressCounter(bool increment);
+  int DDRAMIndex(int row, int column) const;   // visible cell -> DDRAM.
+  const uint8_t *CellBitmap(uint8_t code) const;
+
+  const int width_;
+  const HD44780Rom rom_;
+  uint32_t rs_bit_, e_bit_, data_bits_[4];
+  uint32_t pins_state_;
+  int64_t enable_rise_;
+
+  // Controller state.
+  bool four_bit_mode_;
+  bool have_high_nibble_;    // 4-bit: first half of a byte received.
+  uint8_t high_nibble_;
+  int64_t busy_until_;
+  uint8_t ddram_[80];        // Two lines of 40; line 2 at address 0x40.
+  uint8_t cgram_[64];
+  uint8_t address_counter_;
+  bool address_is_cgram_;
+  bool increment_;
+  bool shift_display_;
+  bool display_on_;
+  int display_shift_;
+
+  int64_t data_bytes_;
+  int64_t commands_;
+  int64_t timing_violations_;
+  int64_t short_enable_pulses_;
+};
+
+#endif  // UPNP_DISPLAY_HD44780_EMULATOR_
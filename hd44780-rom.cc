@@ -0,0 +1,217 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "hd44780-rom.h"
+
+#include <string.h>
+#include <strings.h>
+
+#include <algorithm>
+
+namespace {
+struct RomEntry {
+  uint16_t codepoint;
+  uint8_t code;
+};
+
+bool operator<(const RomEntry &entry, uint32_t codepoint) {
+  return entry.codepoint < codepoint;
+}
+}  // namespace
+
+// Characters outside ASCII, sorted by codepoint. Only glyphs that actually
+// look like the Unicode character are listed; approximations are left to
+// the custom characters.
+
+// HD44780UA00. 0x5C is the Yen sign and 0x7E/0x7F are arrows instead of
+// backslash and tilde; 0xA1..0xDF are half-width katakana.
+static const RomEntry kRomA00[] = {
+  { 0x00A2, 0xEC },  // ¢
+  { 0x00A5, 0x5C },  // ¥
+  { 0x00B0, 0xDF },  // ° (semi-voiced mark, universally used as degree)
+  { 0x00B5, 0xE4 },  // µ
+  { 0x00E4, 0xE1 },  // ä
+  { 0x00F1, 0xEE },  // ñ
+  { 0x00F6, 0xEF },  // ö
+  { 0x00F7, 0xFD },  // ÷
+  { 0x00FC, 0xF5 },  // ü
+  { 0x03A3, 0xF6 },  // Σ
+  { 0x03A9, 0xF4 },  // Ω
+  { 0x03B1, 0xE0 },  // α
+  { 0x03B2, 0xE2 },  // β
+  { 0x03B5, 0xE3 },  // ε
+  { 0x03B8, 0xF2 },  // θ
+  { 0x03BC, 0xE4 },  // μ
+  { 0x03C0, 0xF7 },  // π
+  { 0x03C1, 0xE6 },  // ρ
+  { 0x03C3, 0xE5 },  // σ
+  { 0x2126, 0xF4 },  // Ω (ohm sign)
+  { 0x2190, 0x7F },  // ←
+  { 0x2192, 0x7E },  // →
+  { 0x221A, 0xE8 },  // √
+  { 0x221E, 0xF3 },  // ∞
+  { 0x2588, 0xFF },  // █
+  { 0x3001, 0xA4 },  // 、
+  { 0x3002, 0xA1 },  // 。
+  { 0x300C, 0xA2 },  // 「
+  { 0x300D, 0xA3 },  // 」
+  { 0x309B, 0xDE },  // ゛
+  { 0x309C, 0xDF },  // ゜
+  // Full-width katakana that exist in the ROM in their half-width form.
+  { 0x30A1, 0xA7 }, { 0x30A2, 0xB1 }, { 0x30A3, 0xA8 }, { 0x30A4, 0xB2 },
+  { 0x30A5, 0xA9 }, { 0x30A6, 0xB3 }, { 0x30A7, 0xAA }, { 0x30A8, 0xB4 },
+  { 0x30A9, 0xAB }, { 0x30AA, 0xB5 }, { 0x30AB, 0xB6 }, { 0x30AD, 0xB7 },
+  { 0x30AF, 0xB8 }, { 0x30B1, 0xB9 }, { 0x30B3, 0xBA }, { 0x30B5, 0xBB },
+  { 0x30B7, 0xBC }, { 0x30B9, 0xBD }, { 0x30BB, 0xBE }, { 0x30BD, 0xBF },
+  { 0x30BF, 0xC0 }, { 0x30C1, 0xC1 }, { 0x30C3, 0xAF }, { 0x30C4, 0xC2 },
+  { 0x30C6, 0xC3 }, { 0x30C8, 0xC4 }, { 0x30CA, 0xC5 }, { 0x30CB, 0xC6 },
+  { 0x30CC, 0xC7 }, { 0x30CD, 0xC8 }, { 0x30CE, 0xC9 }, { 0x30CF, 0xCA },
+  { 0x30D2, 0xCB }, { 0x30D5, 0xCC }, { 0x30D8, 0xCD }, { 0x30DB, 0xCE },
+  { 0x30DE, 0xCF }, { 0x30DF, 0xD0 }, { 0x30E0, 0xD1 }, { 0x30E1, 0xD2 },
+  { 0x30E2, 0xD3 }, { 0x30E3, 0xAC }, { 0x30E4, 0xD4 }, { 0x30E5, 0xAD },
+  { 0x30E6, 0xD5 }, { 0x30E7, 0xAE }, { 0x30E8, 0xD6 }, { 0x30E9, 0xD7 },
+  { 0x30EA, 0xD8 }, { 0x30EB, 0xD9 }, { 0x30EC, 0xDA }, { 0x30ED, 0xDB },
+  { 0x30EF, 0xDC }, { 0x30F2, 0xA6 }, { 0x30F3, 0xDD }, { 0x30FB, 0xA5 },
+  { 0x30FC, 0xB0 },
+  { 0x4E07, 0xFB },  // 万
+  { 0x5186, 0xFC },  // 円
+  { 0x5343, 0xFA },  // 千
+};
+
+// HD44780UA02. Full ASCII; 0xC0..0xFF are identical to Latin-1.
+static const RomEntry kRomA02[] = {
+  { 0x00A1, 0xA1 }, { 0x00A2, 0xA2 }, { 0x00A3, 0xA3 }, { 0x00A4, 0xA4 },
+  { 0x00A5, 0xA5 }, { 0x00A6, 0xA6 }, { 0x00A7, 0xA7 }, { 0x00A9, 0xA9 },
+  { 0x00AA, 0xAA }, { 0x00AB, 0xAB }, { 0x00AE, 0xAE }, { 0x00B0, 0xB0 },
+  { 0x00B1, 0xB1 }, { 0x00B2, 0xB2 }, { 0x00B3, 0xB3 }, { 0x00B5, 0xB5 },
+  { 0x00B6, 0xB6 }, { 0x00B7, 0xB7 }, { 0x00B9, 0xB9 }, { 0x00BA, 0xBA },
+  { 0x00BB, 0xBB }, { 0x00BC, 0xBC }, { 0x00BD, 0xBD }, { 0x00BE, 0xBE },
+  { 0x00BF, 0xBF },
+  // 0x00C0..0x00FF handled as range.
+  { 0x0393, 0x92 },  // Γ
+  { 0x0398, 0x99 },  // Θ
+  { 0x03A3, 0x94 },  // Σ
+  { 0x03A9, 0x9A },  // Ω
+  { 0x03B1, 0x90 },  // α
+  { 0x03B4, 0x9B },  // δ
+  { 0x03B5, 0x9E },  // ε
+  { 0x03C0, 0x93 },  // π
+  { 0x03C3, 0x95 },  // σ
+  { 0x03C4, 0x97 },  // τ
+  { 0x0411, 0x80 },  // Б
+  { 0x0414, 0x81 },  // Д
+  { 0x0416, 0x82 },  // Ж
+  { 0x0417, 0x83 },  // З
+  { 0x0418, 0x84 },  // И
+  { 0x0419, 0x85 },  // Й
+  { 0x041B, 0x86 },  // Л
+  { 0x041F, 0x87 },  // П
+  { 0x0423, 0x88 },  // У
+  { 0x0426, 0x89 },  // Ц
+  { 0x0427, 0x8A },  // Ч
+  { 0x0428, 0x8B },  // Ш
+  { 0x0429, 0x8C },  // Щ
+  { 0x042A, 0x8D },  // Ъ
+  { 0x042B, 0x8E },  // Ы
+  { 0x042D, 0x8F },  // Э
+  { 0x201C, 0x12 },  // “
+  { 0x201D, 0x13 },  // ”
+  { 0x2126, 0x9A },  // Ω (ohm sign)
+  { 0x2190, 0x1B },  // ←
+  { 0x2191, 0x18 },  // ↑
+  { 0x2192, 0x1A },  // →
+  { 0x2193, 0x19 },  // ↓
+  { 0x21B5, 0x17 },  // ↵
+  { 0x221E, 0x9C },  // ∞
+  { 0x2229, 0x9F },  // ∩
+  { 0x2264, 0x1C },  // ≤
+  { 0x2265, 0x1D },  // ≥
+  { 0x2302, 0x7F },  // ⌂
+  { 0x25B2, 0x1E },  // ▲
+  { 0x25B6, 0x10 },  // ▶
+  { 0x25BC, 0x1F },  // ▼
+  { 0x25C0, 0x11 },  // ◀
+  { 0x25CF, 0x16 },  // ●
+  { 0x2665, 0x9D },  // ♥
+  { 0x266A, 0x91 },  // ♪
+  { 0x266C, 0x96 },  // ♬
+};
+
+template <size_t N>
+static int LookupRomTable(const RomEntry (&table)[N], uint32_t codepoint) {
+  const RomEntry *found = std::lower_bound(table, table + N, codepoint);
+  if (found == table + N || found->codepoint != codepoint) return -1;
+  return found->code;
+}
+
+template <size_t N>
+static uint32_t ReverseLookupRomTable(const RomEntry (&table)[N],
+                                      uint8_t code) {
+  for (const RomEntry &entry : table) {
+    if (entry.code == code) return entry.codepoint;
+  }
+  return 0;
+}
+
+bool ParseHD44780Rom(const char *name, HD44780Rom *rom) {
+  if (strcasecmp(name, "ascii") == 0) *rom = HD44780_ROM_ASCII;
+  else if (strcasecmp(name, "a00") == 0) *rom = HD44780_ROM_A00;
+  else if (strcasecmp(name, "a02") == 0) *rom = HD44780_ROM_A02;
+  else return false;
+  return true;
+}
+
+int HD44780RomCodeFor(HD44780Rom rom, uint32_t codepoint) {
+  switch (rom) {
+  case HD44780_ROM_ASCII:
+    return codepoint < 0x80 ? (int) codepoint : -1;
+
+  case HD44780_ROM_A00:
+    if (codepoint >= 0x20 && codepoint < 0x7E && codepoint != '\\')
+      return codepoint;
+    if (codepoint >= 0xFF61 && codepoint <= 0xFF9F)  // half-width katakana
+      return codepoint - 0xFF61 + 0xA1;
+    return LookupRomTable(kRomA00, codepoint);
+
+  case HD44780_ROM_A02:
+    if (codepoint >= 0x20 && codepoint < 0x7F)
+      return codepoint;
+    if (codepoint >= 0xC0 && codepoint <= 0xFF)
+      return codepoint;
+    return LookupRomTable(kRomA02, codepoint);
+  }
+  return -1;
+}
+
+uint32_t HD44780RomCodepointAt(HD44780Rom rom, uint8_t code) {
+  switch (rom) {
+  case HD44780_ROM_ASCII:
+    return (code >= 0x20 && code < 0x7F) ? code : 0;
+
+  case HD44780_ROM_A00:
+    if (code >= 0x20 && code < 0x7E && code != '\\')
+      return code;
+    if (code >= 0xA1 && code <= 0xDF)
+      return code - 0xA1 + 0xFF61;
+    return ReverseLookupRomTable(kRomA00, code);
+
+  case HD44780_ROM_A02:
+    if ((code >= 0x20 && code < 0x7F) || code >= 0xC0)
+      return code;
+    return ReverseLookupRomTable(kRomA02, code);
+  }
+  return 0;
+}
@@ -0,0 +1,40 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_HD44780_ROM_
+#define UPNP_DISPLAY_HD44780_ROM_
+
+#include <stdint.h>
+
+// Character ROM variant of the HD44780 compatible controller. The code is
+// usually printed on the controller chip (HD44780UA00, HD44780UA02).
+enum HD44780Rom {
+  HD44780_ROM_ASCII,  // Only rely on 7-bit ASCII; works on any display.
+  HD44780_ROM_A00,    // Japanese standard: ASCII (¥ and arrows), katakana.
+  HD44780_ROM_A02,    // European: ASCII, Latin-1, Cyrillic, Greek, symbols.
+};
+
+// Parse "ascii", "a00" or "a02". Returns 'false' for unknown names.
+bool ParseHD44780Rom(const char *name, HD44780Rom *rom);
+
+// Returns the character code under which the ROM contains the given
+// codepoint, or -1 if it has to be defined as custom character.
+int HD44780RomCodeFor(HD44780Rom rom, uint32_t codepoint);
+
+// The reverse: codepoint shown for the character code, or 0 if unknown.
+// Character codes 0x00..0x0F are the custom characters.
+uint32_t HD44780RomCodepointAt(HD44780Rom rom, uint8_t code);
+
+#endif  // UPNP_DISPLAY_HD44780_ROM_
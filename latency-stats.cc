@@ -0,0 +1,103 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "latency-stats.h"
+
+#include <string.h>
+
+LatencyHistogram::LatencyHistogram()
+  : count_(0), min_(0), max_(0), sum_(0) {
+  memset(counts_, 0, sizeof(counts_));
+}
+
+int LatencyHistogram::BucketFor(int64_t value) {
+  if (value < 2 * kSubBuckets) return value;
+  const int magnitude = 63 - __builtin_clzll(value);
+  const int sub = (value >> (magnitude - kSubBucketBits)) - kSubBuckets;
+  return 2 * kSubBuckets
+    + (magnitude - kSubBucketBits - 1) * kSubBuckets + sub;
+}
+
+int64_t LatencyHistogram::BucketUpperEnd(int bucket) {
+  if (bucket < 2 * kSubBuckets) return bucket;
+  const int magnitude = (bucket - 2 * kSubBuckets) / kSubBuckets
+    + kSubBucketBits + 1;
+  const int sub = (bucket - 2 * kSubBuckets) % kSubBuckets;
+  const int shift = magnitude - kSubBucketBits;
+  // Unsigned: the upper end of the last bucket is 2^63 - 1.
+  return (int64_t)(((uint64_t)(kSubBuckets + sub + 1) << shift) - 1);
+}
+
+void LatencyHistogram::Record(int64_t nanos) {
+  if (nanos < 0) nanos = 0;     // Clocks of different threads; can't be.
+  if (count_ == 0 || nanos < min_) min_ = nanos;
+  if (count_ == 0 || nanos > max_) max_ = nanos;
+  ++counts_[BucketFor(nanos)];
+  ++count_;
+  sum_ += nanos;
+}
+
+int64_t LatencyHistogram::Percentile(double fraction) const {
+  if (count_ == 0) return 0;
+  const int64_t wanted = (int64_t)(fraction * count_ + 0.5);
+  int64_t seen = 0;
+  for (int b = 0; b < kBuckets; ++b) {
+    seen += counts_[b];
+    if (seen >= wanted && seen > 0) {
+      return BucketUpperEnd(b) < max_ ? BucketUpperEnd(b) : max_;
+    }
+  }
+  return max_;
+}
+
+void LatencyHistogram::WriteJSON(FILE *out) const {
+  fprintf(out, "{\"count\": %lld, \"min_ns\": %lld, \"max_ns\": %lld, "
+          "\"mean_ns\": %.0f, \"p50_ns\": %lld, \"p90_ns\": %lld, "
+          "\"p99_ns\": %lld, \"buckets\": [",
+          (long long)count_, (long long)min_, (long long)max_,
+          count_ ? sum_ / count_ : 0.0,
+          (long long)Percentile(0.5), (long long)Percentile(0.9),
+          (long long)Percentile(0.99));
+  const char *separator = "";
+  for (int b = 0; b < kBuckets; ++b) {
+    if (counts_[b] == 0) continue;
+    fprintf(out, "%s[%lld, %lld]", separator,
+            (long long)BucketUpperEnd(b), (long long)counts_[b]);
+    separator = ", ";
+  }
+  fprintf(out, "]}");
+}
+
+void PipelineLatency::Record(const EventTimestamps &event,
+                             int64_t composed, int64_t shown) {
+  stage_[PARSE].Record(event.parsed - event.received);
+  stage_[PUBLISH].Record(event.published - event.parsed);
+  stage_[COMPOSE].Record(composed - event.published);
+  stage_[OUTPUT].Record(shown - composed);
+  stage_[TOTAL].Record(shown - event.received);
+}
+
+void PipelineLatency::WriteJSON(FILE *out) const {
+  static const char *const kNames[kStages] = {
+    "parse", "publish", "compose", "output", "total"
+  };
+  fprintf(out, "{");
+  for (int s = 0; s < kStages; ++s) {
+    fprintf(out, "%s\n  \"%s\": ", s ? "," : "", kNames[s]);
+    stage_[s].WriteJSON(out);
+  }
+  fprintf(out, "\n}\n");
+}
@@ -0,0 +1,83 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_LATENCY_STATS_H
+#define UPNP_DISPLAY_LATENCY_STATS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Histogram of durations in nanoseconds with logarithmic buckets, each
+// power of two split into 8 linear sub-buckets (as HdrHistogram does), so
+// values are kept with 12.5% precision over the whole range in a fixed
+// amount of memory. Not thread safe.
+class LatencyHistogram {
+public:
+  LatencyHistogram();
+
+  void Record(int64_t nanos);
+
+  int64_t count() const { return count_; }
+
+  // Value below which the given fraction (0..1) of the recorded values is,
+  // as upper end of its bucket. 0 if there are none.
+  int64_t Percentile(double fraction) const;
+
+  // As JSON object with count, min, max, mean and percentiles, and the
+  // non-empty buckets as [upper end, count] pairs.
+  void WriteJSON(FILE *out) const;
+
+private:
+  static const int kSubBucketBits = 3;
+  static const int kSubBuckets = 1 << kSubBucketBits;
+  // Values below 2 * kSubBuckets have their own bucket, then kSubBuckets
+  // per power of two up to 2^63.
+  static const int kBuckets = 2 * kSubBuckets
+    + (63 - kSubBucketBits - 1) * kSubBuckets;
+
+  static int BucketFor(int64_t value);
+  static int64_t BucketUpperEnd(int bucket);
+
+  int64_t counts_[kBuckets];
+  int64_t count_;
+  int64_t min_;
+  int64_t max_;
+  double sum_;
+};
+
+// CLOCK_MONOTONIC times at which a change reported by the renderer made its
+// way through the stages until it is shown.
+struct EventTimestamps {
+  int64_t received;    // UPnP event arrived.
+  int64_t parsed;      // XML decoded.
+  int64_t published;   // New variables visible to the display.
+};
+
+// Latency per stage from renderer event to the display: until parsed,
+// until published, until picked up by a frame and composed, until written
+// out to the display; and all of it.
+class PipelineLatency {
+public:
+  void Record(const EventTimestamps &event, int64_t composed, int64_t shown);
+
+  // Writes all stages as one JSON object.
+  void WriteJSON(FILE *out) const;
+
+private:
+  enum Stage { PARSE, PUBLISH, COMPOSE, OUTPUT, TOTAL, kStages };
+  LatencyHistogram stage_[kStages];
+};
+
+#endif  // UPNP_DISPLAY_LATENCY_STATS_H
@@ -20,110 +20,201 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include "gpio.h"
 #include "font-data.h"
+#include "metrics.h"
+#include "trace-events.h"
+#include "text-fold.h"
 #include "utf8.h"
 
 // Defined in the VFD library (vfd_interface.cc)
 extern GPIO gpio;
 
-// According to datasheet, basic ops are typically ~37usec
+// According to the datasheet, basic ops take 37usec and clear and return home
+// 1.52msec, but that is at the typical 270kHz of the controller's oscillator.
+// Modules at the low end of its range (190kHz) take 53usec and 2.16msec, so
+// wait a bit longer than that. Instead of sleeping after each byte, we
+// remember when the controller is ready again and only wait for what is left
+// of that.
+#define LCD_DISPLAY_OPERATION_NSEC 60000
+#define LCD_DISPLAY_CLEAR_HOME_NSEC 2200000
+
+// Wait after nibbles written during initialization, before the controller
+// is in 4 bit mode.
 #define LCD_DISPLAY_OPERATION_WAIT_USEC 50
 
 // Time between sending two nibbles.
 #define LCD_ENABLE_PULSE_TIME_NSEC 400
 
-// The following GPIO mapping allows to have all wiring in one row to
+// The default GPIO mapping allows to have all wiring in one row to
 // accomodate simpling wiring.
-#define LCD_E (1<<18)
-#define LCD_RS (1<<14)
-
-#define LCD_D0_BIT (1<<23)
-#define LCD_D1_BIT (1<<24)
-#define LCD_D2_BIT (1<<25)
-#define LCD_D3_BIT (1<<8)
-
-static void WriteNibble(bool is_command, uint8_t b) {
-  uint32_t out = is_command ? 0 : LCD_RS;
-  out |= (b & 0x1) ? LCD_D0_BIT : 0;
-  out |= (b & 0x2) ? LCD_D1_BIT : 0;
-  out |= (b & 0x4) ? LCD_D2_BIT : 0;
-  out |= (b & 0x8) ? LCD_D3_BIT : 0;
-  out |= LCD_E;
-  gpio.Write(out);
+const LCDPinMap kDefaultLCDPins = { 14, 18, { 23, 24, 25, 8 } };
+
+bool ParseLCDPinMap(const char *spec, LCDPinMap *pins) {
+  int values[6];
+  int count = 0;
+  const char *pos = spec;
+  while (count < 6) {
+    char *end;
+    const long value = strtol(pos, &end, 10);
+    if (end == pos || value < 0 || value > 31) break;
+    values[count++] = value;
+    if (*end != ',') { pos = end; break; }
+    pos = end + 1;
+  }
+  if (count != 6 || *pos != '\0') {
+    fprintf(stderr, "LCD pins: expected six GPIO numbers rs,e,d4,d5,d6,d7; "
+            "got '%s'\n", spec);
+    return false;
+  }
+  uint32_t used = 0;
+  for (int i = 0; i < 6; ++i) {
+    const uint32_t bit = 1u << values[i];
+    if ((bit & GPIO::kValidBits) == 0) {
+      fprintf(stderr, "LCD pins: GPIO %d is not available.\n", values[i]);
+      return false;
+    }
+    if (used & bit) {
+      fprintf(stderr, "LCD pins: GPIO %d used twice.\n", values[i]);
+      return false;
+    }
+    used |= bit;
+  }
+  pins->rs = values[0];
+  pins->e = values[1];
+  for (int i = 0; i < 4; ++i) pins->data[i] = values[2 + i];
+  return true;
+}
+
+// Output for each nibble is precomputed, so sending one is a table lookup
+// and the set and clear register writes.
+void LCDDisplay::WriteNibble(bool is_command, uint8_t b) {
+  const int rs = is_command ? 0 : 1;
+  gpio.SetAndClearBits(nibble_set_bits_[rs][b], nibble_clear_bits_[rs][b]);
   // We don't want to do a sleep because we don't want to risk a context
   // switch - Linux might come back way to late (the LCD display times out
   // between two Nibble-writes and ends up in a broken state).
   gpio.busy_nano_sleep(LCD_ENABLE_PULSE_TIME_NSEC);
-  gpio.ClearBits(LCD_E);
+  gpio.ClearBits(enable_bit_);
 }
 
-// Write data to display. Differentiates if this is a command byte or data
-// byte.
-static void WriteByte(bool is_command, uint8_t b) {
-  WriteNibble(is_command, (b >> 4) & 0xf);
-  WriteNibble(is_command, b & 0xf);
-  usleep(LCD_DISPLAY_OPERATION_WAIT_USEC);
+static int64_t MonotonicNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
 }
 
-static int compare_glyph(const void *key, const void *array_member) {
-  return *((const uint32_t*)key) - ((const Font5x8*)array_member)->codepoint;
-}
+static const MetricCounter lcd_bytes(
+  "upnp_display_lcd_bytes_total", "Bytes sent to the LCD.");
+static const MetricCounter lcd_glyph_uploads(
+  "upnp_display_lcd_glyph_uploads_total", "Glyphs stored in the LCD CGRAM.");
+static const MetricCounter lcd_busy_wait(
+  "upnp_display_lcd_busy_wait_seconds_total",
+  "Time spent spinning until the LCD was ready for the next byte.", "", 1e-9);
 
-// Find font for codepoint from our sorted compiled-in table.
-static const Font5x8 *findGlyph(const uint32_t codepoint) {
-  return (const Font5x8*)bsearch(&codepoint, kFontData, kFontDataSize,
-                                 sizeof(Font5x8), compare_glyph);
+// Write data to display. Differentiates if this is a command byte or data
+// byte. Consecutive bytes go out back to back, only spinning for the part of
+// the execution time of the previous byte that hasn't passed yet.
+void LCDDisplay::WriteByte(bool is_command, uint8_t b) {
+  int64_t now = MonotonicNanos();
+  if (now < ready_at_nanos_) {
+    const int64_t spin_start = now;
+    while ((now = MonotonicNanos()) < ready_at_nanos_) {
+      // Too short to sleep; a context switch would take much longer.
+    }
+    lcd_busy_wait.Add(now - spin_start);
+  }
+  WriteNibble(is_command, (b >> 4) & 0xf);
+  WriteNibble(is_command, b & 0xf);
+  ++bytes_written_;
+  lcd_bytes.Add();
+  const bool is_clear_or_home = is_command && (b == 0x01 || (b & 0xfe) == 0x02);
+  ready_at_nanos_ = MonotonicNanos() + (is_clear_or_home
+                                        ? LCD_DISPLAY_CLEAR_HOME_NSEC
+                                        : LCD_DISPLAY_OPERATION_NSEC);
 }
 
-static void LCDStoreGlyph(uint8_t num, const Font5x8 *glyph) {
+void LCDDisplay::StoreGlyph(uint8_t num, const uint8_t *glyph) {
   assert(glyph);
   assert(num < 8);
+  TraceSpan span("LCD StoreGlyph");
+  lcd_glyph_uploads.Add();
   WriteByte(true, 0x40 + (num << 3));
   for (int i = 0; i < 8; ++i) {
-    WriteByte(false, glyph->bitmap[i] >> 3);  // font is left aligned in data.
+    WriteByte(false, glyph[i]);  // font data is already in LCD 5 bit layout.
   }
 }
 
-uint8_t LCDDisplay::FindCharacterFor(Codepoint cp, bool *register_new) {
-  *register_new = false;
-  if (cp < 0x80) return cp;   // Everything regular ASCII is used as-is.
-
-  // Conceptually, we need a map codepoint -> char; but this is a really small
-  // list, so this is faster to iterate than having a bulky map.
-  for (int i = 0; i < 8; ++i) {
-    if (special_characters_[i] == cp) return i;
+uint8_t LCDDisplay::FindCharacterFor(Codepoint cp) const {
+  const int rom_code = HD44780RomCodeFor(rom_, cp);
+  if (rom_code >= 0) return rom_code;   // Built into the display.
+  const int slot = cgram_.SlotFor(cp);
+  if (slot >= 0) return slot;
+  // No glyph, or too many different on screen. Maybe a simpler character,
+  // such as the one without accent, is in the ROM.
+  std::u32string fold;
+  if (FoldCodepoint(cp, &fold) && fold.size() == 1) {
+    const int fold_code = HD44780RomCodeFor(rom_, fold[0]);
+    if (fold_code >= 0) return fold_code;
   }
+  return '?';
+}
 
-  // Ok, not there, just use the next free. We're doing a very simple
-  // round-robin approach here, potentially re-using characters that are
-  // still in use. For now, we just assume that the active number of different
-  // characters is small enough to fit.
-  const Font5x8 *glyph = findGlyph(cp);
-  if (glyph == NULL) return '?';  // unicode without glyph for codepoint.
-
-  const uint8_t new_char = (next_free_special_++ % 8);
-  LCDStoreGlyph(new_char, glyph);
-  *register_new = true;
-  special_characters_[new_char] = cp;
-  return new_char;
+GlyphCost LCDDisplay::glyph_cost(uint32_t codepoint) const {
+  if (HD44780RomCodeFor(rom_, codepoint) >= 0) return GLYPH_NATIVE;
+  if (findGlyph(codepoint) != NULL) return GLYPH_CUSTOM;
+  return GLYPH_UNAVAILABLE;
 }
 
-LCDDisplay::LCDDisplay(const std::string& match_name, int width) : Printer(match_name), width_(width), next_free_special_(0) {
-  memset(special_characters_, 0, sizeof(special_characters_));
+LCDDisplay::LCDDisplay(const std::string& match_name, int width,
+                       HD44780Rom rom, const LCDPinMap &pins)
+  : Printer(match_name), width_(width), rom_(rom), initialized_(false),
+    display_is_on_(false), in_frame_(false), hardware_scroll_(false),
+    display_shift_(0), smooth_scroll_(false), smooth_row_(-1),
+    smooth_position_(0), smooth_phase_(0), sub_frame_write_nanos_(0),
+    bytes_written_(0), ready_at_nanos_(0),
+    glyph_uploads_last_frame_(0), glyph_uploads_total_(0),
+    last_frame_write_nanos_(0) {
+  pending_shift_[0] = pending_shift_[1] = 0;
+  for (int row = 0; row < 2; ++row) {
+    std::fill(ddram_[row], ddram_[row] + kRowLength, -1);
+  }
+  enable_bit_ = 1u << pins.e;
+  uint32_t data_bits[4];
+  all_bits_ = enable_bit_ | (1u << pins.rs);
+  for (int i = 0; i < 4; ++i) {
+    data_bits[i] = 1u << pins.data[i];
+    all_bits_ |= data_bits[i];
+  }
+  for (int rs = 0; rs < 2; ++rs) {
+    for (int nibble = 0; nibble < 16; ++nibble) {
+      uint32_t out = enable_bit_ | (rs ? (1u << pins.rs) : 0);
+      for (int i = 0; i < 4; ++i) {
+        if (nibble & (1 << i)) out |= data_bits[i];
+      }
+      nibble_set_bits_[rs][nibble] = out;
+      nibble_clear_bits_[rs][nibble] = all_bits_ & ~out;
+    }
+  }
 }
 
 bool LCDDisplay::Init() {
   if (!gpio.Init())
     return false;
 
-  gpio.InitOutputs(LCD_E | LCD_RS |
-                   LCD_D0_BIT | LCD_D1_BIT | LCD_D2_BIT | LCD_D3_BIT);
-  gpio.Write(0);
+  if (gpio.InitOutputs(all_bits_) != all_bits_) {
+    fprintf(stderr, "LCD: not all pins are available as GPIO outputs.\n");
+    return false;
+  }
+  gpio.ClearBits(all_bits_);
   usleep(100000);
 
   // -- This seems to be a reliable initialization sequence:
@@ -143,8 +234,11 @@ bool LCDDisplay::Init() {
   WriteByte(true, 0x06);  // Entry mode: increment, no shift
   WriteByte(true, 0x0c);  // Display control: on, no cursor
 
-  WriteByte(true, 0x01);  // Clear display
-  usleep(2000);           // ... which takes up to 1.6ms
+  WriteByte(true, 0x01);  // Clear display; next write waits for it.
+  for (int row = 0; row < 2; ++row) {
+    std::fill(ddram_[row], ddram_[row] + kRowLength, ' ');
+  }
+  display_shift_ = 0;
 
   initialized_ = true;
   display_is_on_ = true;
@@ -154,41 +248,285 @@ bool LCDDisplay::Init() {
 
 void LCDDisplay::SaveScreen() {
   if (!display_is_on_) return;
-  Print(0, "");
-  Print(1, "");
+  Print(0, U"");
+  Print(1, U"");
+  Flush();
   WriteByte(true, 0x08);
   display_is_on_ = false;
 }
 
+void LCDDisplay::BeginFrame() {
+  in_frame_ = true;
+}
+
+void LCDDisplay::EndFrame() {
+  in_frame_ = false;
+  Flush();
+}
+
 void LCDDisplay::Print(int row, const std::string &text) {
+  Print(row, utf8_decode(text));
+}
+
+void LCDDisplay::Print(int row, const std::u32string &text) {
+  assert(initialized_);  // call Init() first.
+  assert(row < 2);       // uh, out of range.
+  TraceSpan span("LCD Print");
+
+  pending_line_[row] = text.substr(0, width_);
+  pending_ring_[row].clear();
+  if (smooth_row_ == row) smooth_row_ = -1;
+  if (!in_frame_) Flush();
+}
+
+// Display shift commands needed to get from one shift to another.
+static int ShiftDistance(int from, int to, int length) {
+  const int d = (to - from + length) % length;
+  return std::min(d, length - d);
+}
+
+void LCDDisplay::PrintScrolled(int row, const Scroller &scroller) {
   assert(initialized_);  // call Init() first.
   assert(row < 2);       // uh, out of range.
 
-  if (last_line_[row] == text)
+  pending_line_[row] = scroller.GetScrolledContent().substr(0, width_);
+  pending_ring_[row].clear();
+  if (hardware_scroll_ && !smooth_scroll_ && width_ < kRowLength
+      && scroller.scrolling()) {
+    SetPendingRing(row, scroller);
+  }
+  if (smooth_scroll_ && scroller.moves_on_next_tick()) {
+    smooth_row_ = row;
+    smooth_content_ = scroller.scroll_content();
+    smooth_position_ = scroller.position();
+  } else if (smooth_row_ == row) {
+    smooth_row_ = -1;
+  }
+  if (!in_frame_) Flush();
+}
+
+// The row is filled with the scroll content repeated, which stays the same
+// while the title scrolls. A display shift then shows the same as software
+// scrolling, unless the visible part crosses the end of the row; only then
+// there is no ring.
+void LCDDisplay::SetPendingRing(int row, const Scroller &scroller) {
+  const std::u32string &content = scroller.scroll_content();
+  const int length = content.length();
+  if (length == 0 || length > kRowLength) return;
+  std::u32string ring(kRowLength, ' ');
+  for (int i = 0; i < kRowLength; ++i) {
+    ring[i] = content[i % length];
+  }
+  const int position = scroller.position();
+  int best_shift = -1;
+  for (int shift = position; shift < kRowLength; shift += length) {
+    bool same = true;
+    for (int i = 0; i < width_ && same; ++i) {
+      same = (ring[(shift + i) % kRowLength]
+              == content[(position + i) % length]);
+    }
+    if (same && (best_shift < 0
+                 || ShiftDistance(display_shift_, shift, kRowLength)
+                 < ShiftDistance(display_shift_, best_shift, kRowLength))) {
+      best_shift = shift;
+    }
+  }
+  if (best_shift < 0) return;
+  pending_ring_[row].swap(ring);
+  pending_shift_[row] = best_shift;
+}
+
+void LCDDisplay::set_smooth_scroll(bool on) {
+  smooth_scroll_ = on;
+  cgram_.set_usable_slots(CGRAMAllocator::kSlots - (on ? kSmoothSlots : 0));
+}
+
+int LCDDisplay::SubFrames(int frame_millis) const {
+  if (smooth_row_ < 0 || !display_is_on_) return 0;
+  // One per pixel, but keep the display busy for at most a quarter of the
+  // time. The first sub-frame measures what it costs.
+  int result = kCellPixels - 1;
+  if (sub_frame_write_nanos_ > 0) {
+    const int64_t affordable =
+      frame_millis * (int64_t) 1000000 / 4 / sub_frame_write_nanos_;
+    result = std::min((int64_t) result, affordable);
+  }
+  return result;
+}
+
+void LCDDisplay::PrintSubFrame(int step, int sub_frames) {
+  TraceSpan span("LCD PrintSubFrame");
+  if (smooth_row_ < 0 || !display_is_on_) return;
+  const int pixels = step * kCellPixels / (sub_frames + 1);
+  if (pixels <= 0 || pixels >= kCellPixels) return;
+
+  // The edge cells show their character moved out to the left by "pixels",
+  // with the following one moving in. The text in between moves on the
+  // next character step. Glyphs come from our font, also for characters in
+  // the display ROM; those that are not in it stay put.
+  const int64_t write_start = MonotonicNanos();
+  const int length = smooth_content_.length();
+  const int edge_cell[2] = { 0, width_ - 1 };
+  for (int edge = 0; edge < 2; ++edge) {
+    const int pos = smooth_position_ + edge_cell[edge];
+    const uint8_t *from = findGlyph(smooth_content_[pos % length]);
+    const uint8_t *to = findGlyph(smooth_content_[(pos + 1) % length]);
+    if (from == NULL || to == NULL) continue;
+    uint8_t glyph[8];
+    for (int i = 0; i < 8; ++i) {
+      glyph[i] = ((from[i] << pixels) | (to[i] >> (kCellPixels - pixels)))
+        & 0x1f;
+    }
+    // Upload to the slot not currently shown, so the cell never shows a
+    // partially written glyph.
+    const int slot = (CGRAMAllocator::kSlots - kSmoothSlots
+                      + 2 * edge + smooth_phase_);
+    StoreGlyph(slot, glyph);
+    ++glyph_uploads_total_;
+    WriteByte(true, 0x80 + ((smooth_row_ > 0) ? 0x40 : 0) + edge_cell[edge]);
+    WriteByte(false, slot);
+    ddram_[smooth_row_][edge_cell[edge]] = slot;
+  }
+  smooth_phase_ ^= 1;
+  sub_frame_write_nanos_ = MonotonicNanos() - write_start;
+}
+
+// Custom glyphs needed for text, appended to "needed" if not in there yet.
+static void AddCustomGlyphs(const std::u32string &text, HD44780Rom rom,
+                            std::vector<uint32_t> *needed) {
+  for (const uint32_t cp : text) {
+    if (HD44780RomCodeFor(rom, cp) >= 0 || findGlyph(cp) == NULL)
+      continue;
+    if (std::find(needed->begin(), needed->end(), cp) == needed->end())
+      needed->push_back(cp);
+  }
+}
+
+int LCDDisplay::RowWriteCost(int row, const int *wanted) const {
+  int cost = 0;
+  bool in_run = false;
+  for (int i = 0; i < kRowLength; ++i) {
+    const bool write = wanted[i] >= 0 && wanted[i] != ddram_[row][i];
+    if (write) cost += in_run ? 1 : 2;   // first one needs the address.
+    in_run = write;
+  }
+  return cost;
+}
+
+void LCDDisplay::WriteRow(int row, const int *wanted) {
+  bool in_run = false;
+  for (int i = 0; i < kRowLength; ++i) {
+    const bool write = wanted[i] >= 0 && wanted[i] != ddram_[row][i];
+    if (write) {
+      if (!in_run) {
+        // Set address to write to; line 2 starts at 0x40
+        WriteByte(true, 0x80 + ((row > 0) ? 0x40 : 0) + i);
+      }
+      WriteByte(false, wanted[i]);
+      ddram_[row][i] = wanted[i];
+    }
+    in_run = write;
+  }
+}
+
+void LCDDisplay::Flush() {
+  TraceSpan span("LCD Flush");
+  // Plan the CGRAM for everything visible after this frame, on both lines,
+  // so glyphs that are still on screen keep their slot. A row to be scrolled
+  // by the display needs the glyphs of its whole content; if they don't fit,
+  // it is scrolled in software.
+  std::vector<Codepoint> needed;
+  for (int row = 0; row < 2; ++row) {
+    AddCustomGlyphs(pending_line_[row], rom_, &needed);
+  }
+  int ring_row = -1;
+  for (int row = 0; row < 2 && ring_row < 0; ++row) {
+    if (pending_ring_[row].empty()) continue;
+    std::vector<Codepoint> with_ring = needed;
+    AddCustomGlyphs(pending_ring_[row], rom_, &with_ring);
+    if ((int) with_ring.size() <= cgram_.usable_slots()) {
+      needed.swap(with_ring);
+      ring_row = row;
+    }
+  }
+  const uint8_t upload_mask = cgram_.PlanFrame(needed);
+
+  // Wanted display RAM content for software scrolling (unshifted) and
+  // for hardware scrolling: the whole scroll content in its row and the
+  // display shifted to the scroll position. The shift moves the other
+  // row as well, so that is written shifted to stay in place.
+  int software[2][kRowLength];
+  int hardware[2][kRowLength];
+  for (int row = 0; row < 2; ++row) {
+    std::fill(software[row], software[row] + kRowLength, -1);
+    std::fill(hardware[row], hardware[row] + kRowLength, -1);
+    for (int i = 0; i < width_; ++i) {
+      software[row][i] = (i < (int) pending_line_[row].length())
+        ? FindCharacterFor(pending_line_[row][i])
+        : ' ';
+    }
+  }
+  bool use_hardware = false;
+  int shift = 0;
+  if (ring_row >= 0) {
+    const int other_row = 1 - ring_row;
+    shift = pending_shift_[ring_row];
+    for (int i = 0; i < kRowLength; ++i) {
+      hardware[ring_row][i] = FindCharacterFor(pending_ring_[ring_row][i]);
+    }
+    for (int i = 0; i < width_; ++i) {
+      hardware[other_row][(i + shift) % kRowLength] = software[other_row][i];
+    }
+    // Loading the scroll content pays off over the following steps, so
+    // compare what it costs to keep the other row in place with writing
+    // everything in software. If that row has to stay still, it is as
+    // expensive as software scrolling.
+    const int hardware_cost =
+      ShiftDistance(display_shift_, shift, kRowLength)
+      + RowWriteCost(other_row, hardware[other_row]);
+    const int software_cost =
+      ShiftDistance(display_shift_, 0, kRowLength)
+      + RowWriteCost(0, software[0]) + RowWriteCost(1, software[1]);
+    use_hardware = (hardware_cost < software_cost
+                    || (hardware_cost == software_cost && display_shift_ != 0));
+  }
+  const int (*wanted)[kRowLength] = use_hardware ? hardware : software;
+  if (!use_hardware) shift = 0;
+
+  glyph_uploads_last_frame_ = 0;
+  if (upload_mask == 0 && shift == display_shift_
+      && RowWriteCost(0, wanted[0]) == 0 && RowWriteCost(1, wanted[1]) == 0) {
     return;  // nothing to update.
+  }
 
+  const int64_t write_start = MonotonicNanos();
   if (!display_is_on_) {
     WriteByte(true, 0x0c);
     display_is_on_ = true;
   }
 
-  // Set address to write to; line 2 starts at 0x40
-  WriteByte(true, 0x80 + ((row > 0) ? 0x40 : 0));
+  for (int slot = 0; slot < CGRAMAllocator::kSlots; ++slot) {
+    if ((upload_mask & (1 << slot)) == 0) continue;
+    StoreGlyph(slot, findGlyph(cgram_.CodepointAt(slot)));
+    ++glyph_uploads_last_frame_;
+  }
+  glyph_uploads_total_ += glyph_uploads_last_frame_;
 
-  std::string::const_iterator it = text.begin();
-  int screen_pos = 0;
-  for (screen_pos = 0; screen_pos < width_ && it != text.end(); ++screen_pos) {
-    const Codepoint codepoint = utf8_next_codepoint(it);
-    bool ddram_dirty = false;
-    uint8_t char_to_print = FindCharacterFor(codepoint, &ddram_dirty);
-    if (ddram_dirty) {
-      WriteByte(true, 0x80 + ((row > 0) ? 0x40 : 0) + screen_pos);
-    }
-    WriteByte(false, char_to_print);
+  for (int row = 0; row < 2; ++row) {
+    WriteRow(row, wanted[row]);
   }
-  // Fill rest with spaces.
-  for (int i = screen_pos; i < width_; ++i) {
-    WriteByte(false, ' ');
+
+  // Shift the display in the shorter direction; shifting left (0x18) moves
+  // later display RAM columns into view.
+  while (display_shift_ != shift) {
+    const int left = (shift - display_shift_ + kRowLength) % kRowLength;
+    if (left <= kRowLength / 2) {
+      WriteByte(true, 0x18);
+      display_shift_ = (display_shift_ + 1) % kRowLength;
+    } else {
+      WriteByte(true, 0x1c);
+      display_shift_ = (display_shift_ + kRowLength - 1) % kRowLength;
+    }
   }
-  last_line_[row] = text;
-};
+  last_frame_write_nanos_ = MonotonicNanos() - write_start;
+}
@@ -21,36 +21,137 @@
 #include <string>
 #include <stdint.h>
 
+#include "cgram-allocator.h"
+#include "hd44780-rom.h"
 #include "printer.h"
 
+// GPIO numbers the LCD is connected to. It is used in 4 bit mode, so only
+// the upper four data lines D4..D7 of the display are connected.
+struct LCDPinMap {
+  int rs;
+  int e;
+  int data[4];   // D4, D5, D6, D7
+};
+
+// All in the outer row of the Pi header, see README.
+extern const LCDPinMap kDefaultLCDPins;
+
+// Parse comma separated GPIO numbers "rs,e,d4,d5,d6,d7". Pins have to be
+// valid GPIOs and distinct. Prints the problem and returns 'false' if not.
+bool ParseLCDPinMap(const char *spec, LCDPinMap *pins);
+
 // An implementation of an interface to a standard 16x2 LCD display
 // connected to RPi GPIO pins.
 class LCDDisplay : public Printer {
 public:
-  LCDDisplay(const std::string& match_name, int width);
+  // The "rom" tells which characters the display already has built in;
+  // only characters that are not in there use custom character slots.
+  LCDDisplay(const std::string& match_name, int width,
+             HD44780Rom rom = HD44780_ROM_ASCII,
+             const LCDPinMap &pins = kDefaultLCDPins);
 
   // Call this first.
   bool Init();
 
   virtual int width() const { return width_; }
 
+  // Characters in the ROM are native, those in our font need a CGRAM slot.
+  virtual GlyphCost glyph_cost(uint32_t codepoint) const;
+  // Two lines share the eight CGRAM slots.
+  virtual int custom_glyph_budget() const {
+    return cgram_.usable_slots() / 2;
+  }
+
   // Print text in given line.
   virtual void Print(int line, const std::string &text);
+  virtual void Print(int line, const std::u32string &text);
+
+  // With hardware scrolling, titles that fit into the display RAM row are
+  // loaded once and scrolled with the display shift command.
+  void set_hardware_scroll(bool on) { hardware_scroll_ = on; }
+  virtual void PrintScrolled(int line, const Scroller &scroller);
+
+  // With smooth scrolling, the cells at both ends of a scrolling line show
+  // the text moving pixel by pixel between character steps. It uses half
+  // of the CGRAM slots and takes precedence over hardware scrolling.
+  // Call before Init().
+  void set_smooth_scroll(bool on);
+  virtual int SubFrames(int frame_millis) const;
+  virtual void PrintSubFrame(int step, int sub_frames);
+
+  virtual void BeginFrame();
+  virtual void EndFrame();
 
   void SaveScreen();
 
+  // Number of custom glyphs uploaded to CGRAM in the last frame and overall.
+  int glyph_uploads_last_frame() const { return glyph_uploads_last_frame_; }
+  int64_t glyph_uploads_total() const { return glyph_uploads_total_; }
+
+  // Time it took to write the last frame that changed anything, including
+  // glyph uploads. Waiting for the controller is part of it.
+  int64_t last_frame_write_nanos() const { return last_frame_write_nanos_; }
+
+  // Bytes sent to the display overall, commands and data.
+  int64_t bytes_written() const { return bytes_written_; }
+
 private:
   typedef uint32_t Codepoint;
 
-  uint8_t FindCharacterFor(Codepoint cp, bool *register_new);
+  // Characters per row in the display RAM, of which the first width_ are
+  // visible unless the display is shifted.
+  static const int kRowLength = 40;
+
+  // Smooth scrolling: pixels per character cell, and CGRAM slots at the
+  // end reserved for the edge glyphs; two per edge, used alternately.
+  static const int kCellPixels = 5;
+  static const int kSmoothSlots = 4;
+
+  // Write pending lines to the display.
+  void Flush();
+  void SetPendingRing(int row, const Scroller &scroller);
+
+  void WriteNibble(bool is_command, uint8_t b);
+  void WriteByte(bool is_command, uint8_t b);
+  void StoreGlyph(uint8_t num, const uint8_t *glyph);
+
+  // Display code to show codepoint, after the CGRAM has been planned.
+  uint8_t FindCharacterFor(Codepoint cp) const;
+
+  // Number of bytes to write a row of wanted display RAM content; -1 in
+  // "wanted" are cells we don't care about. WriteRow() writes it.
+  int RowWriteCost(int row, const int *wanted) const;
+  void WriteRow(int row, const int *wanted);
 
   const int width_;
+  const HD44780Rom rom_;
+  uint32_t all_bits_;
+  uint32_t enable_bit_;
+  // GPIO bits to set and to clear to output a nibble, by [rs][nibble].
+  uint32_t nibble_set_bits_[2][16];
+  uint32_t nibble_clear_bits_[2][16];
   bool initialized_;
   bool display_is_on_;
-  std::string last_line_[2];
+  bool in_frame_;
+  bool hardware_scroll_;
+  std::u32string pending_line_[2];
+  std::u32string pending_ring_[2];  // hardware scroll content, if any.
+  int pending_shift_[2];            // scroll position in pending_ring_.
+  int ddram_[2][kRowLength];        // display RAM content; -1 if unknown.
+  int display_shift_;
+  bool smooth_scroll_;
+  int smooth_row_;                  // row about to scroll; -1 if none.
+  std::u32string smooth_content_;
+  int smooth_position_;
+  int smooth_phase_;
+  int64_t sub_frame_write_nanos_;
+  int64_t bytes_written_;
+  int64_t ready_at_nanos_;          // CLOCK_MONOTONIC; controller busy before.
 
-  Codepoint special_characters_[8];  // cgram -> codepoint
-  uint8_t next_free_special_;
+  CGRAMAllocator cgram_;
+  int glyph_uploads_last_frame_;
+  int64_t glyph_uploads_total_;
+  int64_t last_frame_write_nanos_;
 };
 
 #endif // UPNP_DISPLAY_LCD_
@@ -0,0 +1,262 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "logging.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <syslog.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+static const int kLogSiteBurst = 5;
+static const int64_t kLogSiteWindowNanos = 60 * 1000000000LL;
+static const int kLineLength = 256;
+static const int kRingEntries = 64;           // Per thread.
+static const useconds_t kWriteIntervalMicros = 50000;
+
+namespace {
+struct Entry {
+  int64_t when;                // CLOCK_REALTIME nanos.
+  LogSeverity severity;
+  char text[kLineLength];
+};
+
+// Written by its thread only, read by the writer thread.
+struct Ring {
+  Entry entries[kRingEntries];
+  std::atomic<uint32_t> head{0};     // Entries written.
+  std::atomic<uint32_t> tail{0};     // Entries taken by the writer.
+  std::atomic<int> dropped{0};
+  std::atomic<bool> in_use{true};
+  Ring *next = nullptr;
+};
+
+std::atomic<int> min_severity(kLogInfo);
+std::atomic<bool> running(false);
+std::atomic<bool> stop_writer(false);
+std::atomic<Ring*> rings(nullptr);   // Never freed; the writer may read.
+thread_local Ring *thread_ring = nullptr;
+std::thread writer;
+FILE *log_file = NULL;    // If NULL, syslog.
+
+int64_t Nanos(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// libupnp starts and ends threads as it goes; when one exits, its ring is
+// left to the next new thread. What it wrote is still in there for the
+// writer, and the next thread continues after it.
+struct RingOwner {
+  Ring *ring = nullptr;
+  ~RingOwner() {
+    if (ring != nullptr) ring->in_use.store(false, std::memory_order_release);
+    thread_ring = nullptr;
+  }
+};
+thread_local RingOwner ring_owner;
+
+Ring *ThreadRing() {
+  if (thread_ring != nullptr) return thread_ring;
+  Ring *ring = nullptr;
+  for (Ring *r = rings.load(std::memory_order_acquire); r; r = r->next) {
+    bool in_use = false;
+    if (r->in_use.compare_exchange_strong(in_use, true,
+                                          std::memory_order_acquire)) {
+      ring = r;
+      break;
+    }
+  }
+  if (ring == nullptr) {
+    ring = new Ring();
+    ring->next = rings.load(std::memory_order_relaxed);
+    while (!rings.compare_exchange_weak(ring->next, ring,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+  }
+  ring_owner.ring = ring;
+  thread_ring = ring;
+  return ring;
+}
+
+void WriteLine(FILE *out, int64_t when, LogSeverity severity,
+               const char *text) {
+  static const char kSeverityLetter[] = { 'D', 'I', 'W', 'E' };
+  const time_t seconds = when / 1000000000LL;
+  struct tm tm;
+  localtime_r(&seconds, &tm);
+  char stamp[32];
+  strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &tm);
+  fprintf(out, "%c %s.%03d %s\n", kSeverityLetter[severity], stamp,
+          (int)(when % 1000000000LL / 1000000), text);
+}
+
+void Write(int64_t when, LogSeverity severity, const char *text) {
+  if (log_file != NULL) {
+    WriteLine(log_file, when, severity, text);
+    return;
+  }
+  static const int kPriority[] = { LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERR };
+  syslog(kPriority[severity], "%s", text);
+}
+
+// Takes everything from the rings and writes it in order.
+void WritePending() {
+  std::vector<Entry> pending;
+  int dropped = 0;
+  for (Ring *ring = rings.load(std::memory_order_acquire); ring != NULL;
+       ring = ring->next) {
+    const uint32_t head = ring->head.load(std::memory_order_acquire);
+    uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+    for (; tail != head; ++tail) {
+      pending.push_back(ring->entries[tail % kRingEntries]);
+    }
+    ring->tail.store(tail, std::memory_order_release);
+    dropped += ring->dropped.exchange(0, std::memory_order_relaxed);
+  }
+  if (pending.empty() && dropped == 0) return;
+  std::stable_sort(pending.begin(), pending.end(),
+                   [](const Entry &a, const Entry &b) {
+                     return a.when < b.when;
+                   });
+  for (const Entry &entry : pending) {
+    Write(entry.when, entry.severity, entry.text);
+  }
+  if (dropped > 0) {
+    char text[64];
+    snprintf(text, sizeof(text), "%d log messages dropped", dropped);
+    Write(Nanos(CLOCK_REALTIME), kLogWarning, text);
+  }
+  if (log_file != NULL) fflush(log_file);
+}
+
+void RunWriter() {
+  // The display may have made us a realtime thread; writing logs must
+  // never compete with it.
+  struct sched_param p;
+  p.sched_priority = 0;
+  pthread_setschedparam(pthread_self(), SCHED_OTHER, &p);
+  while (!stop_writer.load(std::memory_order_relaxed)) {
+    usleep(kWriteIntervalMicros);
+    WritePending();
+  }
+}
+}  // namespace
+
+bool LogStart(const char *target) {
+  if (target == NULL) {
+    log_file = stderr;
+  } else if (strcmp(target, "syslog") == 0) {
+    openlog("upnp-display", LOG_PID, LOG_DAEMON);
+    log_file = NULL;
+  } else {
+    log_file = fopen(target, "a");
+    if (log_file == NULL) {
+      perror(target);
+      return false;
+    }
+  }
+  stop_writer = false;
+  writer = std::thread(&RunWriter);
+  running = true;
+  return true;
+}
+
+void LogStop() {
+  if (!running) return;
+  running = false;
+  stop_writer = true;
+  writer.join();
+  WritePending();
+  if (log_file == NULL) closelog();
+  else if (log_file != stderr) fclose(log_file);
+  log_file = stderr;
+}
+
+void LogSetMinSeverity(LogSeverity severity) {
+  min_severity.store(severity, std::memory_order_relaxed);
+}
+
+bool ParseLogSeverity(const char *name, LogSeverity *severity) {
+  static const char *const kNames[] = { "debug", "info", "warning", "error" };
+  for (int i = kLogDebug; i <= kLogError; ++i) {
+    if (strcasecmp(name, kNames[i]) == 0) {
+      *severity = (LogSeverity) i;
+      return true;
+    }
+  }
+  return false;
+}
+
+void LogAt(LogSite *site, LogSeverity severity, const char *format, ...) {
+  if (severity < min_severity.load(std::memory_order_relaxed)) return;
+  // Debug and info messages tell what happens, e.g. a renderer that
+  // connects; only warnings and errors repeat for one cause.
+  if (severity >= kLogWarning) {
+    const int64_t now = Nanos(CLOCK_MONOTONIC);
+    int64_t window_start = site->window_start.load(std::memory_order_relaxed);
+    if ((window_start == 0 || now - window_start >= kLogSiteWindowNanos)
+        && site->window_start.compare_exchange_strong(window_start, now)) {
+      site->in_window.store(0, std::memory_order_relaxed);
+    }
+    if (site->in_window.fetch_add(1, std::memory_order_relaxed)
+        >= kLogSiteBurst) {
+      site->suppressed.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  char text[kLineLength];
+  va_list ap;
+  va_start(ap, format);
+  int length = vsnprintf(text, sizeof(text), format, ap);
+  va_end(ap);
+  if (length >= (int)sizeof(text)) length = sizeof(text) - 1;
+  const int suppressed = site->suppressed.exchange(0,
+                                                   std::memory_order_relaxed);
+  if (suppressed > 0 && length < (int)sizeof(text) - 1) {
+    snprintf(text + length, sizeof(text) - length,
+             " (%d similar suppressed)", suppressed);
+  }
+
+  const int64_t when = Nanos(CLOCK_REALTIME);
+  if (!running.load(std::memory_order_acquire)) {
+    WriteLine(stderr, when, severity, text);
+    return;
+  }
+  Ring *const ring = ThreadRing();
+  const uint32_t head = ring->head.load(std::memory_order_relaxed);
+  if (head - ring->tail.load(std::memory_order_acquire) == kRingEntries) {
+    ring->dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  Entry &entry = ring->entries[head % kRingEntries];
+  entry.when = when;
+  entry.severity = severity;
+  memcpy(entry.text, text, sizeof(text));
+  ring->head.store(head + 1, std::memory_order_release);
+}
@@ -0,0 +1,67 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_LOGGING_H
+#define UPNP_DISPLAY_LOGGING_H
+
+#include <stdint.h>
+
+#include <atomic>
+
+// Diagnostics that never hold up the thread logging them.
+//
+//   LOG(kLogError, "Subscribe: %s rc=%d", url, rc);
+//
+// Once LogStart() was called, messages go into a ring buffer of the
+// calling thread and a background thread writes them out; if a ring is
+// full, messages are dropped (and counted) rather than waited for. Before,
+// they are written to stderr right away.
+//
+// Messages below LogSetMinSeverity() (kLogInfo by default) are skipped.
+// Each LOG() statement of a warning or error is limited to five messages a
+// minute, so an error repeating at every event doesn't flood the log; how
+// many were suppressed is told with the next one that gets through.
+enum LogSeverity { kLogDebug, kLogInfo, kLogWarning, kLogError };
+
+#define LOG(severity, ...) do {                         \
+    static LogSite log_site_;                           \
+    LogAt(&log_site_, (severity), __VA_ARGS__);         \
+  } while (0)
+
+// Starts writing in the background to "target": "syslog", or the name of a
+// file to append to; stderr if NULL. Returns 'false' if it can't be opened.
+// Call after daemon(), threads don't survive it.
+bool LogStart(const char *target);
+
+// Writes out what is left and stops the background thread.
+void LogStop();
+
+// Only log messages of "severity" and above.
+void LogSetMinSeverity(LogSeverity severity);
+
+// Parses "debug", "info", "warning" or "error". Returns 'false' if unknown.
+bool ParseLogSeverity(const char *name, LogSeverity *severity);
+
+// Rate limit of one LOG() statement.
+struct LogSite {
+  std::atomic<int64_t> window_start{0};
+  std::atomic<int> in_window{0};
+  std::atomic<int> suppressed{0};
+};
+
+void LogAt(LogSite *site, LogSeverity severity, const char *format, ...)
+  __attribute__((format(printf, 3, 4)));
+
+#endif  // UPNP_DISPLAY_LOGGING_H
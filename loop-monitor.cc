@@ -0,0 +1,93 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "loop-monitor.h"
+
+#include <algorithm>
+
+#include "logging.h"
+#include "metrics.h"
+
+static const MetricCounter frame_overruns(
+  "upnp_display_frame_overruns_total",
+  "Frames shown later than their deadline.");
+
+RollingPercentiles::RollingPercentiles() : next_(0), count_(0) {}
+
+void RollingPercentiles::Add(int64_t nanos) {
+  samples_[next_] = nanos;
+  next_ = (next_ + 1) % kWindow;
+  if (count_ < kWindow) ++count_;
+}
+
+int64_t RollingPercentiles::Percentile(double fraction) const {
+  if (count_ == 0) return 0;
+  int64_t sorted[kWindow];
+  std::copy(samples_, samples_ + count_, sorted);
+  int rank = (int)(fraction * count_);
+  if (rank >= count_) rank = count_ - 1;
+  std::nth_element(sorted, sorted + rank, sorted + count_);
+  return sorted[rank];
+}
+
+void RollingPercentiles::WriteJSON(FILE *out) const {
+  fprintf(out, "{\"count\": %d, \"p50_ns\": %lld, \"p90_ns\": %lld, "
+          "\"p99_ns\": %lld, \"max_ns\": %lld}", count_,
+          (long long)Percentile(0.5), (long long)Percentile(0.9),
+          (long long)Percentile(0.99), (long long)Percentile(1.0));
+}
+
+LoopMonitor::LoopMonitor(int deadline_millis)
+  : deadline_nanos_(deadline_millis * 1000000LL), frames_(0), overruns_(0) {}
+
+void LoopMonitor::WakeUp(int64_t due, int64_t woke) {
+  wakeup_late_.Add(woke - due);
+}
+
+void LoopMonitor::Frame(int64_t due, int64_t woke, int64_t started,
+                        int64_t composed, int64_t shown) {
+  ++frames_;
+  frame_time_.Add(shown - started);
+  frame_late_.Add(shown - due);
+  if (shown - due <= deadline_nanos_) return;
+
+  ++overruns_;
+  frame_overruns.Add();
+  static const char *const kStages[] = {
+    "wakeup", "tasks", "compose", "output"
+  };
+  const int64_t took[] = {
+    woke - due, started - woke, composed - started, shown - composed
+  };
+  const int slowest = std::max_element(took, took + 4) - took;
+  LOG(kLogWarning, "Frame overrun: shown %.1fms after due, %s slowest "
+      "(wakeup %.1fms, tasks %.1fms, compose %.1fms, output %.1fms)",
+      (shown - due) / 1e6, kStages[slowest], took[0] / 1e6,
+      took[1] / 1e6, took[2] / 1e6, took[3] / 1e6);
+}
+
+void LoopMonitor::WriteJSON(FILE *out) const {
+  fprintf(out, "{\"frames\": %lld, \"overruns\": %lld, "
+          "\"deadline_ns\": %lld,\n  \"wakeup_late\": ",
+          (long long)frames_, (long long)overruns_,
+          (long long)deadline_nanos_);
+  wakeup_late_.WriteJSON(out);
+  fprintf(out, ",\n  \"frame_time\": ");
+  frame_time_.WriteJSON(out);
+  fprintf(out, ",\n  \"frame_late\": ");
+  frame_late_.WriteJSON(out);
+  fprintf(out, "}");
+}
@@ -0,0 +1,73 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_LOOP_MONITOR_H
+#define UPNP_DISPLAY_LOOP_MONITOR_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// The most recent kWindow durations, to see how things are going now
+// rather than since start.
+class RollingPercentiles {
+public:
+  static const int kWindow = 512;
+
+  RollingPercentiles();
+
+  void Add(int64_t nanos);
+
+  // Value below which the given fraction (0..1) of the durations in the
+  // window is. 0 if there are none.
+  int64_t Percentile(double fraction) const;
+
+  // As JSON object with the count in the window, p50, p90, p99 and max.
+  void WriteJSON(FILE *out) const;
+
+private:
+  int64_t samples_[kWindow];
+  int next_;
+  int count_;
+};
+
+// Watches the timing of the display loop: how late the scheduler wakes up
+// compared to when its tasks were due, and how long frames take. A frame
+// that is out later than "deadline_millis" after it was due is an overrun;
+// it is logged with the time each stage took.
+class LoopMonitor {
+public:
+  explicit LoopMonitor(int deadline_millis);
+
+  // The scheduler woke up at "woke" for tasks due at "due".
+  void WakeUp(int64_t due, int64_t woke);
+
+  // A frame for tasks due at "due" started to be drawn after the tasks ran,
+  // was composed and then written out to the display.
+  void Frame(int64_t due, int64_t woke, int64_t started, int64_t composed,
+             int64_t shown);
+
+  // Rolling percentiles of wakeup lateness and frame times, and overruns.
+  void WriteJSON(FILE *out) const;
+
+private:
+  const int64_t deadline_nanos_;
+  RollingPercentiles wakeup_late_;
+  RollingPercentiles frame_time_;     // From start of drawing until shown.
+  RollingPercentiles frame_late_;     // From due until shown.
+  int64_t frames_;
+  int64_t overruns_;
+};
+
+#endif  // UPNP_DISPLAY_LOOP_MONITOR_H
@@ -18,16 +18,32 @@
 
 #include <limits.h>
 #include <sched.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <iostream>
 
 #include "controller-state.h"
+#include "event-log.h"
+#include "gpio-chardev.h"
+#include "gpio-trace.h"
 #include "upnp-display.h"
 #include "lcd-display.h"
+#include "logging.h"
+#include "metrics-server.h"
 #include "vfd-display.h"
 #include "printer.h"
+#include "trace-events.h"
+
+// Defined in the VFD library (vfd_interface.cc)
+extern GPIO gpio;
+
+// Number of pin changes kept when tracing GPIO; the most recent ones.
+#define GPIO_TRACE_CAPACITY (1 << 18)
+
+// Number of spans each thread keeps when tracing time spent; the most recent.
+#define TRACE_SPANS_PER_THREAD (1 << 14)
 
 // Width of your display. Usually this is just 16 wide, but you can get 24 or
 // even 40 wide displays. You can also set this via the -w option.
@@ -36,6 +52,10 @@
 int main(int argc, char *argv[]) {
   std::string match_name;
   int display_width = DEFAULT_LCD_DISPLAY_WIDTH;
+  HD44780Rom lcd_rom = HD44780_ROM_ASCII;
+  LCDPinMap lcd_pins = kDefaultLCDPins;
+  bool lcd_hardware_scroll = false;
+  bool lcd_smooth_scroll = false;
   bool as_daemon = false;
   bool on_console = false;
 
@@ -44,14 +64,28 @@ int main(int argc, char *argv[]) {
   std::string vfd_display_def_file;
 
   int screensave_after = -1;
+  const char *gpio_chip = NULL;
+  const char *gpio_trace_file = NULL;
+  const char *latency_file = NULL;
+  const char *metrics_address = NULL;
+  const char *trace_events_file = NULL;
+  const char *log_target = NULL;
+  const char *interface = NULL;
+  const char *record_file = NULL;
+  const char *replay_file = NULL;
+  bool replay_fast = false;
 
   int opt;
-  while ((opt = getopt(argc, argv, "hn:w:dclv:s:")) != -1) {
+  while ((opt = getopt(argc, argv, "hn:i:w:r:p:g:t:T:HSL:M:o:m:E:R:Fdclv:s:")) != -1) {
     switch (opt) {
     case 'n':
       if (optarg != NULL) match_name = optarg;
       break;
 
+    case 'i':
+      interface = optarg;
+      break;
+
     case 'd':
       as_daemon = true;
       break;
@@ -79,6 +113,73 @@ int main(int argc, char *argv[]) {
       break;
     }
 
+    case 'r':
+      if (!ParseHD44780Rom(optarg, &lcd_rom)) {
+        fprintf(stderr, "Unknown character ROM '%s'\n", optarg);
+        return 1;
+      }
+      break;
+
+    case 'p':
+      if (!ParseLCDPinMap(optarg, &lcd_pins)) {
+        return 1;
+      }
+      break;
+
+    case 'g':
+      gpio_chip = optarg;
+      break;
+
+    case 't':
+      gpio_trace_file = optarg;
+      break;
+
+    case 'T':
+      trace_events_file = optarg;
+      break;
+
+    case 'H':
+      lcd_hardware_scroll = true;
+      break;
+
+    case 'S':
+      lcd_smooth_scroll = true;
+      break;
+
+    case 'L':
+      latency_file = optarg;
+      break;
+
+    case 'M':
+      metrics_address = optarg;
+      break;
+
+    case 'o':
+      log_target = optarg;
+      break;
+
+    case 'm': {
+      LogSeverity severity;
+      if (!ParseLogSeverity(optarg, &severity)) {
+        fprintf(stderr, "Unknown log level '%s'\n", optarg);
+        return 1;
+      }
+      LogSetMinSeverity(severity);
+      break;
+    }
+
+    case 'E':
+      record_file = optarg;
+      break;
+
+    case 'R':
+      replay_file = optarg;
+      break;
+
+    case 'F':
+      replay_fast = true;
+      break;
+
     case 's':
       screensave_after = atoi(optarg);
       break;
@@ -88,23 +189,84 @@ int main(int argc, char *argv[]) {
       fprintf(stderr, "Usage: %s <options>\n", argv[0]);
       fprintf(stderr, "\t-n <name or \"uuid:\"<uuid>"
               ": Connect to this renderer.\n"
+              "\t-i <interface>           : Network interface (default: first one up).\n"
               "\t-l                       : Use LCD display.\n"
               "\t-v <display-def>         : Use VFD display with specified definition file.\n"
               "\t-w <display-width>       : Set LCD display width.\n"
+              "\t-r <ascii|a00|a02>       : LCD character ROM (default: ascii).\n"
+              "\t-p <rs,e,d4,d5,d6,d7>    : LCD GPIO pins (default: 14,18,23,24,25,8).\n"
+              "\t-g </dev/gpiochipN>      : Use GPIO character device instead of Pi registers (LCD).\n"
+              "\t-t <file.vcd>            : Trace LCD GPIO, write waveform on exit.\n"
+              "\t-T <file.json>           : Trace time spent, write Chrome trace on exit.\n"
+              "\t-H                       : Let the LCD scroll titles by itself.\n"
+              "\t-S                       : Smooth scrolling on LCD.\n"
               "\t-d                       : Run as daemon.\n"
               "\t-c                       : On console instead LCD (debug).\n"
               "\t-s <timeout-seconds>     : Screensave after this time.\n"
+              "\t-L <file.json>           : On SIGUSR1, write event latency here.\n"
+              "\t-M <socket-path|port>    : Serve metrics on Unix socket or localhost port.\n"
+              "\t-o <file|syslog>         : Log there (default: stderr; syslog with -d).\n"
+              "\t-m <level>               : Log from debug, info (default), warning or error on.\n"
+              "\t-E <file>                : Record what comes in from the network.\n"
+              "\t-R <file>                : Replay recording instead of using the network.\n"
+              "\t-F                       : Replay as fast as possible.\n"
               );
       return 1;
     }
   }
 
+  // libpt6312 drives the VFD pins with its own copy of the GPIO code, which
+  // knows nothing about backends; it would write to nowhere.
+  if (on_vfd && !on_lcd && !on_console
+      && (gpio_chip != NULL || gpio_trace_file != NULL)) {
+    fprintf(stderr, "-g and -t only work with the LCD display.\n");
+    return 1;
+  }
+
+  if (trace_events_file != NULL) {
+    TraceSpan::Enable(TRACE_SPANS_PER_THREAD);
+  }
+
+  GPIOCharDevBackend *gpio_backend = NULL;
+  if (gpio_chip != NULL && !on_console) {
+    gpio_backend = GPIOCharDevBackend::Open(gpio_chip);
+    if (gpio_backend == NULL)
+      return 1;
+    gpio.SetBackend(gpio_backend);
+  }
+
+  // Tracing: the displays talk to the tracer, which passes everything on to
+  // a GPIO set up like the one they'd use otherwise.
+  GPIO *traced_gpio = NULL;
+  GPIOTracer *gpio_tracer = NULL;
+  if (gpio_trace_file != NULL && !on_console) {
+    traced_gpio = new GPIO();
+    traced_gpio->SetBackend(gpio_backend);
+    if (!traced_gpio->Init()) {
+      fprintf(stderr, "GPIO trace: no GPIO access.\n");
+      return 1;
+    }
+    gpio_tracer = new GPIOTracer(traced_gpio, GPIO_TRACE_CAPACITY);
+    if (on_lcd) {
+      gpio_tracer->SetPinName(lcd_pins.rs, "lcd_rs");
+      gpio_tracer->SetPinName(lcd_pins.e, "lcd_e");
+      for (int i = 0; i < 4; ++i) {
+        gpio_tracer->SetPinName(lcd_pins.data[i],
+                                "lcd_d" + std::to_string(4 + i));
+      }
+    }
+    gpio.SetBackend(gpio_tracer);
+  }
+
   Printer *printer = NULL;
   if (on_console || (!on_lcd && !on_vfd)) {
     printer = new ConsolePrinter(match_name, display_width);
   } else {
     if (on_lcd) {
-      LCDDisplay *display = new LCDDisplay(match_name, display_width);
+      LCDDisplay *display = new LCDDisplay(match_name, display_width,
+                                           lcd_rom, lcd_pins);
+      display->set_hardware_scroll(lcd_hardware_scroll);
+      display->set_smooth_scroll(lcd_smooth_scroll);
       if (!display->Init()) {
         fprintf(stderr, "You need to run this as root to have access "
                 "to GPIO pins. Run with sudo (or with option -c to output on "
@@ -147,13 +309,62 @@ int main(int argc, char *argv[]) {
 
   if (as_daemon) {
     daemon(0, 0);
+    if (log_target == NULL) log_target = "syslog";   // stderr is gone.
+  }
+  if (!LogStart(log_target)) {
+    return 1;
+  }
+
+  // After daemon(), as threads don't survive the fork.
+  MetricsServer metrics_server;
+  if (metrics_address != NULL && !metrics_server.Start(metrics_address)) {
+    LogStop();
+    return 1;
+  }
+
+  EventRecorder recorder;
+  EventReplay replay;
+  if ((record_file != NULL && !recorder.Open(record_file))
+      || (replay_file != NULL && !replay.Open(replay_file))) {
+    LogStop();
+    return 1;
   }
 
   UPnPDisplay ui(match_name, printer, screensave_after);
-  ControllerState controller(&ui, printer);
+  if (latency_file != NULL) ui.set_latency_file(latency_file);
+  if (trace_events_file != NULL) ui.set_trace_file(trace_events_file);
+  ControllerState *controller;
+  if (replay_file != NULL) {
+    // Ends like a kill would, so everything is written out as usual.
+    controller = new ControllerState(&ui, &replay);
+    replay.Start(controller, replay_fast, []() { raise(SIGTERM); });
+  } else {
+    controller = new ControllerState(&ui, printer, interface,
+                                     record_file != NULL
+                                     ? &recorder : LibUpnpBackend());
+  }
   ui.Loop();
+  replay.Stop();
+  delete controller;
+  LogStop();   // Whatever comes later goes to stderr directly.
 
   delete printer;
 
+  if (trace_events_file != NULL
+      && TraceSpan::WriteChromeJSON(trace_events_file)) {
+    fprintf(stderr, "Trace written to %s\n", trace_events_file);
+  }
+
+  if (gpio_tracer != NULL) {
+    if (gpio_tracer->WriteVCD(gpio_trace_file)) {
+      fprintf(stderr, "GPIO trace written to %s\n", gpio_trace_file);
+    }
+    // Two nibble pulses on enable per byte.
+    gpio_tracer->PrintSummary(stderr, lcd_pins.e, 2);
+    delete gpio_tracer;
+    delete traced_gpio;
+  }
+  delete gpio_backend;
+
   return 0;
 }
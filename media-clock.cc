@@ -0,0 +1,76 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "media-clock.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+
+static const int64_t kSecondNanos = 1000000000LL;
+
+int ParseUPnPTime(const std::string &upnp_time) {
+  int hour = 0;
+  int minute = 0;
+  int second = 0;
+  if (sscanf(upnp_time.c_str(), "%d:%02d:%02d", &hour, &minute, &second) == 3)
+    return hour * 3600 + minute * 60 + second;
+  return 0;
+}
+
+MediaClock::MediaClock()
+  : valid_(false), running_(false), origin_low_(0), origin_high_(0),
+    stopped_seconds_(0) {}
+
+void MediaClock::Sync(int seconds, bool running,
+                      int64_t sent_nanos, int64_t received_nanos) {
+  valid_ = true;
+  if (!running) {
+    running_ = false;
+    stopped_seconds_ = seconds;
+    return;
+  }
+
+  // The renderer looked at its position somewhere between sending and
+  // receiving, and it was at least "seconds", but less than one more.
+  const int64_t high = received_nanos - seconds * kSecondNanos;
+  const int64_t low = sent_nanos - (seconds + 1) * kSecondNanos;
+  if (running_ && low < origin_high_ && high > origin_low_) {
+    origin_low_ = std::max(origin_low_, low);
+    origin_high_ = std::min(origin_high_, high);
+  } else {
+    origin_low_ = low;
+    origin_high_ = high;
+  }
+  running_ = true;
+}
+
+void MediaClock::Freeze(int64_t now_nanos) {
+  if (!running_) return;
+  stopped_seconds_ = SecondsAt(now_nanos);
+  running_ = false;
+}
+
+int MediaClock::SecondsAt(int64_t now_nanos) const {
+  if (!running_) return stopped_seconds_;
+  const int64_t position = now_nanos - origin();
+  return position > 0 ? position / kSecondNanos : 0;
+}
+
+int64_t MediaClock::NextRolloverAfter(int64_t now_nanos) const {
+  if (!running_) return -1;
+  return origin() + (SecondsAt(now_nanos) + 1) * kSecondNanos;
+}
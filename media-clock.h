@@ -0,0 +1,70 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_MEDIA_CLOCK_H
+#define UPNP_DISPLAY_MEDIA_CLOCK_H
+
+#include <stdint.h>
+
+#include <string>
+
+// Seconds of an UPnP time value "H:MM:SS"; 0 if it can't be parsed.
+int ParseUPnPTime(const std::string &upnp_time);
+
+// Follows the play position of the renderer between position reports, so
+// that the displayed time changes exactly when the second rolls over.
+//
+// The renderer reports whole seconds, so each report only says that the
+// track started (its "origin" on our CLOCK_MONOTONIC) within a window of one
+// second plus the time the request took. Consecutive reports narrow that
+// window down; the estimate is its middle. A report that doesn't fit the
+// window (seek, new track, clock drift) starts over.
+class MediaClock {
+public:
+  MediaClock();
+
+  // Position report of "seconds", requested at "sent_nanos" and received at
+  // "received_nanos". If not "running", the position stands still.
+  void Sync(int seconds, bool running,
+            int64_t sent_nanos, int64_t received_nanos);
+
+  // Stop the clock at the position it has at "now_nanos", e.g. when pause
+  // is noticed before the next report.
+  void Freeze(int64_t now_nanos);
+
+  // Whether there has been a report.
+  bool valid() const { return valid_; }
+
+  // Whole seconds of play position at "now_nanos".
+  int SecondsAt(int64_t now_nanos) const;
+
+  // Time at which SecondsAt() changes next after "now_nanos"; -1 if the
+  // clock is not running.
+  int64_t NextRolloverAfter(int64_t now_nanos) const;
+
+  // Width of the window the origin is known to be in.
+  int64_t uncertainty_nanos() const { return origin_high_ - origin_low_; }
+
+private:
+  int64_t origin() const { return origin_low_ + (origin_high_ - origin_low_) / 2; }
+
+  bool valid_;
+  bool running_;
+  int64_t origin_low_;       // Track started after this...
+  int64_t origin_high_;      // ...and not later than this.
+  int stopped_seconds_;      // Position if not running.
+};
+
+#endif  // UPNP_DISPLAY_MEDIA_CLOCK_H
@@ -0,0 +1,158 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "metrics-server.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "logging.h"
+#include "metrics.h"
+
+// How often the thread looks if it should stop.
+static const int kStopCheckMillis = 500;
+// Clients that take longer to send their request or read the answer are
+// dropped.
+static const int kClientTimeoutMillis = 1000;
+
+MetricsServer::MetricsServer() : listen_fd_(-1), stop_(false) {}
+
+MetricsServer::~MetricsServer() {
+  stop_ = true;
+  if (thread_.joinable()) thread_.join();
+  if (listen_fd_ >= 0) close(listen_fd_);
+  if (!socket_path_.empty()) unlink(socket_path_.c_str());
+}
+
+bool MetricsServer::Start(const std::string &address) {
+  const bool is_port = !address.empty()
+    && address.find_first_not_of("0123456789") == std::string::npos;
+  if (is_port) {
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(atoi(address.c_str()));
+    listen_fd_ = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) {
+      LOG(kLogError, "Metrics: socket(): %s", strerror(errno));
+      return false;
+    }
+    int on = 1;
+    setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (bind(listen_fd_, (struct sockaddr*) &addr, sizeof(addr)) < 0) {
+      LOG(kLogError, "Metrics: bind(): %s", strerror(errno));
+      return false;
+    }
+  } else {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (address.size() >= sizeof(addr.sun_path)) {
+      LOG(kLogError, "Metrics: socket path too long: %s", address.c_str());
+      return false;
+    }
+    strcpy(addr.sun_path, address.c_str());
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) {
+      LOG(kLogError, "Metrics: socket(): %s", strerror(errno));
+      return false;
+    }
+    // A socket left over from a previous run is replaced; anything else at
+    // that path is not ours to delete.
+    struct stat st;
+    if (lstat(address.c_str(), &st) == 0) {
+      if (!S_ISSOCK(st.st_mode)) {
+        LOG(kLogError, "Metrics: %s exists and is not a socket",
+            address.c_str());
+        return false;
+      }
+      unlink(address.c_str());
+    }
+    if (bind(listen_fd_, (struct sockaddr*) &addr, sizeof(addr)) < 0) {
+      LOG(kLogError, "Metrics: bind(): %s", strerror(errno));
+      return false;
+    }
+    socket_path_ = address;
+  }
+  if (listen(listen_fd_, 4) < 0) {
+    LOG(kLogError, "Metrics: listen(): %s", strerror(errno));
+    return false;
+  }
+  thread_ = std::thread(&MetricsServer::Run, this);
+  return true;
+}
+
+void MetricsServer::Run() {
+  // The display may have made us a realtime thread; serving metrics must
+  // never compete with it.
+  struct sched_param p;
+  p.sched_priority = 0;
+  pthread_setschedparam(pthread_self(), SCHED_OTHER, &p);
+  while (!stop_) {
+    struct pollfd pfd = { listen_fd_, POLLIN, 0 };
+    if (poll(&pfd, 1, kStopCheckMillis) <= 0) continue;
+    const int client = accept4(listen_fd_, NULL, NULL, SOCK_CLOEXEC);
+    if (client < 0) continue;
+    Answer(client);
+    close(client);
+  }
+}
+
+void MetricsServer::Answer(int client) {
+  // Read until the end of the request header; what was asked for doesn't
+  // matter, there is only one thing to answer.
+  std::string request;
+  char buffer[512];
+  while (request.find("\r\n\r\n") == std::string::npos
+         && request.find("\n\n") == std::string::npos) {
+    struct pollfd pfd = { client, POLLIN, 0 };
+    if (poll(&pfd, 1, kClientTimeoutMillis) <= 0) return;
+    const ssize_t r = read(client, buffer, sizeof(buffer));
+    if (r <= 0) return;
+    request.append(buffer, r);
+    if (request.size() > 8192) return;
+  }
+
+  const std::string body = MetricsExposition();
+  char header[128];
+  snprintf(header, sizeof(header),
+           "HTTP/1.0 200 OK\r\n"
+           "Content-Type: text/plain; version=0.0.4\r\n"
+           "Content-Length: %zu\r\n\r\n", body.size());
+  const std::string response = header + body;
+
+  struct timeval timeout = { kClientTimeoutMillis / 1000,
+                             (kClientTimeoutMillis % 1000) * 1000 };
+  setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+  for (size_t written = 0; written < response.size(); ) {
+    const ssize_t w = send(client, response.data() + written,
+                           response.size() - written, MSG_NOSIGNAL);
+    if (w <= 0) return;
+    written += w;
+  }
+}
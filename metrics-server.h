@@ -0,0 +1,45 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_METRICS_SERVER_H
+#define UPNP_DISPLAY_METRICS_SERVER_H
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+// Answers every HTTP request with MetricsExposition(), on its own thread.
+// Reading the metrics never takes a lock the counting threads use, so a
+// slow or stuck client only ever holds up this thread.
+class MetricsServer {
+public:
+  MetricsServer();
+  ~MetricsServer();
+
+  // "address" is a port number to listen on localhost, or the path of a
+  // Unix domain socket. Returns false if it can't listen there.
+  bool Start(const std::string &address);
+
+private:
+  void Run();
+  void Answer(int client);
+
+  int listen_fd_;
+  std::string socket_path_;   // To remove when done; empty for TCP.
+  std::atomic<bool> stop_;
+  std::thread thread_;
+};
+
+#endif  // UPNP_DISPLAY_METRICS_SERVER_H
@@ -0,0 +1,235 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "metrics.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "logging.h"
+
+namespace {
+struct Definition {
+  std::string family;     // Name in HELP and TYPE lines.
+  std::string sample;     // Name of the value; family plus suffix.
+  std::string labels;
+  std::string help;
+  const char *type;
+  double scale;
+};
+
+// One copy of all counters per thread. Only that thread writes to it.
+struct Shard {
+  std::atomic<int64_t> values[MetricCounter::kMaxMetrics];
+  std::atomic<bool> in_use;
+  Shard *next;
+};
+
+struct Registry {
+  std::mutex register_mutex;   // Registering only; never when counting.
+  Definition definitions[MetricCounter::kMaxMetrics];
+  std::atomic<int> count{0};   // Definitions below are complete.
+  std::atomic<Shard*> shards{nullptr};
+
+  // Counts of threads that exited. Taken when moving counts here and when
+  // reading, so that nothing is counted twice or not at all.
+  std::mutex retire_mutex;
+  int64_t retired[MetricCounter::kMaxMetrics] = {};
+};
+
+// Created on first use, as counters are registered from static
+// initializers; never destroyed, as threads may count while exiting.
+Registry &registry() {
+  static Registry *const instance = new Registry();
+  return *instance;
+}
+
+thread_local Shard *thread_shard = nullptr;
+
+// Threads come and go (libupnp has a pool of them); when one exits, its
+// counts are added to the retired ones and the shard is free for the next.
+void RetireShard(Shard *shard) {
+  Registry &r = registry();
+  {
+    std::lock_guard<std::mutex> lock(r.retire_mutex);
+    for (int i = 0; i < MetricCounter::kMaxMetrics; ++i) {
+      r.retired[i] += shard->values[i].load(std::memory_order_relaxed);
+      shard->values[i].store(0, std::memory_order_relaxed);
+    }
+  }
+  shard->in_use.store(false, std::memory_order_release);
+}
+
+struct ShardOwner {
+  Shard *shard = nullptr;
+  ~ShardOwner() {
+    if (shard != nullptr) RetireShard(shard);
+    thread_shard = nullptr;
+  }
+};
+thread_local ShardOwner shard_owner;
+
+Shard *NewThreadShard() {
+  std::atomic<Shard*> &head = registry().shards;
+  Shard *shard = nullptr;
+  for (Shard *s = head.load(std::memory_order_acquire); s != nullptr;
+       s = s->next) {
+    bool in_use = false;
+    if (s->in_use.compare_exchange_strong(in_use, true,
+                                          std::memory_order_acquire)) {
+      shard = s;
+      break;
+    }
+  }
+  if (shard == nullptr) {
+    shard = new Shard();
+    for (std::atomic<int64_t> &value : shard->values) {
+      value.store(0, std::memory_order_relaxed);
+    }
+    shard->in_use.store(true, std::memory_order_relaxed);
+    shard->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(shard->next, shard,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+    }
+  }
+  shard_owner.shard = shard;
+  thread_shard = shard;
+  return shard;
+}
+
+int Register(const std::string &family, const std::string &sample,
+             const char *type, const char *help, const std::string &labels,
+             double scale) {
+  Registry &r = registry();
+  std::lock_guard<std::mutex> lock(r.register_mutex);
+  const int count = r.count.load(std::memory_order_relaxed);
+  for (int i = 0; i < count; ++i) {
+    if (r.definitions[i].sample == sample && r.definitions[i].labels == labels)
+      return i;
+  }
+  if (count == MetricCounter::kMaxMetrics) {
+    LOG(kLogError, "Metrics: no room for %s{%s}",
+        sample.c_str(), labels.c_str());
+    return -1;
+  }
+  Definition &definition = r.definitions[count];
+  definition.family = family;
+  definition.sample = sample;
+  definition.labels = labels;
+  definition.help = help;
+  definition.type = type;
+  definition.scale = scale;
+  r.count.store(count + 1, std::memory_order_release);
+  return count;
+}
+
+std::string FormatValue(int64_t value, double scale) {
+  char buffer[32];
+  if (scale == 1.0) {
+    snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
+  } else {
+    snprintf(buffer, sizeof(buffer), "%.9g", value * scale);
+  }
+  return buffer;
+}
+}  // namespace
+
+MetricCounter::MetricCounter(const char *name, const char *help,
+                             const std::string &labels, double scale)
+  : id_(Register(name, name, "counter", help, labels, scale)) {}
+
+MetricCounter::MetricCounter(const char *family, const char *suffix,
+                             const char *type, const char *help,
+                             const std::string &labels, double scale)
+  : id_(Register(family, std::string(family) + suffix, type, help, labels,
+                 scale)) {}
+
+void MetricCounter::Add(int64_t n) const {
+  if (id_ < 0) return;
+  Shard *shard = thread_shard ? thread_shard : NewThreadShard();
+  std::atomic<int64_t> &value = shard->values[id_];
+  // Only this thread writes, so no read-modify-write is needed; the atomic
+  // makes it safe to read from others.
+  value.store(value.load(std::memory_order_relaxed) + n,
+              std::memory_order_relaxed);
+}
+
+MetricDuration::MetricDuration(const char *name, const char *help,
+                               const std::string &labels)
+  : sum_(name, "_sum", "summary", help, labels, 1e-9),
+    count_(name, "_count", "summary", help, labels, 1.0) {}
+
+std::string MetricLabel(const char *key, const std::string &value) {
+  std::string result = key;
+  result.append("=\"");
+  for (const char c : value) {
+    if (c == '\\' || c == '"') result.push_back('\\');
+    if (c == '\n') {
+      result.append("\\n");
+      continue;
+    }
+    result.push_back(c);
+  }
+  result.push_back('"');
+  return result;
+}
+
+std::string MetricsExposition() {
+  Registry &r = registry();
+  const int count = r.count.load(std::memory_order_acquire);
+
+  std::vector<int64_t> values(count, 0);
+  {
+    std::lock_guard<std::mutex> lock(r.retire_mutex);
+    for (int i = 0; i < count; ++i) values[i] = r.retired[i];
+    for (Shard *shard = r.shards.load(std::memory_order_acquire);
+         shard != NULL; shard = shard->next) {
+      for (int i = 0; i < count; ++i) {
+        values[i] += shard->values[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // All samples of a family have to be together, after its HELP and TYPE.
+  std::vector<int> order(count);
+  for (int i = 0; i < count; ++i) order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [&r](int a, int b) {
+      return r.definitions[a].family < r.definitions[b].family;
+    });
+
+  std::string result;
+  const std::string *family = NULL;
+  for (const int i : order) {
+    const Definition &definition = r.definitions[i];
+    if (family == NULL || *family != definition.family) {
+      family = &definition.family;
+      result.append("# HELP " + definition.family + " " + definition.help
+                    + "\n# TYPE " + definition.family + " " + definition.type
+                    + "\n");
+    }
+    result.append(definition.sample);
+    if (!definition.labels.empty()) {
+      result.append("{" + definition.labels + "}");
+    }
+    result.append(" " + FormatValue(values[i], definition.scale) + "\n");
+  }
+  return result;
+}
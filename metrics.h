@@ -0,0 +1,76 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_METRICS_H
+#define UPNP_DISPLAY_METRICS_H
+
+#include <stdint.h>
+
+#include <string>
+
+// Counters for monitoring, exported in the Prometheus text format.
+//
+// Every thread adds to its own copy of all counters, so counting is a plain
+// load and store without locks or atomic read-modify-write, and never
+// waits for anyone. Reading sums up the copies of all threads. When a
+// thread exits, its counts are kept in a total and its copy is reused by
+// the next thread.
+//
+// Counters are registered by name and labels; registering the same again
+// returns the same counter. There is room for kMaxMetrics of them.
+class MetricCounter {
+public:
+  static const int kMaxMetrics = 256;
+
+  // "labels" in Prometheus syntax without the braces, see MetricLabel().
+  // The value is multiplied by "scale" when exported, e.g. 1e-9 to export
+  // nanoseconds as seconds.
+  MetricCounter(const char *name, const char *help,
+                const std::string &labels = "", double scale = 1.0);
+
+  void Add(int64_t n = 1) const;
+
+private:
+  friend class MetricDuration;
+  MetricCounter(const char *family, const char *suffix, const char *type,
+                const char *help, const std::string &labels, double scale);
+
+  int id_;   // -1 if there was no room.
+};
+
+// Durations in nanoseconds, exported as Prometheus summary in seconds:
+// the sum and the count of all recorded durations.
+class MetricDuration {
+public:
+  MetricDuration(const char *name, const char *help,
+                 const std::string &labels = "");
+
+  void Record(int64_t nanos) const {
+    sum_.Add(nanos);
+    count_.Add(1);
+  }
+
+private:
+  MetricCounter sum_;
+  MetricCounter count_;
+};
+
+// A label for the counters above: key="value", with the value escaped.
+std::string MetricLabel(const char *key, const std::string &value);
+
+// All metrics in the Prometheus text exposition format.
+std::string MetricsExposition();
+
+#endif  // UPNP_DISPLAY_METRICS_H
@@ -19,35 +19,46 @@
 #include "printer.h"
 
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 
-#define STOP_SYMBOL "\u2b1b"   // ⬛
-#define PLAY_SYMBOL "\u25b6"   // ▶
-#define PAUSE_SYMBOL "]["      // TODO: add symbol in private unicode range.
+#include "media-clock.h"
 
-// Number of periods, a changed volume flashes up.
-static const int kVolumeFlashTime = 3;
+#define STOP_SYMBOL U"\u2b1b"   // ⬛
+#define PLAY_SYMBOL U"\u25b6"   // ▶
+#define PAUSE_SYMBOL U"]["      // TODO: add symbol in private unicode range.
+
+// Time a changed volume flashes up.
+static const int kVolumeFlashMillis = 1200;
+
+static int64_t MonotonicMillis() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
 
 void ConsolePrinter::Print(int line, const std::string &text) {
   printf("[%d]%s\n", line, text.c_str());
 }
 
 void Printer::fillVars(RendererState* current_state_) {
-
-//PGAD TEST
-//TODO call every 2 or 3 seconds to adjust and update timer every second 
-current_state_->GetPositionInfo();
-//\PGAD TEST
-   player_name = current_state_->friendly_name();
-   title = current_state_->GetVar("Meta_Title");
-   composer = current_state_->GetVar("Meta_Composer");
-   artist = current_state_->GetVar("Meta_Artist");
-   std::string creator = current_state_->GetVar("Meta_Creator");
-
-   if (artist == composer && !creator.empty() && creator != artist) {
-     artist = creator;
+   const GlyphCostFunction cost = [this](uint32_t cp) {
+     return glyph_cost(cp);
+   };
+   const int budget = custom_glyph_budget();
+   player_name.Set(current_state_->friendly_name(), cost, budget);
+   title.Set(current_state_->GetVar("Meta_Title"), cost, budget);
+   composer.Set(current_state_->GetVar("Meta_Composer"), cost, budget);
+   std::string artist_value = current_state_->GetVar("Meta_Artist");
+   const std::string creator = current_state_->GetVar("Meta_Creator");
+
+   if (artist_value == composer.utf8() && !creator.empty()
+       && creator != artist_value) {
+     artist_value = creator;
    }
+   artist.Set(artist_value, cost, budget);
 
-   album = current_state_->GetVar("Meta_Album");
+   album.Set(current_state_->GetVar("Meta_Album"), cost, budget);
    play_state = current_state_->GetVar("TransportState");
    time = parseTime(current_state_->GetVar("RelTime"));
    track_time = parseTime(current_state_->GetVar("CurrentTrackDuration"));
@@ -57,9 +68,9 @@ current_state_->GetPositionInfo();
 
 void Printer::noRendererPrint() {
    this->Print(0, "Waiting for");
-   std::string to_print = (player_match_name_.empty()
-                           ? "any Renderer"
-                           : player_match_name_);
+   std::u32string to_print = (player_match_name_.empty()
+                              ? U"any Renderer"
+                              : utf8_decode(player_match_name_));
    CenterAlign(&to_print, this->width());
    this->Print(1, to_print);
 }
@@ -67,34 +78,33 @@ void Printer::noRendererPrint() {
 void Printer::rendererPrint( RendererState* current_state_ ) {
 
     // First line is "[composer: ]Title"
-    std::string print_line = composer;
-    if (!print_line.empty()) print_line.append(": ");
-    print_line.append(title);
+    std::u32string print_line = composer.text();
+    if (!print_line.empty()) print_line.append(U": ");
+    print_line.append(title.text());
 
     const bool no_title_to_display = (print_line.empty() && album.empty());
     if (no_title_to_display) {
       // No title, so show at least player name.
-      print_line = player_name;
+      print_line = player_name.text();
       CenterAlign(&print_line, this->width());
       this->Print(0, print_line);
     }
 
     // Second line: Show volume related things if relevant.
     // Either we're muted, or there was a volume change that we display
-    // for kVolumeFlashTime
+    // for kVolumeFlashMillis
     if (muted) {
-      print_line = "[Muted]";
+      print_line = U"[Muted]";
       CenterAlign(&print_line, this->width());
       this->Print(1, print_line);
       return;
     }
-    else if (volume != previous_volume || volume_countdown > 0) {
+    const int64_t now = MonotonicMillis();
+    if (volume != previous_volume || now < volume_flash_until) {
       if (!previous_volume.empty()) {
         if (volume != previous_volume)
-          volume_countdown = kVolumeFlashTime;
-        else
-          --volume_countdown;
-        std::string volume_line = "Volume " + volume;
+          volume_flash_until = now + kVolumeFlashMillis;
+        std::u32string volume_line = U"Volume " + utf8_decode(volume);
         CenterAlign(&volume_line, this->width());
         this->Print(1, volume_line);
       }
@@ -104,7 +114,7 @@ void Printer::rendererPrint( RendererState* current_state_ ) {
 
     if (no_title_to_display) {
       // Nothing really to display ? Show play-state.
-      print_line = play_state;
+      print_line = utf8_decode(play_state);
       if (play_state == "STOPPED")
         print_line = STOP_SYMBOL " [Stopped]";
       else if (play_state == "PAUSED_PLAYBACK")
@@ -120,35 +130,36 @@ void Printer::rendererPrint( RendererState* current_state_ ) {
     // Alright, we have a title. If short enough, center, otherwise scroll.
     CenterAlign(&print_line, this->width());
     first_line_scroller.SetValue(print_line, this->width());
-    this->Print(0, first_line_scroller.GetScrolledContent());
+    this->PrintScrolled(0, first_line_scroller);
 
-    std::string formatted_time;
+    std::u32string formatted_time;
     if (play_state == "STOPPED") {
       formatted_time = "  " STOP_SYMBOL " ";
     } else {
       formatted_time = formatTime(track_time);
       // 'Blinking' time when paused.
       if (play_state == "PAUSED_PLAYBACK" && blink_time % 2 == 0) {
-        formatted_time = std::string(formatted_time.size(), ' ');
+        formatted_time = std::u32string(formatted_time.size(), ' ');
       }
     }
     const int remaining_len = this->width() - formatted_time.length() - 1;
 
     // Assemble second line from album. Add artist, but only if we wouldn't
     // exceed length (or, if we already exceed length, also append).
-    print_line = album;
+    print_line = album.text();
 
-    std::string artist_addition;
-    if (!artist.empty() && artist != album) {
-      if (!print_line.empty()) artist_addition.append("/");
-      artist_addition.append(artist);
+    std::u32string artist_addition;
+    if (!artist.empty() && artist.utf8() != album.utf8()) {
+      if (!print_line.empty()) artist_addition.append(U"/");
+      artist_addition.append(artist.text());
     }
     // Only append it if we'd stay within allocated screen-width. Unless the
     // Album name is already so long that we'd exceed the length anyway. In
     // that case, we have to scroll no matter what and including the artist
     // does less harm.
-    if (utf8_len(print_line + artist_addition) <= remaining_len
-        || utf8_len(print_line) > remaining_len) {
+    const int line_len = print_line.length();
+    if (line_len + (int) artist_addition.length() <= remaining_len
+        || line_len > remaining_len) {
       print_line += artist_addition;
     }
 
@@ -156,34 +167,34 @@ void Printer::rendererPrint( RendererState* current_state_ ) {
     RightAlign(&print_line, remaining_len);
     second_line_scroller.SetValue(print_line, remaining_len);
 
-    this->Print(1, formatted_time + " "
+    this->Print(1, formatted_time + U" "
                     + second_line_scroller.GetScrolledContent());
+}
 
-    blink_time++;
+void Printer::ScrollTick() {
     first_line_scroller.NextTick();
     second_line_scroller.NextTick();
 }
 
+void Printer::BlinkTick() {
+    blink_time++;
+}
+
 void Printer::goodBye() {
-   std::string msg = "Goodbye!";
+   std::u32string msg = U"Goodbye!";
    CenterAlign(&msg, this->width());
    this->Print(0, msg);
    // Show off unicode :)
-   msg = "\u2192 \u266a\u266b\u266a\u2669 \u2190";  // → ♪♫♩ ←
+   msg = U"\u2192 \u266a\u266b\u266a\u2669 \u2190";  // → ♪♫♩ ←
    CenterAlign(&msg, this->width());
    this->Print(1, msg);
 }
 
 int Printer::parseTime(const std::string &upnp_time) {
-   int hour = 0;
-   int minute = 0;
-   int second = 0;
-   if (sscanf(upnp_time.c_str(), "%d:%02d:%02d", &hour, &minute, &second) == 3)
-      return hour * 3600 + minute * 60 + second;
-   return 0;
+   return ParseUPnPTime(upnp_time);
 }
 
-std::string Printer::formatTime(int time) {
+std::u32string Printer::formatTime(int time) {
 
    char buf[32];
 
@@ -202,18 +213,18 @@ std::string Printer::formatTime(int time) {
    else
       snprintf(pos, sizeof(buf)-1, "%d:%02d", minute, second);
 
-   return buf;
+   return std::u32string(buf, buf + strlen(buf));   // plain ASCII
 }
 
-void Printer::CenterAlign(std::string *to_print, int width) {
-   const int len = utf8_len(*to_print);
+void Printer::CenterAlign(std::u32string *to_print, int width) {
+   const int len = to_print->length();
    if (len < width)
-      to_print->insert(0, std::string((width - len) / 2, ' '));
+      to_print->insert(0, (width - len) / 2, ' ');
 }
 
-void Printer::RightAlign(std::string *to_print, int width) {
-   const int len = utf8_len(*to_print);
+void Printer::RightAlign(std::u32string *to_print, int width) {
+   const int len = to_print->length();
    if (len < width)
-      to_print->insert(0, std::string(width - len, ' '));
+      to_print->insert(0, width - len, ' ');
 }
 
@@ -22,48 +22,129 @@
 
 #include "renderer-state.h"
 #include "scroller.h"
+#include "text-fold.h"
 #include "utf8.h"
 
+// A text value as received from the renderer in UTF-8, together with its
+// codepoints prepared for the display (composed, and folded where the display
+// can't show a character). This only happens when the value changes, so all
+// per-tick work (alignment, scrolling, glyph lookup) can index codepoints.
+class DisplayText {
+public:
+  // Set new UTF-8 value. Returns 'true' if it differs from the previous one.
+  // See FoldForDisplay() for "cost" and "custom_budget".
+  bool Set(const std::string &utf8, const GlyphCostFunction &cost,
+           int custom_budget) {
+    if (utf8 == utf8_) return false;
+    utf8_ = utf8;
+    text_ = FoldForDisplay(ComposeCanonical(utf8_decode(utf8_)),
+                           cost, custom_budget);
+    return true;
+  }
+
+  const std::string &utf8() const { return utf8_; }
+  const std::u32string &text() const { return text_; }
+  bool empty() const { return utf8_.empty(); }
+
+private:
+  std::string utf8_;
+  std::u32string text_;
+};
+
 // Interface for a simple display.
 class Printer {
 public:
 
    Printer(const std::string& match_name) :
 	 player_match_name_(match_name),
-	 play_state("STOPPED"), track_time(0), muted(false), blink_time(0) {};
+	 play_state("STOPPED"), track_time(0), muted(false),
+	 volume_flash_until(0), blink_time(0) {};
    virtual ~Printer() {}
 
    virtual int width() const { return 16; }
 
+   // What it takes this display to show the given character. Text values are
+   // folded to simpler characters where this is GLYPH_UNAVAILABLE.
+   virtual GlyphCost glyph_cost(uint32_t) const {
+      return GLYPH_NATIVE;
+   }
+
+   // How many different GLYPH_CUSTOM characters a single text value may use
+   // before the rarer ones are folded. Negative: no limit.
+   virtual int custom_glyph_budget() const { return -1; }
+
    // Print line. The text is given in UTF-8, the printer has to attempt
    // to try its best to display it.
    virtual void Print(int line, const std::string &text) = 0;
+
+   // Print line given as codepoints. Default encodes to UTF-8; displays that
+   // work on characters override this to avoid decoding again.
+   virtual void Print(int line, const std::u32string &text) {
+      Print(line, utf8_encode(text));
+   }
+   // Print a line that is scrolled by the given scroller. Displays that
+   // can scroll by themselves look at the whole scroll content.
+   virtual void PrintScrolled(int line, const Scroller &scroller) {
+      Print(line, scroller.GetScrolledContent());
+   }
+
+   // Displays that can show scrolling in finer steps than characters
+   // return how many sub-frames they'd like between two frames that are
+   // the given milliseconds apart. PrintSubFrame(step, sub_frames) then
+   // shows step 1..sub_frames of the way to the next scroll position.
+   virtual int SubFrames(int) const { return 0; }
+   virtual void PrintSubFrame(int, int) {}
+
+   // Advance the animations; the next frame shows the result. Called by
+   // the main loop, each at its own rate.
+   virtual void ScrollTick();
+   virtual void BlinkTick();
+
+   // Displays with keys check them with PollKeys(), more often than frames
+   // are drawn.
+   virtual bool has_keys() const { return false; }
+   virtual void PollKeys(RendererState *) {}
+
+   // Whether the play time is shown, so a frame is needed whenever its
+   // second changes.
+   virtual bool shows_play_time() const { return false; }
+
+   // Play time to show, in seconds, if known better than from the last
+   // reported value. Call after fillVars().
+   void SetPlayTime(int seconds) { time = seconds; }
+
    virtual void noRendererPrint();
    virtual void rendererPrint( RendererState* current_state_ );
    virtual void goodBye();
    virtual void SaveScreen() {}
 
+   // All Print() calls between BeginFrame() and EndFrame() belong to the
+   // same screen update. Displays may defer output until EndFrame() to plan
+   // the whole screen at once. Print() outside a frame takes effect directly.
+   virtual void BeginFrame() {}
+   virtual void EndFrame() {}
+
    void fillVars(RendererState* state);
 
 protected:
    const std::string& player_match_name_;
-   std::string player_name;
-   std::string title, composer, artist, album;
+   DisplayText player_name;
+   DisplayText title, composer, artist, album;
    std::string play_state;
    std::string volume, previous_volume;
    int track_time;
    int time;
    bool muted;
-   Scroller first_line_scroller {"  -  "};
-   Scroller second_line_scroller {"  -  "};
-   int volume_countdown;
+   Scroller first_line_scroller {U"  -  "};
+   Scroller second_line_scroller {U"  -  "};
+   int64_t volume_flash_until;   // CLOCK_MONOTONIC milliseconds.
    uint8_t blink_time;
 
 private:
    int parseTime(const std::string &upnp_time);
-   std::string formatTime(int time);
-   void CenterAlign(std::string *to_print, int width);
-   void RightAlign(std::string *to_print, int width);
+   std::u32string formatTime(int time);
+   void CenterAlign(std::u32string *to_print, int width);
+   void RightAlign(std::u32string *to_print, int width);
 };
 
 // Very simple implementation of the above, mostly for debugging. Just prints
@@ -72,6 +153,7 @@ class ConsolePrinter : public Printer {
 public:
    explicit ConsolePrinter(const std::string& match_name, int width) : Printer(match_name), width_(width) {}
    virtual int width() const { return width_; }
+   using Printer::Print;
    virtual void Print(int line, const std::string &text);
 
 private:
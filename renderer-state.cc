@@ -20,12 +20,16 @@
 #include <stdio.h>
 #include <string.h>
 #include <iostream>
+#include <mutex>
+#include <set>
 
 #include <upnp.h>
 #include <upnptools.h>
 #include <ithread.h>
 
+#include "logging.h"
 #include "renderer-state.h"
+#include "trace-events.h"
 
 // Prefix, as these can be followed by changing version number.
 static const char kTransportServicePrefix[] =
@@ -64,24 +68,43 @@ static const char *find_first_content(IXML_Document *doc, const char *name) {
   return result;
 }
 
-RendererState::RendererState(UpnpClient_Handle device_, const char *uuid)
-  : upnp_controller(device_),
-    uuid_(uuid), descriptor_(NULL), subscriptions_(NULL),
-    last_event_update_(time(NULL)) {
+// Each renderer counts in its own series, up to a limit; the rest share
+// one. Series are never freed, so a network with many renderers would
+// otherwise use up the room for metrics.
+static const size_t kMaxRendererSeries = 32;
+
+static std::string RendererLabel(const char *uuid) {
+  static std::mutex mutex;
+  static std::set<std::string> labelled;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (labelled.count(uuid) == 0) {
+    if (labelled.size() == kMaxRendererSeries)
+      return MetricLabel("renderer", "other");
+    labelled.insert(uuid);
+  }
+  return MetricLabel("renderer", uuid);
+}
+
+RendererState::RendererState(UpnpClient_Handle device_, const char *uuid,
+                             UpnpBackend *backend)
+  : upnp_controller(device_), backend_(backend),
+    uuid_(uuid),
+    events_received_("upnp_display_events_received_total",
+                     "Events received from the renderer.",
+                     RendererLabel(uuid)),
+    descriptor_(NULL), subscriptions_(NULL),
+    last_event_update_(time(NULL)), event_pending_(false) {
   ithread_mutex_init(&variable_mutex_, NULL);
 }
 
 RendererState::~RendererState() {
   if (descriptor_) ixmlDocument_free(descriptor_);
-  for (size_t i = 0; i < subscription_ids_.size(); ++i) {
-    subscriptions_->erase(subscription_ids_[i]);
-  }
 }
 
 bool RendererState::InitDescription(const char *description_url) {
   assert(descriptor_ == NULL);  // call this only once.
-  if (UpnpDownloadXmlDoc(description_url, &descriptor_) != UPNP_E_SUCCESS) {
-    fprintf(stderr, "Can't read service description: %s\n", description_url);
+  if (backend_->DownloadXmlDoc(description_url, &descriptor_) != UPNP_E_SUCCESS) {
+    LOG(kLogError, "Can't read service description: %s", description_url);
     return false;
   }
 
@@ -121,8 +144,8 @@ bool RendererState::SubscribeTo(SubscriptionMap *submap) {
   service_list = ixmlDocument_getElementsByTagName(descriptor_, "serviceList");
 
   if (service_list == NULL) {
-    fprintf(stderr, "No services found for %s (%s)\n",
-            friendly_name_.c_str(), uuid_.c_str());
+    LOG(kLogError, "No services found for %s (%s)",
+        friendly_name_.c_str(), uuid_.c_str());
     return false;
   }
   IXML_NodeList *service_it = NULL;
@@ -156,14 +179,13 @@ bool RendererState::Subscribe(UpnpClient_Handle upnp_controller,
   std::string url = base_url_ + (event_url + 1);
   int timeout;
   Upnp_SID sid;
-  int rc = UpnpSubscribe(upnp_controller, url.c_str(), &timeout, sid);
+  int rc = backend_->Subscribe(upnp_controller, url.c_str(), &timeout, sid);
   if (rc == UPNP_E_SUCCESS) {
     subscriptions_->insert(std::make_pair(sid, this));
-    subscription_ids_.push_back(sid);
   } else {
-    fprintf(stderr, "Subscribe: %s %s %s rc=%d\n",
-            friendly_name_.c_str(),
-            service_type, UpnpGetErrorMessage(rc), rc);
+    LOG(kLogError, "Subscribe: %s %s %s rc=%d",
+        friendly_name_.c_str(),
+        service_type, UpnpGetErrorMessage(rc), rc);
     return false;
   }
   return true;
@@ -180,6 +202,21 @@ std::string RendererState::GetVar(const std::string &name) const {
   return result;
 }
 
+static int64_t MonotonicNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+bool RendererState::TakeEventTimestamps(EventTimestamps *timestamps) {
+  ithread_mutex_lock(&variable_mutex_);
+  const bool result = event_pending_;
+  if (result) *timestamps = pending_event_;
+  event_pending_ = false;
+  ithread_mutex_unlock(&variable_mutex_);
+  return result;
+}
+
 time_t RendererState::last_event_update() const {
   ithread_mutex_lock(&variable_mutex_);
   time_t result = last_event_update_;
@@ -188,6 +225,7 @@ time_t RendererState::last_event_update() const {
 }
 
 void RendererState::DecodeMetaAndInsertData_Locked(const char *didl_xml) {
+  TraceSpan span("DecodeMetaAndInsertData_Locked");
   variables_["Meta_Title"] = "";
   variables_["Meta_Artist"] = "";
   variables_["Meta_Composer"] = "";
@@ -255,13 +293,25 @@ void RendererState::DecodeMetaAndInsertData_Locked(const char *didl_xml) {
   ixmlDocument_free(doc);
 }
 
-void RendererState::ReceiveEvent(const UpnpEvent *data) {
-    const char *as_string = find_first_content(
-        UpnpEvent_get_ChangedVariables(data), "LastChange");
+static const MetricDuration event_parse_seconds(
+  "upnp_display_event_parse_seconds", "Time to decode the XML of an event.");
+
+void RendererState::ReceiveEvent(const UpnpEvent *data,
+                                 int64_t received_nanos) {
+  TraceSpan span("ReceiveEvent");
+  events_received_.Add();
+  const char *as_string = find_first_content(
+    UpnpEvent_get_ChangedVariables(data), "LastChange");
+  ReceiveLastChange(as_string, received_nanos);
+}
+
+void RendererState::ReceiveLastChange(const char *as_string,
+                                      int64_t received_nanos) {
   //fprintf(stderr, "Got variable changes: %s\n", as_string);
+  if (as_string == NULL) return;
   IXML_Document *doc = ixmlParseBuffer(as_string);
   if (doc == NULL) {
-    fprintf(stderr, "Invalid XML\n");
+    LOG(kLogWarning, "Invalid XML");
     return;
   }
   IXML_NodeList *instance_list = NULL;
@@ -270,6 +320,8 @@ void RendererState::ReceiveEvent(const UpnpEvent *data) {
   IXML_Node *instance_element = instance_list->nodeItem;  // interested in 1st
   ixmlNodeList_free(instance_list);
   IXML_NodeList *variable_list = ixmlNode_getChildNodes(instance_element);
+  const int64_t parsed_nanos = MonotonicNanos();
+  event_parse_seconds.Record(parsed_nanos - received_nanos);
   ithread_mutex_lock(&variable_mutex_);
   for (const IXML_NodeList *it = variable_list; it; it = it->next) {
     const char *name = ixmlNode_getNodeName(it->nodeItem);
@@ -281,6 +333,14 @@ void RendererState::ReceiveEvent(const UpnpEvent *data) {
     }
   }
   last_event_update_ = time(NULL);
+  // If the display didn't pick up the previous one yet, this one will be
+  // shown with it; the latency counts from the first.
+  if (!event_pending_) {
+    event_pending_ = true;
+    pending_event_.received = received_nanos;
+    pending_event_.parsed = parsed_nanos;
+    pending_event_.published = MonotonicNanos();
+  }
   ithread_mutex_unlock(&variable_mutex_);
   ixmlNodeList_free(variable_list);
   ixmlDocument_free(doc);
@@ -345,8 +405,33 @@ void RendererState::Stop() {
 static std::array<std::string, 1> service_types = { "urn:schemas-upnp-org:service:AVTransport:1" };
 static std::array<std::string, 4> actions = { "GetPositionInfo", "Play", "Pause", "Stop" };
 
+struct ActionMetrics {
+  MetricDuration seconds;
+  MetricCounter failures;
+};
+
+// Registered at startup like the other metrics, so that they have their
+// room before any renderer shows up.
+static const std::vector<ActionMetrics> action_metrics = []() {
+  std::vector<ActionMetrics> result;
+  for (const std::string &name : actions) {
+    const std::string label = MetricLabel("action", name);
+    result.push_back({
+        MetricDuration("upnp_display_soap_action_seconds",
+                       "Round trip time of SOAP actions.", label),
+        MetricCounter("upnp_display_soap_action_failures_total",
+                      "SOAP actions that did not succeed.", label) });
+  }
+  return result;
+}();
+
+static const ActionMetrics &MetricsFor(int action) {
+  return action_metrics[action];
+}
+
 int RendererState::SendActionTest( int service_type, int action,
 		std::vector<std::pair<std::string, std::string>>& params ) {
+   TraceSpan span("SendActionTest");
 
    IXML_Document* doc = nullptr;
    response = nullptr;
@@ -368,7 +453,7 @@ int RendererState::SendActionTest( int service_type, int action,
                paramName,
                paramValue) != UPNP_E_SUCCESS) {
 
-          printf("ERROR param %s,%s!\n", paramName, paramValue);
+          LOG(kLogError, "ERROR param %s,%s!", paramName, paramValue);
       }
    }
 
@@ -384,13 +469,17 @@ int RendererState::SendActionTest( int service_type, int action,
 
       action_url.append(control_url_);
 
-      rc = UpnpSendAction(upnp_controller,
-                    action_url.c_str(), service_str,
-                    nullptr, doc, &response);
+      const int64_t start_nanos = MonotonicNanos();
+      rc = backend_->SendAction(upnp_controller,
+                                action_url.c_str(), service_str,
+                                doc, &response);
+      MetricsFor(action).seconds.Record(MonotonicNanos() - start_nanos);
 
       ixmlDocument_free(doc);
    }
 
+   if (rc != UPNP_E_SUCCESS) MetricsFor(action).failures.Add();
+
    //std::cout << "SendAction[" << action_str << "] : " << rc  << std::endl;
 
    return rc;
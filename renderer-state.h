@@ -27,12 +27,19 @@
 #include <time.h>
 #include <upnp.h>
 
+#include "latency-stats.h"
+#include "metrics.h"
+#include "upnp-backend.h"
+
 // Representing the state for a particular renderer.
 class RendererState {
 public:
   typedef std::map<std::string, RendererState *> SubscriptionMap;
 
-  RendererState(UpnpClient_Handle device_, const char *uuid);
+  // "uuid" is the UDN of the renderer device, which stays the same when its
+  // address changes. All requests to the renderer go through "backend".
+  RendererState(UpnpClient_Handle device_, const char *uuid,
+                UpnpBackend *backend = LibUpnpBackend());
   ~RendererState();
 
   // -- method calls interesting for users.
@@ -45,6 +52,11 @@ public:
 
   time_t last_event_update() const;
 
+  // Timestamps of the oldest event that changed variables since the last
+  // call. Returns 'false' if there was none.
+  // Thread safe.
+  bool TakeEventTimestamps(EventTimestamps *timestamps);
+
   // -- method calls used for internal upnp subscription management.
 
   // Initialize from descriptor url that points to an XML file describing
@@ -56,8 +68,12 @@ public:
   // It breaks the encapsulation that this stores itself in the subscription_map.
   bool SubscribeTo(SubscriptionMap *subscription_map);
 
-  // Callback from controller when changed variables arrive.
-  void ReceiveEvent(const UpnpEvent *data);
+  // Callback from controller when changed variables arrive. "received_nanos"
+  // is the CLOCK_MONOTONIC time the event came in.
+  void ReceiveEvent(const UpnpEvent *data, int64_t received_nanos);
+
+  // The variables of a LastChange event, given as its XML text.
+  void ReceiveLastChange(const char *last_change_xml, int64_t received_nanos);
 
 //PGAD
 void Play();
@@ -80,7 +96,9 @@ private:
   void SendActionParamInstance( int actionIndex );
 
   UpnpClient_Handle upnp_controller;
+  UpnpBackend *const backend_;
   const std::string uuid_;
+  const MetricCounter events_received_;
   std::string friendly_name_;
   std::string base_url_;
   std::string control_url_;
@@ -88,11 +106,11 @@ private:
   IXML_Document *descriptor_;      // owned. Initialized in InitDescription()
   SubscriptionMap *subscriptions_; // not owned. Initialized in SubscribeTo()
 
-  std::vector<std::string> subscription_ids_;
-
   mutable ithread_mutex_t variable_mutex_;
   typedef std::map<std::string, std::string> VariableMap;
   time_t last_event_update_;
   VariableMap variables_;
+  bool event_pending_;
+  EventTimestamps pending_event_;
 };
 #endif // RENDERER_STATE_H
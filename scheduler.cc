@@ -0,0 +1,192 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "scheduler.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "logging.h"
+#include "metrics.h"
+
+static const int64_t kTickNanos = Scheduler::kTickMillis * 1000000LL;
+
+static const MetricCounter missed_deadlines(
+  "upnp_display_scheduler_missed_deadlines_total",
+  "Tasks that ran more than a tick after they were due.");
+
+static int64_t MonotonicNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+Scheduler::Scheduler()
+  : timer_fd_(-1), start_nanos_(0), current_tick_(0),
+    batch_due_nanos_(0), batch_woke_nanos_(0) {}
+
+Scheduler::~Scheduler() {
+  for (int level = 0; level < kLevels; ++level) {
+    for (int slot = 0; slot < kSlots; ++slot) {
+      for (Entry *entry : wheel_[level][slot]) delete entry;
+    }
+  }
+  if (timer_fd_ >= 0) close(timer_fd_);
+}
+
+bool Scheduler::Init() {
+  timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+  if (timer_fd_ < 0) {
+    LOG(kLogError, "Scheduler: timerfd_create(): %s", strerror(errno));
+    return false;
+  }
+  start_nanos_ = MonotonicNanos();
+  current_tick_ = 0;
+  return true;
+}
+
+static int64_t MillisToTicks(int millis) {
+  const int64_t ticks = (millis + Scheduler::kTickMillis / 2)
+    / Scheduler::kTickMillis;
+  return ticks > 0 ? ticks : 1;
+}
+
+void Scheduler::Every(int period_millis, const Task &task) {
+  // Relative to the tick to be processed next, not to the clock, so tasks
+  // registered together with periods that are multiples of each other
+  // become due at the same ticks.
+  const int64_t period = MillisToTicks(period_millis);
+  Insert(new Entry{current_tick_ + period, period, task});
+}
+
+void Scheduler::After(int delay_millis, const Task &task) {
+  Insert(new Entry{current_tick_ + MillisToTicks(delay_millis), 0, task});
+}
+
+void Scheduler::At(int64_t monotonic_nanos, const Task &task) {
+  const int64_t tick = (monotonic_nanos - start_nanos_ + kTickNanos - 1)
+    / kTickNanos;
+  Insert(new Entry{tick, 0, task});
+}
+
+// An entry goes to the lowest level whose slots cover its due tick in the
+// current revolution, so level 0 only has entries due within the current
+// 64 ticks. Entries too far in the future for the top level are cascaded
+// one revolution early and inserted again.
+void Scheduler::Insert(Entry *entry) {
+  if (entry->due < current_tick_) entry->due = current_tick_;
+  int level = 0;
+  while (level < kLevels - 1
+         && (entry->due >> (kSlotBits * (level + 1)))
+         != (current_tick_ >> (kSlotBits * (level + 1)))) {
+    ++level;
+  }
+  const int slot = (entry->due >> (kSlotBits * level)) & (kSlots - 1);
+  wheel_[level][slot].push_back(entry);
+}
+
+void Scheduler::Cascade(int level, int64_t tick) {
+  std::vector<Entry*> entries;
+  entries.swap(wheel_[level][(tick >> (kSlotBits * level)) & (kSlots - 1)]);
+  for (Entry *entry : entries) {
+    Insert(entry);
+  }
+}
+
+void Scheduler::RunDueTasks() {
+  const int64_t woke = MonotonicNanos();
+  const int64_t now = (woke - start_nanos_) / kTickNanos;
+  std::vector<Entry*> due;
+  for (; current_tick_ <= now; ++current_tick_) {
+    // When a lower level wraps around, move the entries of the next slot of
+    // the level above down, starting at the top.
+    for (int level = kLevels - 1; level > 0; --level) {
+      if ((current_tick_ & ((1LL << (kSlotBits * level)) - 1)) == 0) {
+        Cascade(level, current_tick_);
+      }
+    }
+    std::vector<Entry*> &slot = wheel_[0][current_tick_ & (kSlots - 1)];
+    due.insert(due.end(), slot.begin(), slot.end());
+    slot.clear();
+  }
+
+  if (due.empty()) return;
+  int64_t earliest = due[0]->due;
+  for (Entry *entry : due) {
+    if (entry->due < earliest) earliest = entry->due;
+  }
+  batch_due_nanos_ = start_nanos_ + earliest * kTickNanos;
+  batch_woke_nanos_ = woke;
+
+  for (Entry *entry : due) {
+    if (entry->due < now - 1) missed_deadlines.Add();
+    entry->task();
+    if (entry->period == 0) {
+      delete entry;
+      continue;
+    }
+    entry->due += entry->period;
+    if (entry->due < current_tick_) {   // We're late; skip missed runs.
+      entry->due += ((current_tick_ - entry->due + entry->period - 1)
+                     / entry->period) * entry->period;
+    }
+    Insert(entry);
+  }
+  if (batch_done_) {
+    batch_done_();
+  }
+}
+
+void Scheduler::ArmTimer() {
+  // The first non-empty slot in level 0. If there is none, wake up where
+  // level 0 wraps around and entries from the level above move down.
+  int64_t next = (current_tick_ | (kSlots - 1)) + 1;
+  if ((current_tick_ & (kSlots - 1)) == 0) {
+    next = current_tick_;    // Not cascaded yet.
+  } else {
+    for (int64_t tick = current_tick_; tick < next; ++tick) {
+      if (!wheel_[0][tick & (kSlots - 1)].empty()) {
+        next = tick;
+        break;
+      }
+    }
+  }
+  const int64_t at = start_nanos_ + next * kTickNanos;
+  struct itimerspec spec;
+  memset(&spec, 0, sizeof(spec));
+  spec.it_value.tv_sec = at / 1000000000LL;
+  spec.it_value.tv_nsec = at % 1000000000LL;
+  if (timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, NULL) < 0) {
+    LOG(kLogError, "Scheduler: timerfd_settime(): %s", strerror(errno));
+  }
+}
+
+void Scheduler::Run(volatile bool *stop) {
+  while (!*stop) {
+    ArmTimer();
+    uint64_t expirations;
+    if (read(timer_fd_, &expirations, sizeof(expirations)) < 0
+        && errno != EINTR) {
+      LOG(kLogError, "Scheduler: reading timer: %s", strerror(errno));
+      return;
+    }
+    RunDueTasks();
+  }
+}
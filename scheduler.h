@@ -0,0 +1,98 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_SCHEDULER_H
+#define UPNP_DISPLAY_SCHEDULER_H
+
+#include <stdint.h>
+
+#include <functional>
+#include <vector>
+
+// Runs tasks, each at its own period, from a single thread.
+//
+// Deadlines are kept in a hierarchical timer wheel with a resolution of
+// kTickMillis. A timerfd wakes us up only when the next task is due (or
+// when the wheel has to move tasks closer to expiry), not every tick.
+// All tasks due at the same time run together, followed by one call of the
+// batch function; that is where a display draws its frame, so a scroll step
+// and a blink that coincide are one update.
+//
+// Periodic tasks keep their phase: a late wakeup doesn't shift later runs,
+// runs that were missed entirely are skipped.
+class Scheduler {
+public:
+  typedef std::function<void()> Task;
+
+  static const int kTickMillis = 5;
+
+  Scheduler();
+  ~Scheduler();
+
+  // Sets up the timer; prints the problem and returns 'false' on failure.
+  bool Init();
+
+  // Run "task" every "period_millis", first after one period. Periods are
+  // rounded to ticks.
+  void Every(int period_millis, const Task &task);
+
+  // Run "task" once, after "delay_millis".
+  void After(int delay_millis, const Task &task);
+
+  // Run "task" once at the given CLOCK_MONOTONIC time, rounded up to the
+  // next tick. If that has passed, at the next wakeup.
+  void At(int64_t monotonic_nanos, const Task &task);
+
+  // Called after all tasks that were due at a wakeup have run.
+  void SetBatchDone(const Task &done) { batch_done_ = done; }
+
+  // CLOCK_MONOTONIC time the earliest task of the current batch was due,
+  // and when we woke up to run it; to see how late we are.
+  int64_t batch_due_nanos() const { return batch_due_nanos_; }
+  int64_t batch_woke_nanos() const { return batch_woke_nanos_; }
+
+  // Run tasks until "*stop" is set. It is checked after every wakeup.
+  void Run(volatile bool *stop);
+
+private:
+  struct Entry {
+    int64_t due;           // tick
+    int64_t period;        // ticks; 0 for tasks that run once.
+    Task task;
+  };
+
+  // Three levels of 64 slots; with 5ms ticks that covers about 20 minutes.
+  static const int kSlotBits = 6;
+  static const int kSlots = 1 << kSlotBits;
+  static const int kLevels = 3;
+
+  void Insert(Entry *entry);
+  void Cascade(int level, int64_t tick);
+
+  // Process all ticks up to now and run what is due.
+  void RunDueTasks();
+  // Program the timer for the next tick that has something to do.
+  void ArmTimer();
+
+  int timer_fd_;
+  int64_t start_nanos_;
+  int64_t current_tick_;       // ticks before this one have been processed.
+  std::vector<Entry*> wheel_[kLevels][kSlots];
+  Task batch_done_;
+  int64_t batch_due_nanos_;
+  int64_t batch_woke_nanos_;
+};
+
+#endif  // UPNP_DISPLAY_SCHEDULER_H
@@ -18,56 +18,36 @@
 
 #include "scroller.h"
 
-#include "utf8.h"
-
 static const int kBorderWait = 4;  // ticks to wait at end-of-scroll
 
-Scroller::Scroller(const std::string &interlude)
-  : interlude_(interlude), characters_on_screen_(0), scroll_timeout_(0) {}
-
-void Scroller::InitIterators() {
-  print_start_ = scroll_content_.begin();
-  print_end_ = print_start_;
-  int i;
-  for (i = 0;
-       i < width_ && print_end_ != scroll_content_.end();
-       ++i, utf8_next_codepoint(print_end_)) {
-  }
-  characters_on_screen_ = i;
-}
+Scroller::Scroller(const std::u32string &interlude)
+  : interlude_(interlude), width_(0), scrolling_needed_(false),
+    print_start_(0), scroll_timeout_(0) {}
 
-void Scroller::SetValue(std::string &content, int width) {
+void Scroller::SetValue(const std::u32string &content, int width) {
   if (content != orig_content_ || width != width_) {
     orig_content_ = content;
-    scroll_content_ = orig_content_;
     width_ = width;
-    InitIterators();
-    scrolling_needed_ = (print_end_ != scroll_content_.end());
+    scrolling_needed_ = ((int) orig_content_.length() > width_);
+    scroll_content_ = orig_content_;
     if (scrolling_needed_) {
-      scroll_content_ = orig_content_ + interlude_;
-      InitIterators();
+      scroll_content_ += interlude_;
     }
-    end_of_content_ = scroll_content_.begin() + orig_content_.length();
+    print_start_ = 0;
     scroll_timeout_ = kBorderWait;
   }
 }
 
-std::string Scroller::GetScrolledContent() {
-  std::string result;
-  result.append(print_start_, print_end_);
+std::u32string Scroller::GetScrolledContent() const {
+  std::u32string result = scroll_content_.substr(print_start_, width_);
   if (!scrolling_needed_)
     return result;
 
-  int char_printed = characters_on_screen_;
   // Reached end of scroll content. If there is still space, print the beginng
-  // again. We know already that this will never reach end(), so no need to check
-  std::string::iterator print_prefix = scroll_content_.begin();
-  while (char_printed < width_) {
-    ++char_printed;
-    utf8_next_codepoint(print_prefix);
+  // again. Content is longer than the width, so this never wraps twice.
+  if ((int) result.length() < width_) {
+    result.append(scroll_content_, 0, width_ - result.length());
   }
-  result.append(scroll_content_.begin(), print_prefix);
-
   return result;
 }
 
@@ -78,17 +58,12 @@ void Scroller::NextTick() {
   if (scroll_timeout_ > 0) {
     scroll_timeout_--;
   } else {
-    utf8_next_codepoint(print_start_);
-    --characters_on_screen_;   // one reduced in front
-    if (print_start_ == scroll_content_.end()) {
-      InitIterators();
+    ++print_start_;
+    if (print_start_ == (int) scroll_content_.length()) {
+      print_start_ = 0;
       scroll_timeout_ = kBorderWait;
-    } else if (print_end_ != scroll_content_.end()) {
-      utf8_next_codepoint(print_end_);
-      ++characters_on_screen_; // one added at end.
-      if (print_end_ == end_of_content_) {
-        scroll_timeout_ = kBorderWait;
-      }
+    } else if (print_start_ + width_ == (int) orig_content_.length()) {
+      scroll_timeout_ = kBorderWait;   // end of content reached right border.
     }
   }
 }
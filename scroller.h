@@ -21,39 +21,46 @@
 
 #include <string>
 
-// Utility class that implements the scrolling logic.
+// Utility class that implements the scrolling logic. Works on decoded
+// codepoints, so the scroll position is a plain index.
 class Scroller {
 public:
   // Create Scroller that uses given interlude to separate infinit-scroll text.
-  explicit Scroller(const std::string &interlude);
+  explicit Scroller(const std::u32string &interlude);
 
   // Set text value to be scrolled and the display width available.
   // If the value or width is different from a previously set value, the scroll
   // position is set to the beginning of the string.
-  void SetValue(std::string &content, int width);
+  void SetValue(const std::u32string &content, int width);
 
   // Returns the scrolled content.
-  std::string GetScrolledContent();
+  std::u32string GetScrolledContent() const;
+
+  // The text scrolled through, including interlude, and the
+  // index of the first visible character. GetScrolledContent() shows
+  // "width" characters of it from that index, wrapping around.
+  bool scrolling() const { return scrolling_needed_; }
+  const std::u32string &scroll_content() const { return scroll_content_; }
+  int position() const { return print_start_; }
+
+  // Whether the next NextTick() advances the position.
+  bool moves_on_next_tick() const {
+    return scrolling_needed_ && scroll_timeout_ == 0;
+  }
 
   // Next time tick to advance position according to internal state.
   void NextTick();
 
 private:
-  void InitIterators();
-
-  const std::string interlude_;
+  const std::u32string interlude_;
 
   int width_;
-  std::string orig_content_;
+  std::u32string orig_content_;
   bool scrolling_needed_;         // If text is short, this won't need scrolling.
 
-  std::string scroll_content_;    // scrollable content, including interlude.
-
-  std::string::const_iterator print_start_;
-  std::string::const_iterator print_end_;
-  std::string::const_iterator end_of_content_;  // before interlude. Wait there.
+  std::u32string scroll_content_; // scrollable content, including interlude.
 
-  int characters_on_screen_; // portion shown; characters, not bytes.
+  int print_start_;               // index of first character on screen.
   int scroll_timeout_;
 };
 
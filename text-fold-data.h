@@ -0,0 +1,2909 @@
+// Generated by font/unicode2c.py from Unicode 14.0.0. Do not edit.
+// Included by text-fold.cc only.
+
+constexpr CombiningClassRange kCombiningClasses[] = {
+  { 0x0300, 0x0314, 230 },
+  { 0x0315, 0x0315, 232 },
+  { 0x0316, 0x0319, 220 },
+  { 0x031A, 0x031A, 232 },
+  { 0x031B, 0x031B, 216 },
+  { 0x031C, 0x0320, 220 },
+  { 0x0321, 0x0322, 202 },
+  { 0x0323, 0x0326, 220 },
+  { 0x0327, 0x0328, 202 },
+  { 0x0329, 0x0333, 220 },
+  { 0x0334, 0x0338, 1 },
+  { 0x0339, 0x033C, 220 },
+  { 0x033D, 0x0344, 230 },
+  { 0x0345, 0x0345, 240 },
+  { 0x0346, 0x0346, 230 },
+  { 0x0347, 0x0349, 220 },
+  { 0x034A, 0x034C, 230 },
+  { 0x034D, 0x034E, 220 },
+  { 0x0350, 0x0352, 230 },
+  { 0x0353, 0x0356, 220 },
+  { 0x0357, 0x0357, 230 },
+  { 0x0358, 0x0358, 232 },
+  { 0x0359, 0x035A, 220 },
+  { 0x035B, 0x035B, 230 },
+  { 0x035C, 0x035C, 233 },
+  { 0x035D, 0x035E, 234 },
+  { 0x035F, 0x035F, 233 },
+  { 0x0360, 0x0361, 234 },
+  { 0x0362, 0x0362, 233 },
+  { 0x0363, 0x036F, 230 },
+  { 0x0483, 0x0487, 230 },
+  { 0x0591, 0x0591, 220 },
+  { 0x0592, 0x0595, 230 },
+  { 0x0596, 0x0596, 220 },
+  { 0x0597, 0x0599, 230 },
+  { 0x059A, 0x059A, 222 },
+  { 0x059B, 0x059B, 220 },
+  { 0x059C, 0x05A1, 230 },
+  { 0x05A2, 0x05A7, 220 },
+  { 0x05A8, 0x05A9, 230 },
+  { 0x05AA, 0x05AA, 220 },
+  { 0x05AB, 0x05AC, 230 },
+  { 0x05AD, 0x05AD, 222 },
+  { 0x05AE, 0x05AE, 228 },
+  { 0x05AF, 0x05AF, 230 },
+  { 0x05B0, 0x05B0, 10 },
+  { 0x05B1, 0x05B1, 11 },
+  { 0x05B2, 0x05B2, 12 },
+  { 0x05B3, 0x05B3, 13 },
+  { 0x05B4, 0x05B4, 14 },
+  { 0x05B5, 0x05B5, 15 },
+  { 0x05B6, 0x05B6, 16 },
+  { 0x05B7, 0x05B7, 17 },
+  { 0x05B8, 0x05B8, 18 },
+  { 0x05B9, 0x05BA, 19 },
+  { 0x05BB, 0x05BB, 20 },
+  { 0x05BC, 0x05BC, 21 },
+  { 0x05BD, 0x05BD, 22 },
+  { 0x05BF, 0x05BF, 23 },
+  { 0x05C1, 0x05C1, 24 },
+  { 0x05C2, 0x05C2, 25 },
+  { 0x05C4, 0x05C4, 230 },
+  { 0x05C5, 0x05C5, 220 },
+  { 0x05C7, 0x05C7, 18 },
+  { 0x0610, 0x0617, 230 },
+  { 0x0618, 0x0618, 30 },
+  { 0x0619, 0x0619, 31 },
+  { 0x061A, 0x061A, 32 },
+  { 0x064B, 0x064B, 27 },
+  { 0x064C, 0x064C, 28 },
+  { 0x064D, 0x064D, 29 },
+  { 0x064E, 0x064E, 30 },
+  { 0x064F, 0x064F, 31 },
+  { 0x0650, 0x0650, 32 },
+  { 0x0651, 0x0651, 33 },
+  { 0x0652, 0x0652, 34 },
+  { 0x0653, 0x0654, 230 },
+  { 0x0655, 0x0656, 220 },
+  { 0x0657, 0x065B, 230 },
+  { 0x065C, 0x065C, 220 },
+  { 0x065D, 0x065E, 230 },
+  { 0x065F, 0x065F, 220 },
+  { 0x0670, 0x0670, 35 },
+  { 0x06D6, 0x06DC, 230 },
+  { 0x06DF, 0x06E2, 230 },
+  { 0x06E3, 0x06E3, 220 },
+  { 0x06E4, 0x06E4, 230 },
+  { 0x06E7, 0x06E8, 230 },
+  { 0x06EA, 0x06EA, 220 },
+  { 0x06EB, 0x06EC, 230 },
+  { 0x06ED, 0x06ED, 220 },
+  { 0x0711, 0x0711, 36 },
+  { 0x0730, 0x0730, 230 },
+  { 0x0731, 0x0731, 220 },
+  { 0x0732, 0x0733, 230 },
+  { 0x0734, 0x0734, 220 },
+  { 0x0735, 0x0736, 230 },
+  { 0x0737, 0x0739, 220 },
+  { 0x073A, 0x073A, 230 },
+  { 0x073B, 0x073C, 220 },
+  { 0x073D, 0x073D, 230 },
+  { 0x073E, 0x073E, 220 },
+  { 0x073F, 0x0741, 230 },
+  { 0x0742, 0x0742, 220 },
+  { 0x0743, 0x0743, 230 },
+  { 0x0744, 0x0744, 220 },
+  { 0x0745, 0x0745, 230 },
+  { 0x0746, 0x0746, 220 },
+  { 0x0747, 0x0747, 230 },
+  { 0x0748, 0x0748, 220 },
+  { 0x0749, 0x074A, 230 },
+  { 0x07EB, 0x07F1, 230 },
+  { 0x07F2, 0x07F2, 220 },
+  { 0x07F3, 0x07F3, 230 },
+  { 0x07FD, 0x07FD, 220 },
+  { 0x0816, 0x0819, 230 },
+  { 0x081B, 0x0823, 230 },
+  { 0x0825, 0x0827, 230 },
+  { 0x0829, 0x082D, 230 },
+  { 0x0859, 0x085B, 220 },
+  { 0x0898, 0x0898, 230 },
+  { 0x0899, 0x089B, 220 },
+  { 0x089C, 0x089F, 230 },
+  { 0x08CA, 0x08CE, 230 },
+  { 0x08CF, 0x08D3, 220 },
+  { 0x08D4, 0x08E1, 230 },
+  { 0x08E3, 0x08E3, 220 },
+  { 0x08E4, 0x08E5, 230 },
+  { 0x08E6, 0x08E6, 220 },
+  { 0x08E7, 0x08E8, 230 },
+  { 0x08E9, 0x08E9, 220 },
+  { 0x08EA, 0x08EC, 230 },
+  { 0x08ED, 0x08EF, 220 },
+  { 0x08F0, 0x08F0, 27 },
+  { 0x08F1, 0x08F1, 28 },
+  { 0x08F2, 0x08F2, 29 },
+  { 0x08F3, 0x08F5, 230 },
+  { 0x08F6, 0x08F6, 220 },
+  { 0x08F7, 0x08F8, 230 },
+  { 0x08F9, 0x08FA, 220 },
+  { 0x08FB, 0x08FF, 230 },
+  { 0x093C, 0x093C, 7 },
+  { 0x094D, 0x094D, 9 },
+  { 0x0951, 0x0951, 230 },
+  { 0x0952, 0x0952, 220 },
+  { 0x0953, 0x0954, 230 },
+  { 0x09BC, 0x09BC, 7 },
+  { 0x09CD, 0x09CD, 9 },
+  { 0x09FE, 0x09FE, 230 },
+  { 0x0A3C, 0x0A3C, 7 },
+  { 0x0A4D, 0x0A4D, 9 },
+  { 0x0ABC, 0x0ABC, 7 },
+  { 0x0ACD, 0x0ACD, 9 },
+  { 0x0B3C, 0x0B3C, 7 },
+  { 0x0B4D, 0x0B4D, 9 },
+  { 0x0BCD, 0x0BCD, 9 },
+  { 0x0C3C, 0x0C3C, 7 },
+  { 0x0C4D, 0x0C4D, 9 },
+  { 0x0C55, 0x0C55, 84 },
+  { 0x0C56, 0x0C56, 91 },
+  { 0x0CBC, 0x0CBC, 7 },
+  { 0x0CCD, 0x0CCD, 9 },
+  { 0x0D3B, 0x0D3C, 9 },
+  { 0x0D4D, 0x0D4D, 9 },
+  { 0x0DCA, 0x0DCA, 9 },
+  { 0x0E38, 0x0E39, 103 },
+  { 0x0E3A, 0x0E3A, 9 },
+  { 0x0E48, 0x0E4B, 107 },
+  { 0x0EB8, 0x0EB9, 118 },
+  { 0x0EBA, 0x0EBA, 9 },
+  { 0x0EC8, 0x0ECB, 122 },
+  { 0x0F18, 0x0F19, 220 },
+  { 0x0F35, 0x0F35, 220 },
+  { 0x0F37, 0x0F37, 220 },
+  { 0x0F39, 0x0F39, 216 },
+  { 0x0F71, 0x0F71, 129 },
+  { 0x0F72, 0x0F72, 130 },
+  { 0x0F74, 0x0F74, 132 },
+  { 0x0F7A, 0x0F7D, 130 },
+  { 0x0F80, 0x0F80, 130 },
+  { 0x0F82, 0x0F83, 230 },
+  { 0x0F84, 0x0F84, 9 },
+  { 0x0F86, 0x0F87, 230 },
+  { 0x0FC6, 0x0FC6, 220 },
+  { 0x1037, 0x1037, 7 },
+  { 0x1039, 0x103A, 9 },
+  { 0x108D, 0x108D, 220 },
+  { 0x135D, 0x135F, 230 },
+  { 0x1714, 0x1715, 9 },
+  { 0x1734, 0x1734, 9 },
+  { 0x17D2, 0x17D2, 9 },
+  { 0x17DD, 0x17DD, 230 },
+  { 0x18A9, 0x18A9, 228 },
+  { 0x1939, 0x1939, 222 },
+  { 0x193A, 0x193A, 230 },
+  { 0x193B, 0x193B, 220 },
+  { 0x1A17, 0x1A17, 230 },
+  { 0x1A18, 0x1A18, 220 },
+  { 0x1A60, 0x1A60, 9 },
+  { 0x1A75, 0x1A7C, 230 },
+  { 0x1A7F, 0x1A7F, 220 },
+  { 0x1AB0, 0x1AB4, 230 },
+  { 0x1AB5, 0x1ABA, 220 },
+  { 0x1ABB, 0x1ABC, 230 },
+  { 0x1ABD, 0x1ABD, 220 },
+  { 0x1ABF, 0x1AC0, 220 },
+  { 0x1AC1, 0x1AC2, 230 },
+  { 0x1AC3, 0x1AC4, 220 },
+  { 0x1AC5, 0x1AC9, 230 },
+  { 0x1ACA, 0x1ACA, 220 },
+  { 0x1ACB, 0x1ACE, 230 },
+  { 0x1B34, 0x1B34, 7 },
+  { 0x1B44, 0x1B44, 9 },
+  { 0x1B6B, 0x1B6B, 230 },
+  { 0x1B6C, 0x1B6C, 220 },
+  { 0x1B6D, 0x1B73, 230 },
+  { 0x1BAA, 0x1BAB, 9 },
+  { 0x1BE6, 0x1BE6, 7 },
+  { 0x1BF2, 0x1BF3, 9 },
+  { 0x1C37, 0x1C37, 7 },
+  { 0x1CD0, 0x1CD2, 230 },
+  { 0x1CD4, 0x1CD4, 1 },
+  { 0x1CD5, 0x1CD9, 220 },
+  { 0x1CDA, 0x1CDB, 230 },
+  { 0x1CDC, 0x1CDF, 220 },
+  { 0x1CE0, 0x1CE0, 230 },
+  { 0x1CE2, 0x1CE8, 1 },
+  { 0x1CED, 0x1CED, 220 },
+  { 0x1CF4, 0x1CF4, 230 },
+  { 0x1CF8, 0x1CF9, 230 },
+  { 0x1DC0, 0x1DC1, 230 },
+  { 0x1DC2, 0x1DC2, 220 },
+  { 0x1DC3, 0x1DC9, 230 },
+  { 0x1DCA, 0x1DCA, 220 },
+  { 0x1DCB, 0x1DCC, 230 },
+  { 0x1DCD, 0x1DCD, 234 },
+  { 0x1DCE, 0x1DCE, 214 },
+  { 0x1DCF, 0x1DCF, 220 },
+  { 0x1DD0, 0x1DD0, 202 },
+  { 0x1DD1, 0x1DF5, 230 },
+  { 0x1DF6, 0x1DF6, 232 },
+  { 0x1DF7, 0x1DF8, 228 },
+  { 0x1DF9, 0x1DF9, 220 },
+  { 0x1DFA, 0x1DFA, 218 },
+  { 0x1DFB, 0x1DFB, 230 },
+  { 0x1DFC, 0x1DFC, 233 },
+  { 0x1DFD, 0x1DFD, 220 },
+  { 0x1DFE, 0x1DFE, 230 },
+  { 0x1DFF, 0x1DFF, 220 },
+  { 0x20D0, 0x20D1, 230 },
+  { 0x20D2, 0x20D3, 1 },
+  { 0x20D4, 0x20D7, 230 },
+  { 0x20D8, 0x20DA, 1 },
+  { 0x20DB, 0x20DC, 230 },
+  { 0x20E1, 0x20E1, 230 },
+  { 0x20E5, 0x20E6, 1 },
+  { 0x20E7, 0x20E7, 230 },
+  { 0x20E8, 0x20E8, 220 },
+  { 0x20E9, 0x20E9, 230 },
+  { 0x20EA, 0x20EB, 1 },
+  { 0x20EC, 0x20EF, 220 },
+  { 0x20F0, 0x20F0, 230 },
+  { 0x2CEF, 0x2CF1, 230 },
+  { 0x2D7F, 0x2D7F, 9 },
+  { 0x2DE0, 0x2DFF, 230 },
+  { 0x302A, 0x302A, 218 },
+  { 0x302B, 0x302B, 228 },
+  { 0x302C, 0x302C, 232 },
+  { 0x302D, 0x302D, 222 },
+  { 0x302E, 0x302F, 224 },
+  { 0x3099, 0x309A, 8 },
+  { 0xA66F, 0xA66F, 230 },
+  { 0xA674, 0xA67D, 230 },
+  { 0xA69E, 0xA69F, 230 },
+  { 0xA6F0, 0xA6F1, 230 },
+  { 0xA806, 0xA806, 9 },
+  { 0xA82C, 0xA82C, 9 },
+  { 0xA8C4, 0xA8C4, 9 },
+  { 0xA8E0, 0xA8F1, 230 },
+  { 0xA92B, 0xA92D, 220 },
+  { 0xA953, 0xA953, 9 },
+  { 0xA9B3, 0xA9B3, 7 },
+  { 0xA9C0, 0xA9C0, 9 },
+  { 0xAAB0, 0xAAB0, 230 },
+  { 0xAAB2, 0xAAB3, 230 },
+  { 0xAAB4, 0xAAB4, 220 },
+  { 0xAAB7, 0xAAB8, 230 },
+  { 0xAABE, 0xAABF, 230 },
+  { 0xAAC1, 0xAAC1, 230 },
+  { 0xAAF6, 0xAAF6, 9 },
+  { 0xABED, 0xABED, 9 },
+  { 0xFB1E, 0xFB1E, 26 },
+  { 0xFE20, 0xFE26, 230 },
+  { 0xFE27, 0xFE2D, 220 },
+  { 0xFE2E, 0xFE2F, 230 },
+};
+
+constexpr CompositionPair kCompositions[] = {
+  { 0x003C0338U, 0x226E },  // NOT LESS-THAN
+  { 0x003D0338U, 0x2260 },  // NOT EQUAL TO
+  { 0x003E0338U, 0x226F },  // NOT GREATER-THAN
+  { 0x00410300U, 0x00C0 },  // LATIN CAPITAL LETTER A WITH GRAVE
+  { 0x00410301U, 0x00C1 },  // LATIN CAPITAL LETTER A WITH ACUTE
+  { 0x00410302U, 0x00C2 },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX
+  { 0x00410303U, 0x00C3 },  // LATIN CAPITAL LETTER A WITH TILDE
+  { 0x00410304U, 0x0100 },  // LATIN CAPITAL LETTER A WITH MACRON
+  { 0x00410306U, 0x0102 },  // LATIN CAPITAL LETTER A WITH BREVE
+  { 0x00410307U, 0x0226 },  // LATIN CAPITAL LETTER A WITH DOT ABOVE
+  { 0x00410308U, 0x00C4 },  // LATIN CAPITAL LETTER A WITH DIAERESIS
+  { 0x00410309U, 0x1EA2 },  // LATIN CAPITAL LETTER A WITH HOOK ABOVE
+  { 0x0041030AU, 0x00C5 },  // LATIN CAPITAL LETTER A WITH RING ABOVE
+  { 0x0041030CU, 0x01CD },  // LATIN CAPITAL LETTER A WITH CARON
+  { 0x0041030FU, 0x0200 },  // LATIN CAPITAL LETTER A WITH DOUBLE GRAVE
+  { 0x00410311U, 0x0202 },  // LATIN CAPITAL LETTER A WITH INVERTED BREVE
+  { 0x00410323U, 0x1EA0 },  // LATIN CAPITAL LETTER A WITH DOT BELOW
+  { 0x00410325U, 0x1E00 },  // LATIN CAPITAL LETTER A WITH RING BELOW
+  { 0x00410328U, 0x0104 },  // LATIN CAPITAL LETTER A WITH OGONEK
+  { 0x00420307U, 0x1E02 },  // LATIN CAPITAL LETTER B WITH DOT ABOVE
+  { 0x00420323U, 0x1E04 },  // LATIN CAPITAL LETTER B WITH DOT BELOW
+  { 0x00420331U, 0x1E06 },  // LATIN CAPITAL LETTER B WITH LINE BELOW
+  { 0x00430301U, 0x0106 },  // LATIN CAPITAL LETTER C WITH ACUTE
+  { 0x00430302U, 0x0108 },  // LATIN CAPITAL LETTER C WITH CIRCUMFLEX
+  { 0x00430307U, 0x010A },  // LATIN CAPITAL LETTER C WITH DOT ABOVE
+  { 0x0043030CU, 0x010C },  // LATIN CAPITAL LETTER C WITH CARON
+  { 0x00430327U, 0x00C7 },  // LATIN CAPITAL LETTER C WITH CEDILLA
+  { 0x00440307U, 0x1E0A },  // LATIN CAPITAL LETTER D WITH DOT ABOVE
+  { 0x0044030CU, 0x010E },  // LATIN CAPITAL LETTER D WITH CARON
+  { 0x00440323U, 0x1E0C },  // LATIN CAPITAL LETTER D WITH DOT BELOW
+  { 0x00440327U, 0x1E10 },  // LATIN CAPITAL LETTER D WITH CEDILLA
+  { 0x0044032DU, 0x1E12 },  // LATIN CAPITAL LETTER D WITH CIRCUMFLEX BELOW
+  { 0x00440331U, 0x1E0E },  // LATIN CAPITAL LETTER D WITH LINE BELOW
+  { 0x00450300U, 0x00C8 },  // LATIN CAPITAL LETTER E WITH GRAVE
+  { 0x00450301U, 0x00C9 },  // LATIN CAPITAL LETTER E WITH ACUTE
+  { 0x00450302U, 0x00CA },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX
+  { 0x00450303U, 0x1EBC },  // LATIN CAPITAL LETTER E WITH TILDE
+  { 0x00450304U, 0x0112 },  // LATIN CAPITAL LETTER E WITH MACRON
+  { 0x00450306U, 0x0114 },  // LATIN CAPITAL LETTER E WITH BREVE
+  { 0x00450307U, 0x0116 },  // LATIN CAPITAL LETTER E WITH DOT ABOVE
+  { 0x00450308U, 0x00CB },  // LATIN CAPITAL LETTER E WITH DIAERESIS
+  { 0x00450309U, 0x1EBA },  // LATIN CAPITAL LETTER E WITH HOOK ABOVE
+  { 0x0045030CU, 0x011A },  // LATIN CAPITAL LETTER E WITH CARON
+  { 0x0045030FU, 0x0204 },  // LATIN CAPITAL LETTER E WITH DOUBLE GRAVE
+  { 0x00450311U, 0x0206 },  // LATIN CAPITAL LETTER E WITH INVERTED BREVE
+  { 0x00450323U, 0x1EB8 },  // LATIN CAPITAL LETTER E WITH DOT BELOW
+  { 0x00450327U, 0x0228 },  // LATIN CAPITAL LETTER E WITH CEDILLA
+  { 0x00450328U, 0x0118 },  // LATIN CAPITAL LETTER E WITH OGONEK
+  { 0x0045032DU, 0x1E18 },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX BELOW
+  { 0x00450330U, 0x1E1A },  // LATIN CAPITAL LETTER E WITH TILDE BELOW
+  { 0x00460307U, 0x1E1E },  // LATIN CAPITAL LETTER F WITH DOT ABOVE
+  { 0x00470301U, 0x01F4 },  // LATIN CAPITAL LETTER G WITH ACUTE
+  { 0x00470302U, 0x011C },  // LATIN CAPITAL LETTER G WITH CIRCUMFLEX
+  { 0x00470304U, 0x1E20 },  // LATIN CAPITAL LETTER G WITH MACRON
+  { 0x00470306U, 0x011E },  // LATIN CAPITAL LETTER G WITH BREVE
+  { 0x00470307U, 0x0120 },  // LATIN CAPITAL LETTER G WITH DOT ABOVE
+  { 0x0047030CU, 0x01E6 },  // LATIN CAPITAL LETTER G WITH CARON
+  { 0x00470327U, 0x0122 },  // LATIN CAPITAL LETTER G WITH CEDILLA
+  { 0x00480302U, 0x0124 },  // LATIN CAPITAL LETTER H WITH CIRCUMFLEX
+  { 0x00480307U, 0x1E22 },  // LATIN CAPITAL LETTER H WITH DOT ABOVE
+  { 0x00480308U, 0x1E26 },  // LATIN CAPITAL LETTER H WITH DIAERESIS
+  { 0x0048030CU, 0x021E },  // LATIN CAPITAL LETTER H WITH CARON
+  { 0x00480323U, 0x1E24 },  // LATIN CAPITAL LETTER H WITH DOT BELOW
+  { 0x00480327U, 0x1E28 },  // LATIN CAPITAL LETTER H WITH CEDILLA
+  { 0x0048032EU, 0x1E2A },  // LATIN CAPITAL LETTER H WITH BREVE BELOW
+  { 0x00490300U, 0x00CC },  // LATIN CAPITAL LETTER I WITH GRAVE
+  { 0x00490301U, 0x00CD },  // LATIN CAPITAL LETTER I WITH ACUTE
+  { 0x00490302U, 0x00CE },  // LATIN CAPITAL LETTER I WITH CIRCUMFLEX
+  { 0x00490303U, 0x0128 },  // LATIN CAPITAL LETTER I WITH TILDE
+  { 0x00490304U, 0x012A },  // LATIN CAPITAL LETTER I WITH MACRON
+  { 0x00490306U, 0x012C },  // LATIN CAPITAL LETTER I WITH BREVE
+  { 0x00490307U, 0x0130 },  // LATIN CAPITAL LETTER I WITH DOT ABOVE
+  { 0x00490308U, 0x00CF },  // LATIN CAPITAL LETTER I WITH DIAERESIS
+  { 0x00490309U, 0x1EC8 },  // LATIN CAPITAL LETTER I WITH HOOK ABOVE
+  { 0x0049030CU, 0x01CF },  // LATIN CAPITAL LETTER I WITH CARON
+  { 0x0049030FU, 0x0208 },  // LATIN CAPITAL LETTER I WITH DOUBLE GRAVE
+  { 0x00490311U, 0x020A },  // LATIN CAPITAL LETTER I WITH INVERTED BREVE
+  { 0x00490323U, 0x1ECA },  // LATIN CAPITAL LETTER I WITH DOT BELOW
+  { 0x00490328U, 0x012E },  // LATIN CAPITAL LETTER I WITH OGONEK
+  { 0x00490330U, 0x1E2C },  // LATIN CAPITAL LETTER I WITH TILDE BELOW
+  { 0x004A0302U, 0x0134 },  // LATIN CAPITAL LETTER J WITH CIRCUMFLEX
+  { 0x004B0301U, 0x1E30 },  // LATIN CAPITAL LETTER K WITH ACUTE
+  { 0x004B030CU, 0x01E8 },  // LATIN CAPITAL LETTER K WITH CARON
+  { 0x004B0323U, 0x1E32 },  // LATIN CAPITAL LETTER K WITH DOT BELOW
+  { 0x004B0327U, 0x0136 },  // LATIN CAPITAL LETTER K WITH CEDILLA
+  { 0x004B0331U, 0x1E34 },  // LATIN CAPITAL LETTER K WITH LINE BELOW
+  { 0x004C0301U, 0x0139 },  // LATIN CAPITAL LETTER L WITH ACUTE
+  { 0x004C030CU, 0x013D },  // LATIN CAPITAL LETTER L WITH CARON
+  { 0x004C0323U, 0x1E36 },  // LATIN CAPITAL LETTER L WITH DOT BELOW
+  { 0x004C0327U, 0x013B },  // LATIN CAPITAL LETTER L WITH CEDILLA
+  { 0x004C032DU, 0x1E3C },  // LATIN CAPITAL LETTER L WITH CIRCUMFLEX BELOW
+  { 0x004C0331U, 0x1E3A },  // LATIN CAPITAL LETTER L WITH LINE BELOW
+  { 0x004D0301U, 0x1E3E },  // LATIN CAPITAL LETTER M WITH ACUTE
+  { 0x004D0307U, 0x1E40 },  // LATIN CAPITAL LETTER M WITH DOT ABOVE
+  { 0x004D0323U, 0x1E42 },  // LATIN CAPITAL LETTER M WITH DOT BELOW
+  { 0x004E0300U, 0x01F8 },  // LATIN CAPITAL LETTER N WITH GRAVE
+  { 0x004E0301U, 0x0143 },  // LATIN CAPITAL LETTER N WITH ACUTE
+  { 0x004E0303U, 0x00D1 },  // LATIN CAPITAL LETTER N WITH TILDE
+  { 0x004E0307U, 0x1E44 },  // LATIN CAPITAL LETTER N WITH DOT ABOVE
+  { 0x004E030CU, 0x0147 },  // LATIN CAPITAL LETTER N WITH CARON
+  { 0x004E0323U, 0x1E46 },  // LATIN CAPITAL LETTER N WITH DOT BELOW
+  { 0x004E0327U, 0x0145 },  // LATIN CAPITAL LETTER N WITH CEDILLA
+  { 0x004E032DU, 0x1E4A },  // LATIN CAPITAL LETTER N WITH CIRCUMFLEX BELOW
+  { 0x004E0331U, 0x1E48 },  // LATIN CAPITAL LETTER N WITH LINE BELOW
+  { 0x004F0300U, 0x00D2 },  // LATIN CAPITAL LETTER O WITH GRAVE
+  { 0x004F0301U, 0x00D3 },  // LATIN CAPITAL LETTER O WITH ACUTE
+  { 0x004F0302U, 0x00D4 },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX
+  { 0x004F0303U, 0x00D5 },  // LATIN CAPITAL LETTER O WITH TILDE
+  { 0x004F0304U, 0x014C },  // LATIN CAPITAL LETTER O WITH MACRON
+  { 0x004F0306U, 0x014E },  // LATIN CAPITAL LETTER O WITH BREVE
+  { 0x004F0307U, 0x022E },  // LATIN CAPITAL LETTER O WITH DOT ABOVE
+  { 0x004F0308U, 0x00D6 },  // LATIN CAPITAL LETTER O WITH DIAERESIS
+  { 0x004F0309U, 0x1ECE },  // LATIN CAPITAL LETTER O WITH HOOK ABOVE
+  { 0x004F030BU, 0x0150 },  // LATIN CAPITAL LETTER O WITH DOUBLE ACUTE
+  { 0x004F030CU, 0x01D1 },  // LATIN CAPITAL LETTER O WITH CARON
+  { 0x004F030FU, 0x020C },  // LATIN CAPITAL LETTER O WITH DOUBLE GRAVE
+  { 0x004F0311U, 0x020E },  // LATIN CAPITAL LETTER O WITH INVERTED BREVE
+  { 0x004F031BU, 0x01A0 },  // LATIN CAPITAL LETTER O WITH HORN
+  { 0x004F0323U, 0x1ECC },  // LATIN CAPITAL LETTER O WITH DOT BELOW
+  { 0x004F0328U, 0x01EA },  // LATIN CAPITAL LETTER O WITH OGONEK
+  { 0x00500301U, 0x1E54 },  // LATIN CAPITAL LETTER P WITH ACUTE
+  { 0x00500307U, 0x1E56 },  // LATIN CAPITAL LETTER P WITH DOT ABOVE
+  { 0x00520301U, 0x0154 },  // LATIN CAPITAL LETTER R WITH ACUTE
+  { 0x00520307U, 0x1E58 },  // LATIN CAPITAL LETTER R WITH DOT ABOVE
+  { 0x0052030CU, 0x0158 },  // LATIN CAPITAL LETTER R WITH CARON
+  { 0x0052030FU, 0x0210 },  // LATIN CAPITAL LETTER R WITH DOUBLE GRAVE
+  { 0x00520311U, 0x0212 },  // LATIN CAPITAL LETTER R WITH INVERTED BREVE
+  { 0x00520323U, 0x1E5A },  // LATIN CAPITAL LETTER R WITH DOT BELOW
+  { 0x00520327U, 0x0156 },  // LATIN CAPITAL LETTER R WITH CEDILLA
+  { 0x00520331U, 0x1E5E },  // LATIN CAPITAL LETTER R WITH LINE BELOW
+  { 0x00530301U, 0x015A },  // LATIN CAPITAL LETTER S WITH ACUTE
+  { 0x00530302U, 0x015C },  // LATIN CAPITAL LETTER S WITH CIRCUMFLEX
+  { 0x00530307U, 0x1E60 },  // LATIN CAPITAL LETTER S WITH DOT ABOVE
+  { 0x0053030CU, 0x0160 },  // LATIN CAPITAL LETTER S WITH CARON
+  { 0x00530323U, 0x1E62 },  // LATIN CAPITAL LETTER S WITH DOT BELOW
+  { 0x00530326U, 0x0218 },  // LATIN CAPITAL LETTER S WITH COMMA BELOW
+  { 0x00530327U, 0x015E },  // LATIN CAPITAL LETTER S WITH CEDILLA
+  { 0x00540307U, 0x1E6A },  // LATIN CAPITAL LETTER T WITH DOT ABOVE
+  { 0x0054030CU, 0x0164 },  // LATIN CAPITAL LETTER T WITH CARON
+  { 0x00540323U, 0x1E6C },  // LATIN CAPITAL LETTER T WITH DOT BELOW
+  { 0x00540326U, 0x021A },  // LATIN CAPITAL LETTER T WITH COMMA BELOW
+  { 0x00540327U, 0x0162 },  // LATIN CAPITAL LETTER T WITH CEDILLA
+  { 0x0054032DU, 0x1E70 },  // LATIN CAPITAL LETTER T WITH CIRCUMFLEX BELOW
+  { 0x00540331U, 0x1E6E },  // LATIN CAPITAL LETTER T WITH LINE BELOW
+  { 0x00550300U, 0x00D9 },  // LATIN CAPITAL LETTER U WITH GRAVE
+  { 0x00550301U, 0x00DA },  // LATIN CAPITAL LETTER U WITH ACUTE
+  { 0x00550302U, 0x00DB },  // LATIN CAPITAL LETTER U WITH CIRCUMFLEX
+  { 0x00550303U, 0x0168 },  // LATIN CAPITAL LETTER U WITH TILDE
+  { 0x00550304U, 0x016A },  // LATIN CAPITAL LETTER U WITH MACRON
+  { 0x00550306U, 0x016C },  // LATIN CAPITAL LETTER U WITH BREVE
+  { 0x00550308U, 0x00DC },  // LATIN CAPITAL LETTER U WITH DIAERESIS
+  { 0x00550309U, 0x1EE6 },  // LATIN CAPITAL LETTER U WITH HOOK ABOVE
+  { 0x0055030AU, 0x016E },  // LATIN CAPITAL LETTER U WITH RING ABOVE
+  { 0x0055030BU, 0x0170 },  // LATIN CAPITAL LETTER U WITH DOUBLE ACUTE
+  { 0x0055030CU, 0x01D3 },  // LATIN CAPITAL LETTER U WITH CARON
+  { 0x0055030FU, 0x0214 },  // LATIN CAPITAL LETTER U WITH DOUBLE GRAVE
+  { 0x00550311U, 0x0216 },  // LATIN CAPITAL LETTER U WITH INVERTED BREVE
+  { 0x0055031BU, 0x01AF },  // LATIN CAPITAL LETTER U WITH HORN
+  { 0x00550323U, 0x1EE4 },  // LATIN CAPITAL LETTER U WITH DOT BELOW
+  { 0x00550324U, 0x1E72 },  // LATIN CAPITAL LETTER U WITH DIAERESIS BELOW
+  { 0x00550328U, 0x0172 },  // LATIN CAPITAL LETTER U WITH OGONEK
+  { 0x0055032DU, 0x1E76 },  // LATIN CAPITAL LETTER U WITH CIRCUMFLEX BELOW
+  { 0x00550330U, 0x1E74 },  // LATIN CAPITAL LETTER U WITH TILDE BELOW
+  { 0x00560303U, 0x1E7C },  // LATIN CAPITAL LETTER V WITH TILDE
+  { 0x00560323U, 0x1E7E },  // LATIN CAPITAL LETTER V WITH DOT BELOW
+  { 0x00570300U, 0x1E80 },  // LATIN CAPITAL LETTER W WITH GRAVE
+  { 0x00570301U, 0x1E82 },  // LATIN CAPITAL LETTER W WITH ACUTE
+  { 0x00570302U, 0x0174 },  // LATIN CAPITAL LETTER W WITH CIRCUMFLEX
+  { 0x00570307U, 0x1E86 },  // LATIN CAPITAL LETTER W WITH DOT ABOVE
+  { 0x00570308U, 0x1E84 },  // LATIN CAPITAL LETTER W WITH DIAERESIS
+  { 0x00570323U, 0x1E88 },  // LATIN CAPITAL LETTER W WITH DOT BELOW
+  { 0x00580307U, 0x1E8A },  // LATIN CAPITAL LETTER X WITH DOT ABOVE
+  { 0x00580308U, 0x1E8C },  // LATIN CAPITAL LETTER X WITH DIAERESIS
+  { 0x00590300U, 0x1EF2 },  // LATIN CAPITAL LETTER Y WITH GRAVE
+  { 0x00590301U, 0x00DD },  // LATIN CAPITAL LETTER Y WITH ACUTE
+  { 0x00590302U, 0x0176 },  // LATIN CAPITAL LETTER Y WITH CIRCUMFLEX
+  { 0x00590303U, 0x1EF8 },  // LATIN CAPITAL LETTER Y WITH TILDE
+  { 0x00590304U, 0x0232 },  // LATIN CAPITAL LETTER Y WITH MACRON
+  { 0x00590307U, 0x1E8E },  // LATIN CAPITAL LETTER Y WITH DOT ABOVE
+  { 0x00590308U, 0x0178 },  // LATIN CAPITAL LETTER Y WITH DIAERESIS
+  { 0x00590309U, 0x1EF6 },  // LATIN CAPITAL LETTER Y WITH HOOK ABOVE
+  { 0x00590323U, 0x1EF4 },  // LATIN CAPITAL LETTER Y WITH DOT BELOW
+  { 0x005A0301U, 0x0179 },  // LATIN CAPITAL LETTER Z WITH ACUTE
+  { 0x005A0302U, 0x1E90 },  // LATIN CAPITAL LETTER Z WITH CIRCUMFLEX
+  { 0x005A0307U, 0x017B },  // LATIN CAPITAL LETTER Z WITH DOT ABOVE
+  { 0x005A030CU, 0x017D },  // LATIN CAPITAL LETTER Z WITH CARON
+  { 0x005A0323U, 0x1E92 },  // LATIN CAPITAL LETTER Z WITH DOT BELOW
+  { 0x005A0331U, 0x1E94 },  // LATIN CAPITAL LETTER Z WITH LINE BELOW
+  { 0x00610300U, 0x00E0 },  // LATIN SMALL LETTER A WITH GRAVE
+  { 0x00610301U, 0x00E1 },  // LATIN SMALL LETTER A WITH ACUTE
+  { 0x00610302U, 0x00E2 },  // LATIN SMALL LETTER A WITH CIRCUMFLEX
+  { 0x00610303U, 0x00E3 },  // LATIN SMALL LETTER A WITH TILDE
+  { 0x00610304U, 0x0101 },  // LATIN SMALL LETTER A WITH MACRON
+  { 0x00610306U, 0x0103 },  // LATIN SMALL LETTER A WITH BREVE
+  { 0x00610307U, 0x0227 },  // LATIN SMALL LETTER A WITH DOT ABOVE
+  { 0x00610308U, 0x00E4 },  // LATIN SMALL LETTER A WITH DIAERESIS
+  { 0x00610309U, 0x1EA3 },  // LATIN SMALL LETTER A WITH HOOK ABOVE
+  { 0x0061030AU, 0x00E5 },  // LATIN SMALL LETTER A WITH RING ABOVE
+  { 0x0061030CU, 0x01CE },  // LATIN SMALL LETTER A WITH CARON
+  { 0x0061030FU, 0x0201 },  // LATIN SMALL LETTER A WITH DOUBLE GRAVE
+  { 0x00610311U, 0x0203 },  // LATIN SMALL LETTER A WITH INVERTED BREVE
+  { 0x00610323U, 0x1EA1 },  // LATIN SMALL LETTER A WITH DOT BELOW
+  { 0x00610325U, 0x1E01 },  // LATIN SMALL LETTER A WITH RING BELOW
+  { 0x00610328U, 0x0105 },  // LATIN SMALL LETTER A WITH OGONEK
+  { 0x00620307U, 0x1E03 },  // LATIN SMALL LETTER B WITH DOT ABOVE
+  { 0x00620323U, 0x1E05 },  // LATIN SMALL LETTER B WITH DOT BELOW
+  { 0x00620331U, 0x1E07 },  // LATIN SMALL LETTER B WITH LINE BELOW
+  { 0x00630301U, 0x0107 },  // LATIN SMALL LETTER C WITH ACUTE
+  { 0x00630302U, 0x0109 },  // LATIN SMALL LETTER C WITH CIRCUMFLEX
+  { 0x00630307U, 0x010B },  // LATIN SMALL LETTER C WITH DOT ABOVE
+  { 0x0063030CU, 0x010D },  // LATIN SMALL LETTER C WITH CARON
+  { 0x00630327U, 0x00E7 },  // LATIN SMALL LETTER C WITH CEDILLA
+  { 0x00640307U, 0x1E0B },  // LATIN SMALL LETTER D WITH DOT ABOVE
+  { 0x0064030CU, 0x010F },  // LATIN SMALL LETTER D WITH CARON
+  { 0x00640323U, 0x1E0D },  // LATIN SMALL LETTER D WITH DOT BELOW
+  { 0x00640327U, 0x1E11 },  // LATIN SMALL LETTER D WITH CEDILLA
+  { 0x0064032DU, 0x1E13 },  // LATIN SMALL LETTER D WITH CIRCUMFLEX BELOW
+  { 0x00640331U, 0x1E0F },  // LATIN SMALL LETTER D WITH LINE BELOW
+  { 0x00650300U, 0x00E8 },  // LATIN SMALL LETTER E WITH GRAVE
+  { 0x00650301U, 0x00E9 },  // LATIN SMALL LETTER E WITH ACUTE
+  { 0x00650302U, 0x00EA },  // LATIN SMALL LETTER E WITH CIRCUMFLEX
+  { 0x00650303U, 0x1EBD },  // LATIN SMALL LETTER E WITH TILDE
+  { 0x00650304U, 0x0113 },  // LATIN SMALL LETTER E WITH MACRON
+  { 0x00650306U, 0x0115 },  // LATIN SMALL LETTER E WITH BREVE
+  { 0x00650307U, 0x0117 },  // LATIN SMALL LETTER E WITH DOT ABOVE
+  { 0x00650308U, 0x00EB },  // LATIN SMALL LETTER E WITH DIAERESIS
+  { 0x00650309U, 0x1EBB },  // LATIN SMALL LETTER E WITH HOOK ABOVE
+  { 0x0065030CU, 0x011B },  // LATIN SMALL LETTER E WITH CARON
+  { 0x0065030FU, 0x0205 },  // LATIN SMALL LETTER E WITH DOUBLE GRAVE
+  { 0x00650311U, 0x0207 },  // LATIN SMALL LETTER E WITH INVERTED BREVE
+  { 0x00650323U, 0x1EB9 },  // LATIN SMALL LETTER E WITH DOT BELOW
+  { 0x00650327U, 0x0229 },  // LATIN SMALL LETTER E WITH CEDILLA
+  { 0x00650328U, 0x0119 },  // LATIN SMALL LETTER E WITH OGONEK
+  { 0x0065032DU, 0x1E19 },  // LATIN SMALL LETTER E WITH CIRCUMFLEX BELOW
+  { 0x00650330U, 0x1E1B },  // LATIN SMALL LETTER E WITH TILDE BELOW
+  { 0x00660307U, 0x1E1F },  // LATIN SMALL LETTER F WITH DOT ABOVE
+  { 0x00670301U, 0x01F5 },  // LATIN SMALL LETTER G WITH ACUTE
+  { 0x00670302U, 0x011D },  // LATIN SMALL LETTER G WITH CIRCUMFLEX
+  { 0x00670304U, 0x1E21 },  // LATIN SMALL LETTER G WITH MACRON
+  { 0x00670306U, 0x011F },  // LATIN SMALL LETTER G WITH BREVE
+  { 0x00670307U, 0x0121 },  // LATIN SMALL LETTER G WITH DOT ABOVE
+  { 0x0067030CU, 0x01E7 },  // LATIN SMALL LETTER G WITH CARON
+  { 0x00670327U, 0x0123 },  // LATIN SMALL LETTER G WITH CEDILLA
+  { 0x00680302U, 0x0125 },  // LATIN SMALL LETTER H WITH CIRCUMFLEX
+  { 0x00680307U, 0x1E23 },  // LATIN SMALL LETTER H WITH DOT ABOVE
+  { 0x00680308U, 0x1E27 },  // LATIN SMALL LETTER H WITH DIAERESIS
+  { 0x0068030CU, 0x021F },  // LATIN SMALL LETTER H WITH CARON
+  { 0x00680323U, 0x1E25 },  // LATIN SMALL LETTER H WITH DOT BELOW
+  { 0x00680327U, 0x1E29 },  // LATIN SMALL LETTER H WITH CEDILLA
+  { 0x0068032EU, 0x1E2B },  // LATIN SMALL LETTER H WITH BREVE BELOW
+  { 0x00680331U, 0x1E96 },  // LATIN SMALL LETTER H WITH LINE BELOW
+  { 0x00690300U, 0x00EC },  // LATIN SMALL LETTER I WITH GRAVE
+  { 0x00690301U, 0x00ED },  // LATIN SMALL LETTER I WITH ACUTE
+  { 0x00690302U, 0x00EE },  // LATIN SMALL LETTER I WITH CIRCUMFLEX
+  { 0x00690303U, 0x0129 },  // LATIN SMALL LETTER I WITH TILDE
+  { 0x00690304U, 0x012B },  // LATIN SMALL LETTER I WITH MACRON
+  { 0x00690306U, 0x012D },  // LATIN SMALL LETTER I WITH BREVE
+  { 0x00690308U, 0x00EF },  // LATIN SMALL LETTER I WITH DIAERESIS
+  { 0x00690309U, 0x1EC9 },  // LATIN SMALL LETTER I WITH HOOK ABOVE
+  { 0x0069030CU, 0x01D0 },  // LATIN SMALL LETTER I WITH CARON
+  { 0x0069030FU, 0x0209 },  // LATIN SMALL LETTER I WITH DOUBLE GRAVE
+  { 0x00690311U, 0x020B },  // LATIN SMALL LETTER I WITH INVERTED BREVE
+  { 0x00690323U, 0x1ECB },  // LATIN SMALL LETTER I WITH DOT BELOW
+  { 0x00690328U, 0x012F },  // LATIN SMALL LETTER I WITH OGONEK
+  { 0x00690330U, 0x1E2D },  // LATIN SMALL LETTER I WITH TILDE BELOW
+  { 0x006A0302U, 0x0135 },  // LATIN SMALL LETTER J WITH CIRCUMFLEX
+  { 0x006A030CU, 0x01F0 },  // LATIN SMALL LETTER J WITH CARON
+  { 0x006B0301U, 0x1E31 },  // LATIN SMALL LETTER K WITH ACUTE
+  { 0x006B030CU, 0x01E9 },  // LATIN SMALL LETTER K WITH CARON
+  { 0x006B0323U, 0x1E33 },  // LATIN SMALL LETTER K WITH DOT BELOW
+  { 0x006B0327U, 0x0137 },  // LATIN SMALL LETTER K WITH CEDILLA
+  { 0x006B0331U, 0x1E35 },  // LATIN SMALL LETTER K WITH LINE BELOW
+  { 0x006C0301U, 0x013A },  // LATIN SMALL LETTER L WITH ACUTE
+  { 0x006C030CU, 0x013E },  // LATIN SMALL LETTER L WITH CARON
+  { 0x006C0323U, 0x1E37 },  // LATIN SMALL LETTER L WITH DOT BELOW
+  { 0x006C0327U, 0x013C },  // LATIN SMALL LETTER L WITH CEDILLA
+  { 0x006C032DU, 0x1E3D },  // LATIN SMALL LETTER L WITH CIRCUMFLEX BELOW
+  { 0x006C0331U, 0x1E3B },  // LATIN SMALL LETTER L WITH LINE BELOW
+  { 0x006D0301U, 0x1E3F },  // LATIN SMALL LETTER M WITH ACUTE
+  { 0x006D0307U, 0x1E41 },  // LATIN SMALL LETTER M WITH DOT ABOVE
+  { 0x006D0323U, 0x1E43 },  // LATIN SMALL LETTER M WITH DOT BELOW
+  { 0x006E0300U, 0x01F9 },  // LATIN SMALL LETTER N WITH GRAVE
+  { 0x006E0301U, 0x0144 },  // LATIN SMALL LETTER N WITH ACUTE
+  { 0x006E0303U, 0x00F1 },  // LATIN SMALL LETTER N WITH TILDE
+  { 0x006E0307U, 0x1E45 },  // LATIN SMALL LETTER N WITH DOT ABOVE
+  { 0x006E030CU, 0x0148 },  // LATIN SMALL LETTER N WITH CARON
+  { 0x006E0323U, 0x1E47 },  // LATIN SMALL LETTER N WITH DOT BELOW
+  { 0x006E0327U, 0x0146 },  // LATIN SMALL LETTER N WITH CEDILLA
+  { 0x006E032DU, 0x1E4B },  // LATIN SMALL LETTER N WITH CIRCUMFLEX BELOW
+  { 0x006E0331U, 0x1E49 },  // LATIN SMALL LETTER N WITH LINE BELOW
+  { 0x006F0300U, 0x00F2 },  // LATIN SMALL LETTER O WITH GRAVE
+  { 0x006F0301U, 0x00F3 },  // LATIN SMALL LETTER O WITH ACUTE
+  { 0x006F0302U, 0x00F4 },  // LATIN SMALL LETTER O WITH CIRCUMFLEX
+  { 0x006F0303U, 0x00F5 },  // LATIN SMALL LETTER O WITH TILDE
+  { 0x006F0304U, 0x014D },  // LATIN SMALL LETTER O WITH MACRON
+  { 0x006F0306U, 0x014F },  // LATIN SMALL LETTER O WITH BREVE
+  { 0x006F0307U, 0x022F },  // LATIN SMALL LETTER O WITH DOT ABOVE
+  { 0x006F0308U, 0x00F6 },  // LATIN SMALL LETTER O WITH DIAERESIS
+  { 0x006F0309U, 0x1ECF },  // LATIN SMALL LETTER O WITH HOOK ABOVE
+  { 0x006F030BU, 0x0151 },  // LATIN SMALL LETTER O WITH DOUBLE ACUTE
+  { 0x006F030CU, 0x01D2 },  // LATIN SMALL LETTER O WITH CARON
+  { 0x006F030FU, 0x020D },  // LATIN SMALL LETTER O WITH DOUBLE GRAVE
+  { 0x006F0311U, 0x020F },  // LATIN SMALL LETTER O WITH INVERTED BREVE
+  { 0x006F031BU, 0x01A1 },  // LATIN SMALL LETTER O WITH HORN
+  { 0x006F0323U, 0x1ECD },  // LATIN SMALL LETTER O WITH DOT BELOW
+  { 0x006F0328U, 0x01EB },  // LATIN SMALL LETTER O WITH OGONEK
+  { 0x00700301U, 0x1E55 },  // LATIN SMALL LETTER P WITH ACUTE
+  { 0x00700307U, 0x1E57 },  // LATIN SMALL LETTER P WITH DOT ABOVE
+  { 0x00720301U, 0x0155 },  // LATIN SMALL LETTER R WITH ACUTE
+  { 0x00720307U, 0x1E59 },  // LATIN SMALL LETTER R WITH DOT ABOVE
+  { 0x0072030CU, 0x0159 },  // LATIN SMALL LETTER R WITH CARON
+  { 0x0072030FU, 0x0211 },  // LATIN SMALL LETTER R WITH DOUBLE GRAVE
+  { 0x00720311U, 0x0213 },  // LATIN SMALL LETTER R WITH INVERTED BREVE
+  { 0x00720323U, 0x1E5B },  // LATIN SMALL LETTER R WITH DOT BELOW
+  { 0x00720327U, 0x0157 },  // LATIN SMALL LETTER R WITH CEDILLA
+  { 0x00720331U, 0x1E5F },  // LATIN SMALL LETTER R WITH LINE BELOW
+  { 0x00730301U, 0x015B },  // LATIN SMALL LETTER S WITH ACUTE
+  { 0x00730302U, 0x015D },  // LATIN SMALL LETTER S WITH CIRCUMFLEX
+  { 0x00730307U, 0x1E61 },  // LATIN SMALL LETTER S WITH DOT ABOVE
+  { 0x0073030CU, 0x0161 },  // LATIN SMALL LETTER S WITH CARON
+  { 0x00730323U, 0x1E63 },  // LATIN SMALL LETTER S WITH DOT BELOW
+  { 0x00730326U, 0x0219 },  // LATIN SMALL LETTER S WITH COMMA BELOW
+  { 0x00730327U, 0x015F },  // LATIN SMALL LETTER S WITH CEDILLA
+  { 0x00740307U, 0x1E6B },  // LATIN SMALL LETTER T WITH DOT ABOVE
+  { 0x00740308U, 0x1E97 },  // LATIN SMALL LETTER T WITH DIAERESIS
+  { 0x0074030CU, 0x0165 },  // LATIN SMALL LETTER T WITH CARON
+  { 0x00740323U, 0x1E6D },  // LATIN SMALL LETTER T WITH DOT BELOW
+  { 0x00740326U, 0x021B },  // LATIN SMALL LETTER T WITH COMMA BELOW
+  { 0x00740327U, 0x0163 },  // LATIN SMALL LETTER T WITH CEDILLA
+  { 0x0074032DU, 0x1E71 },  // LATIN SMALL LETTER T WITH CIRCUMFLEX BELOW
+  { 0x00740331U, 0x1E6F },  // LATIN SMALL LETTER T WITH LINE BELOW
+  { 0x00750300U, 0x00F9 },  // LATIN SMALL LETTER U WITH GRAVE
+  { 0x00750301U, 0x00FA },  // LATIN SMALL LETTER U WITH ACUTE
+  { 0x00750302U, 0x00FB },  // LATIN SMALL LETTER U WITH CIRCUMFLEX
+  { 0x00750303U, 0x0169 },  // LATIN SMALL LETTER U WITH TILDE
+  { 0x00750304U, 0x016B },  // LATIN SMALL LETTER U WITH MACRON
+  { 0x00750306U, 0x016D },  // LATIN SMALL LETTER U WITH BREVE
+  { 0x00750308U, 0x00FC },  // LATIN SMALL LETTER U WITH DIAERESIS
+  { 0x00750309U, 0x1EE7 },  // LATIN SMALL LETTER U WITH HOOK ABOVE
+  { 0x0075030AU, 0x016F },  // LATIN SMALL LETTER U WITH RING ABOVE
+  { 0x0075030BU, 0x0171 },  // LATIN SMALL LETTER U WITH DOUBLE ACUTE
+  { 0x0075030CU, 0x01D4 },  // LATIN SMALL LETTER U WITH CARON
+  { 0x0075030FU, 0x0215 },  // LATIN SMALL LETTER U WITH DOUBLE GRAVE
+  { 0x00750311U, 0x0217 },  // LATIN SMALL LETTER U WITH INVERTED BREVE
+  { 0x0075031BU, 0x01B0 },  // LATIN SMALL LETTER U WITH HORN
+  { 0x00750323U, 0x1EE5 },  // LATIN SMALL LETTER U WITH DOT BELOW
+  { 0x00750324U, 0x1E73 },  // LATIN SMALL LETTER U WITH DIAERESIS BELOW
+  { 0x00750328U, 0x0173 },  // LATIN SMALL LETTER U WITH OGONEK
+  { 0x0075032DU, 0x1E77 },  // LATIN SMALL LETTER U WITH CIRCUMFLEX BELOW
+  { 0x00750330U, 0x1E75 },  // LATIN SMALL LETTER U WITH TILDE BELOW
+  { 0x00760303U, 0x1E7D },  // LATIN SMALL LETTER V WITH TILDE
+  { 0x00760323U, 0x1E7F },  // LATIN SMALL LETTER V WITH DOT BELOW
+  { 0x00770300U, 0x1E81 },  // LATIN SMALL LETTER W WITH GRAVE
+  { 0x00770301U, 0x1E83 },  // LATIN SMALL LETTER W WITH ACUTE
+  { 0x00770302U, 0x0175 },  // LATIN SMALL LETTER W WITH CIRCUMFLEX
+  { 0x00770307U, 0x1E87 },  // LATIN SMALL LETTER W WITH DOT ABOVE
+  { 0x00770308U, 0x1E85 },  // LATIN SMALL LETTER W WITH DIAERESIS
+  { 0x0077030AU, 0x1E98 },  // LATIN SMALL LETTER W WITH RING ABOVE
+  { 0x00770323U, 0x1E89 },  // LATIN SMALL LETTER W WITH DOT BELOW
+  { 0x00780307U, 0x1E8B },  // LATIN SMALL LETTER X WITH DOT ABOVE
+  { 0x00780308U, 0x1E8D },  // LATIN SMALL LETTER X WITH DIAERESIS
+  { 0x00790300U, 0x1EF3 },  // LATIN SMALL LETTER Y WITH GRAVE
+  { 0x00790301U, 0x00FD },  // LATIN SMALL LETTER Y WITH ACUTE
+  { 0x00790302U, 0x0177 },  // LATIN SMALL LETTER Y WITH CIRCUMFLEX
+  { 0x00790303U, 0x1EF9 },  // LATIN SMALL LETTER Y WITH TILDE
+  { 0x00790304U, 0x0233 },  // LATIN SMALL LETTER Y WITH MACRON
+  { 0x00790307U, 0x1E8F },  // LATIN SMALL LETTER Y WITH DOT ABOVE
+  { 0x00790308U, 0x00FF },  // LATIN SMALL LETTER Y WITH DIAERESIS
+  { 0x00790309U, 0x1EF7 },  // LATIN SMALL LETTER Y WITH HOOK ABOVE
+  { 0x0079030AU, 0x1E99 },  // LATIN SMALL LETTER Y WITH RING ABOVE
+  { 0x00790323U, 0x1EF5 },  // LATIN SMALL LETTER Y WITH DOT BELOW
+  { 0x007A0301U, 0x017A },  // LATIN SMALL LETTER Z WITH ACUTE
+  { 0x007A0302U, 0x1E91 },  // LATIN SMALL LETTER Z WITH CIRCUMFLEX
+  { 0x007A0307U, 0x017C },  // LATIN SMALL LETTER Z WITH DOT ABOVE
+  { 0x007A030CU, 0x017E },  // LATIN SMALL LETTER Z WITH CARON
+  { 0x007A0323U, 0x1E93 },  // LATIN SMALL LETTER Z WITH DOT BELOW
+  { 0x007A0331U, 0x1E95 },  // LATIN SMALL LETTER Z WITH LINE BELOW
+  { 0x00A80300U, 0x1FED },  // GREEK DIALYTIKA AND VARIA
+  { 0x00A80301U, 0x0385 },  // GREEK DIALYTIKA TONOS
+  { 0x00A80342U, 0x1FC1 },  // GREEK DIALYTIKA AND PERISPOMENI
+  { 0x00C20300U, 0x1EA6 },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND GRAVE
+  { 0x00C20301U, 0x1EA4 },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND ACUTE
+  { 0x00C20303U, 0x1EAA },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND TILDE
+  { 0x00C20309U, 0x1EA8 },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x00C40304U, 0x01DE },  // LATIN CAPITAL LETTER A WITH DIAERESIS AND MACRON
+  { 0x00C50301U, 0x01FA },  // LATIN CAPITAL LETTER A WITH RING ABOVE AND ACUTE
+  { 0x00C60301U, 0x01FC },  // LATIN CAPITAL LETTER AE WITH ACUTE
+  { 0x00C60304U, 0x01E2 },  // LATIN CAPITAL LETTER AE WITH MACRON
+  { 0x00C70301U, 0x1E08 },  // LATIN CAPITAL LETTER C WITH CEDILLA AND ACUTE
+  { 0x00CA0300U, 0x1EC0 },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND GRAVE
+  { 0x00CA0301U, 0x1EBE },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND ACUTE
+  { 0x00CA0303U, 0x1EC4 },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND TILDE
+  { 0x00CA0309U, 0x1EC2 },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x00CF0301U, 0x1E2E },  // LATIN CAPITAL LETTER I WITH DIAERESIS AND ACUTE
+  { 0x00D40300U, 0x1ED2 },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND GRAVE
+  { 0x00D40301U, 0x1ED0 },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND ACUTE
+  { 0x00D40303U, 0x1ED6 },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND TILDE
+  { 0x00D40309U, 0x1ED4 },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x00D50301U, 0x1E4C },  // LATIN CAPITAL LETTER O WITH TILDE AND ACUTE
+  { 0x00D50304U, 0x022C },  // LATIN CAPITAL LETTER O WITH TILDE AND MACRON
+  { 0x00D50308U, 0x1E4E },  // LATIN CAPITAL LETTER O WITH TILDE AND DIAERESIS
+  { 0x00D60304U, 0x022A },  // LATIN CAPITAL LETTER O WITH DIAERESIS AND MACRON
+  { 0x00D80301U, 0x01FE },  // LATIN CAPITAL LETTER O WITH STROKE AND ACUTE
+  { 0x00DC0300U, 0x01DB },  // LATIN CAPITAL LETTER U WITH DIAERESIS AND GRAVE
+  { 0x00DC0301U, 0x01D7 },  // LATIN CAPITAL LETTER U WITH DIAERESIS AND ACUTE
+  { 0x00DC0304U, 0x01D5 },  // LATIN CAPITAL LETTER U WITH DIAERESIS AND MACRON
+  { 0x00DC030CU, 0x01D9 },  // LATIN CAPITAL LETTER U WITH DIAERESIS AND CARON
+  { 0x00E20300U, 0x1EA7 },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND GRAVE
+  { 0x00E20301U, 0x1EA5 },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND ACUTE
+  { 0x00E20303U, 0x1EAB },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND TILDE
+  { 0x00E20309U, 0x1EA9 },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x00E40304U, 0x01DF },  // LATIN SMALL LETTER A WITH DIAERESIS AND MACRON
+  { 0x00E50301U, 0x01FB },  // LATIN SMALL LETTER A WITH RING ABOVE AND ACUTE
+  { 0x00E60301U, 0x01FD },  // LATIN SMALL LETTER AE WITH ACUTE
+  { 0x00E60304U, 0x01E3 },  // LATIN SMALL LETTER AE WITH MACRON
+  { 0x00E70301U, 0x1E09 },  // LATIN SMALL LETTER C WITH CEDILLA AND ACUTE
+  { 0x00EA0300U, 0x1EC1 },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND GRAVE
+  { 0x00EA0301U, 0x1EBF },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND ACUTE
+  { 0x00EA0303U, 0x1EC5 },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND TILDE
+  { 0x00EA0309U, 0x1EC3 },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x00EF0301U, 0x1E2F },  // LATIN SMALL LETTER I WITH DIAERESIS AND ACUTE
+  { 0x00F40300U, 0x1ED3 },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND GRAVE
+  { 0x00F40301U, 0x1ED1 },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND ACUTE
+  { 0x00F40303U, 0x1ED7 },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND TILDE
+  { 0x00F40309U, 0x1ED5 },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x00F50301U, 0x1E4D },  // LATIN SMALL LETTER O WITH TILDE AND ACUTE
+  { 0x00F50304U, 0x022D },  // LATIN SMALL LETTER O WITH TILDE AND MACRON
+  { 0x00F50308U, 0x1E4F },  // LATIN SMALL LETTER O WITH TILDE AND DIAERESIS
+  { 0x00F60304U, 0x022B },  // LATIN SMALL LETTER O WITH DIAERESIS AND MACRON
+  { 0x00F80301U, 0x01FF },  // LATIN SMALL LETTER O WITH STROKE AND ACUTE
+  { 0x00FC0300U, 0x01DC },  // LATIN SMALL LETTER U WITH DIAERESIS AND GRAVE
+  { 0x00FC0301U, 0x01D8 },  // LATIN SMALL LETTER U WITH DIAERESIS AND ACUTE
+  { 0x00FC0304U, 0x01D6 },  // LATIN SMALL LETTER U WITH DIAERESIS AND MACRON
+  { 0x00FC030CU, 0x01DA },  // LATIN SMALL LETTER U WITH DIAERESIS AND CARON
+  { 0x01020300U, 0x1EB0 },  // LATIN CAPITAL LETTER A WITH BREVE AND GRAVE
+  { 0x01020301U, 0x1EAE },  // LATIN CAPITAL LETTER A WITH BREVE AND ACUTE
+  { 0x01020303U, 0x1EB4 },  // LATIN CAPITAL LETTER A WITH BREVE AND TILDE
+  { 0x01020309U, 0x1EB2 },  // LATIN CAPITAL LETTER A WITH BREVE AND HOOK ABOVE
+  { 0x01030300U, 0x1EB1 },  // LATIN SMALL LETTER A WITH BREVE AND GRAVE
+  { 0x01030301U, 0x1EAF },  // LATIN SMALL LETTER A WITH BREVE AND ACUTE
+  { 0x01030303U, 0x1EB5 },  // LATIN SMALL LETTER A WITH BREVE AND TILDE
+  { 0x01030309U, 0x1EB3 },  // LATIN SMALL LETTER A WITH BREVE AND HOOK ABOVE
+  { 0x01120300U, 0x1E14 },  // LATIN CAPITAL LETTER E WITH MACRON AND GRAVE
+  { 0x01120301U, 0x1E16 },  // LATIN CAPITAL LETTER E WITH MACRON AND ACUTE
+  { 0x01130300U, 0x1E15 },  // LATIN SMALL LETTER E WITH MACRON AND GRAVE
+  { 0x01130301U, 0x1E17 },  // LATIN SMALL LETTER E WITH MACRON AND ACUTE
+  { 0x014C0300U, 0x1E50 },  // LATIN CAPITAL LETTER O WITH MACRON AND GRAVE
+  { 0x014C0301U, 0x1E52 },  // LATIN CAPITAL LETTER O WITH MACRON AND ACUTE
+  { 0x014D0300U, 0x1E51 },  // LATIN SMALL LETTER O WITH MACRON AND GRAVE
+  { 0x014D0301U, 0x1E53 },  // LATIN SMALL LETTER O WITH MACRON AND ACUTE
+  { 0x015A0307U, 0x1E64 },  // LATIN CAPITAL LETTER S WITH ACUTE AND DOT ABOVE
+  { 0x015B0307U, 0x1E65 },  // LATIN SMALL LETTER S WITH ACUTE AND DOT ABOVE
+  { 0x01600307U, 0x1E66 },  // LATIN CAPITAL LETTER S WITH CARON AND DOT ABOVE
+  { 0x01610307U, 0x1E67 },  // LATIN SMALL LETTER S WITH CARON AND DOT ABOVE
+  { 0x01680301U, 0x1E78 },  // LATIN CAPITAL LETTER U WITH TILDE AND ACUTE
+  { 0x01690301U, 0x1E79 },  // LATIN SMALL LETTER U WITH TILDE AND ACUTE
+  { 0x016A0308U, 0x1E7A },  // LATIN CAPITAL LETTER U WITH MACRON AND DIAERESIS
+  { 0x016B0308U, 0x1E7B },  // LATIN SMALL LETTER U WITH MACRON AND DIAERESIS
+  { 0x017F0307U, 0x1E9B },  // LATIN SMALL LETTER LONG S WITH DOT ABOVE
+  { 0x01A00300U, 0x1EDC },  // LATIN CAPITAL LETTER O WITH HORN AND GRAVE
+  { 0x01A00301U, 0x1EDA },  // LATIN CAPITAL LETTER O WITH HORN AND ACUTE
+  { 0x01A00303U, 0x1EE0 },  // LATIN CAPITAL LETTER O WITH HORN AND TILDE
+  { 0x01A00309U, 0x1EDE },  // LATIN CAPITAL LETTER O WITH HORN AND HOOK ABOVE
+  { 0x01A00323U, 0x1EE2 },  // LATIN CAPITAL LETTER O WITH HORN AND DOT BELOW
+  { 0x01A10300U, 0x1EDD },  // LATIN SMALL LETTER O WITH HORN AND GRAVE
+  { 0x01A10301U, 0x1EDB },  // LATIN SMALL LETTER O WITH HORN AND ACUTE
+  { 0x01A10303U, 0x1EE1 },  // LATIN SMALL LETTER O WITH HORN AND TILDE
+  { 0x01A10309U, 0x1EDF },  // LATIN SMALL LETTER O WITH HORN AND HOOK ABOVE
+  { 0x01A10323U, 0x1EE3 },  // LATIN SMALL LETTER O WITH HORN AND DOT BELOW
+  { 0x01AF0300U, 0x1EEA },  // LATIN CAPITAL LETTER U WITH HORN AND GRAVE
+  { 0x01AF0301U, 0x1EE8 },  // LATIN CAPITAL LETTER U WITH HORN AND ACUTE
+  { 0x01AF0303U, 0x1EEE },  // LATIN CAPITAL LETTER U WITH HORN AND TILDE
+  { 0x01AF0309U, 0x1EEC },  // LATIN CAPITAL LETTER U WITH HORN AND HOOK ABOVE
+  { 0x01AF0323U, 0x1EF0 },  // LATIN CAPITAL LETTER U WITH HORN AND DOT BELOW
+  { 0x01B00300U, 0x1EEB },  // LATIN SMALL LETTER U WITH HORN AND GRAVE
+  { 0x01B00301U, 0x1EE9 },  // LATIN SMALL LETTER U WITH HORN AND ACUTE
+  { 0x01B00303U, 0x1EEF },  // LATIN SMALL LETTER U WITH HORN AND TILDE
+  { 0x01B00309U, 0x1EED },  // LATIN SMALL LETTER U WITH HORN AND HOOK ABOVE
+  { 0x01B00323U, 0x1EF1 },  // LATIN SMALL LETTER U WITH HORN AND DOT BELOW
+  { 0x01B7030CU, 0x01EE },  // LATIN CAPITAL LETTER EZH WITH CARON
+  { 0x01EA0304U, 0x01EC },  // LATIN CAPITAL LETTER O WITH OGONEK AND MACRON
+  { 0x01EB0304U, 0x01ED },  // LATIN SMALL LETTER O WITH OGONEK AND MACRON
+  { 0x02260304U, 0x01E0 },  // LATIN CAPITAL LETTER A WITH DOT ABOVE AND MACRON
+  { 0x02270304U, 0x01E1 },  // LATIN SMALL LETTER A WITH DOT ABOVE AND MACRON
+  { 0x02280306U, 0x1E1C },  // LATIN CAPITAL LETTER E WITH CEDILLA AND BREVE
+  { 0x02290306U, 0x1E1D },  // LATIN SMALL LETTER E WITH CEDILLA AND BREVE
+  { 0x022E0304U, 0x0230 },  // LATIN CAPITAL LETTER O WITH DOT ABOVE AND MACRON
+  { 0x022F0304U, 0x0231 },  // LATIN SMALL LETTER O WITH DOT ABOVE AND MACRON
+  { 0x0292030CU, 0x01EF },  // LATIN SMALL LETTER EZH WITH CARON
+  { 0x03910300U, 0x1FBA },  // GREEK CAPITAL LETTER ALPHA WITH VARIA
+  { 0x03910301U, 0x0386 },  // GREEK CAPITAL LETTER ALPHA WITH TONOS
+  { 0x03910304U, 0x1FB9 },  // GREEK CAPITAL LETTER ALPHA WITH MACRON
+  { 0x03910306U, 0x1FB8 },  // GREEK CAPITAL LETTER ALPHA WITH VRACHY
+  { 0x03910313U, 0x1F08 },  // GREEK CAPITAL LETTER ALPHA WITH PSILI
+  { 0x03910314U, 0x1F09 },  // GREEK CAPITAL LETTER ALPHA WITH DASIA
+  { 0x03910345U, 0x1FBC },  // GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI
+  { 0x03950300U, 0x1FC8 },  // GREEK CAPITAL LETTER EPSILON WITH VARIA
+  { 0x03950301U, 0x0388 },  // GREEK CAPITAL LETTER EPSILON WITH TONOS
+  { 0x03950313U, 0x1F18 },  // GREEK CAPITAL LETTER EPSILON WITH PSILI
+  { 0x03950314U, 0x1F19 },  // GREEK CAPITAL LETTER EPSILON WITH DASIA
+  { 0x03970300U, 0x1FCA },  // GREEK CAPITAL LETTER ETA WITH VARIA
+  { 0x03970301U, 0x0389 },  // GREEK CAPITAL LETTER ETA WITH TONOS
+  { 0x03970313U, 0x1F28 },  // GREEK CAPITAL LETTER ETA WITH PSILI
+  { 0x03970314U, 0x1F29 },  // GREEK CAPITAL LETTER ETA WITH DASIA
+  { 0x03970345U, 0x1FCC },  // GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI
+  { 0x03990300U, 0x1FDA },  // GREEK CAPITAL LETTER IOTA WITH VARIA
+  { 0x03990301U, 0x038A },  // GREEK CAPITAL LETTER IOTA WITH TONOS
+  { 0x03990304U, 0x1FD9 },  // GREEK CAPITAL LETTER IOTA WITH MACRON
+  { 0x03990306U, 0x1FD8 },  // GREEK CAPITAL LETTER IOTA WITH VRACHY
+  { 0x03990308U, 0x03AA },  // GREEK CAPITAL LETTER IOTA WITH DIALYTIKA
+  { 0x03990313U, 0x1F38 },  // GREEK CAPITAL LETTER IOTA WITH PSILI
+  { 0x03990314U, 0x1F39 },  // GREEK CAPITAL LETTER IOTA WITH DASIA
+  { 0x039F0300U, 0x1FF8 },  // GREEK CAPITAL LETTER OMICRON WITH VARIA
+  { 0x039F0301U, 0x038C },  // GREEK CAPITAL LETTER OMICRON WITH TONOS
+  { 0x039F0313U, 0x1F48 },  // GREEK CAPITAL LETTER OMICRON WITH PSILI
+  { 0x039F0314U, 0x1F49 },  // GREEK CAPITAL LETTER OMICRON WITH DASIA
+  { 0x03A10314U, 0x1FEC },  // GREEK CAPITAL LETTER RHO WITH DASIA
+  { 0x03A50300U, 0x1FEA },  // GREEK CAPITAL LETTER UPSILON WITH VARIA
+  { 0x03A50301U, 0x038E },  // GREEK CAPITAL LETTER UPSILON WITH TONOS
+  { 0x03A50304U, 0x1FE9 },  // GREEK CAPITAL LETTER UPSILON WITH MACRON
+  { 0x03A50306U, 0x1FE8 },  // GREEK CAPITAL LETTER UPSILON WITH VRACHY
+  { 0x03A50308U, 0x03AB },  // GREEK CAPITAL LETTER UPSILON WITH DIALYTIKA
+  { 0x03A50314U, 0x1F59 },  // GREEK CAPITAL LETTER UPSILON WITH DASIA
+  { 0x03A90300U, 0x1FFA },  // GREEK CAPITAL LETTER OMEGA WITH VARIA
+  { 0x03A90301U, 0x038F },  // GREEK CAPITAL LETTER OMEGA WITH TONOS
+  { 0x03A90313U, 0x1F68 },  // GREEK CAPITAL LETTER OMEGA WITH PSILI
+  { 0x03A90314U, 0x1F69 },  // GREEK CAPITAL LETTER OMEGA WITH DASIA
+  { 0x03A90345U, 0x1FFC },  // GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI
+  { 0x03AC0345U, 0x1FB4 },  // GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI
+  { 0x03AE0345U, 0x1FC4 },  // GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI
+  { 0x03B10300U, 0x1F70 },  // GREEK SMALL LETTER ALPHA WITH VARIA
+  { 0x03B10301U, 0x03AC },  // GREEK SMALL LETTER ALPHA WITH TONOS
+  { 0x03B10304U, 0x1FB1 },  // GREEK SMALL LETTER ALPHA WITH MACRON
+  { 0x03B10306U, 0x1FB0 },  // GREEK SMALL LETTER ALPHA WITH VRACHY
+  { 0x03B10313U, 0x1F00 },  // GREEK SMALL LETTER ALPHA WITH PSILI
+  { 0x03B10314U, 0x1F01 },  // GREEK SMALL LETTER ALPHA WITH DASIA
+  { 0x03B10342U, 0x1FB6 },  // GREEK SMALL LETTER ALPHA WITH PERISPOMENI
+  { 0x03B10345U, 0x1FB3 },  // GREEK SMALL LETTER ALPHA WITH YPOGEGRAMMENI
+  { 0x03B50300U, 0x1F72 },  // GREEK SMALL LETTER EPSILON WITH VARIA
+  { 0x03B50301U, 0x03AD },  // GREEK SMALL LETTER EPSILON WITH TONOS
+  { 0x03B50313U, 0x1F10 },  // GREEK SMALL LETTER EPSILON WITH PSILI
+  { 0x03B50314U, 0x1F11 },  // GREEK SMALL LETTER EPSILON WITH DASIA
+  { 0x03B70300U, 0x1F74 },  // GREEK SMALL LETTER ETA WITH VARIA
+  { 0x03B70301U, 0x03AE },  // GREEK SMALL LETTER ETA WITH TONOS
+  { 0x03B70313U, 0x1F20 },  // GREEK SMALL LETTER ETA WITH PSILI
+  { 0x03B70314U, 0x1F21 },  // GREEK SMALL LETTER ETA WITH DASIA
+  { 0x03B70342U, 0x1FC6 },  // GREEK SMALL LETTER ETA WITH PERISPOMENI
+  { 0x03B70345U, 0x1FC3 },  // GREEK SMALL LETTER ETA WITH YPOGEGRAMMENI
+  { 0x03B90300U, 0x1F76 },  // GREEK SMALL LETTER IOTA WITH VARIA
+  { 0x03B90301U, 0x03AF },  // GREEK SMALL LETTER IOTA WITH TONOS
+  { 0x03B90304U, 0x1FD1 },  // GREEK SMALL LETTER IOTA WITH MACRON
+  { 0x03B90306U, 0x1FD0 },  // GREEK SMALL LETTER IOTA WITH VRACHY
+  { 0x03B90308U, 0x03CA },  // GREEK SMALL LETTER IOTA WITH DIALYTIKA
+  { 0x03B90313U, 0x1F30 },  // GREEK SMALL LETTER IOTA WITH PSILI
+  { 0x03B90314U, 0x1F31 },  // GREEK SMALL LETTER IOTA WITH DASIA
+  { 0x03B90342U, 0x1FD6 },  // GREEK SMALL LETTER IOTA WITH PERISPOMENI
+  { 0x03BF0300U, 0x1F78 },  // GREEK SMALL LETTER OMICRON WITH VARIA
+  { 0x03BF0301U, 0x03CC },  // GREEK SMALL LETTER OMICRON WITH TONOS
+  { 0x03BF0313U, 0x1F40 },  // GREEK SMALL LETTER OMICRON WITH PSILI
+  { 0x03BF0314U, 0x1F41 },  // GREEK SMALL LETTER OMICRON WITH DASIA
+  { 0x03C10313U, 0x1FE4 },  // GREEK SMALL LETTER RHO WITH PSILI
+  { 0x03C10314U, 0x1FE5 },  // GREEK SMALL LETTER RHO WITH DASIA
+  { 0x03C50300U, 0x1F7A },  // GREEK SMALL LETTER UPSILON WITH VARIA
+  { 0x03C50301U, 0x03CD },  // GREEK SMALL LETTER UPSILON WITH TONOS
+  { 0x03C50304U, 0x1FE1 },  // GREEK SMALL LETTER UPSILON WITH MACRON
+  { 0x03C50306U, 0x1FE0 },  // GREEK SMALL LETTER UPSILON WITH VRACHY
+  { 0x03C50308U, 0x03CB },  // GREEK SMALL LETTER UPSILON WITH DIALYTIKA
+  { 0x03C50313U, 0x1F50 },  // GREEK SMALL LETTER UPSILON WITH PSILI
+  { 0x03C50314U, 0x1F51 },  // GREEK SMALL LETTER UPSILON WITH DASIA
+  { 0x03C50342U, 0x1FE6 },  // GREEK SMALL LETTER UPSILON WITH PERISPOMENI
+  { 0x03C90300U, 0x1F7C },  // GREEK SMALL LETTER OMEGA WITH VARIA
+  { 0x03C90301U, 0x03CE },  // GREEK SMALL LETTER OMEGA WITH TONOS
+  { 0x03C90313U, 0x1F60 },  // GREEK SMALL LETTER OMEGA WITH PSILI
+  { 0x03C90314U, 0x1F61 },  // GREEK SMALL LETTER OMEGA WITH DASIA
+  { 0x03C90342U, 0x1FF6 },  // GREEK SMALL LETTER OMEGA WITH PERISPOMENI
+  { 0x03C90345U, 0x1FF3 },  // GREEK SMALL LETTER OMEGA WITH YPOGEGRAMMENI
+  { 0x03CA0300U, 0x1FD2 },  // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND VARIA
+  { 0x03CA0301U, 0x0390 },  // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS
+  { 0x03CA0342U, 0x1FD7 },  // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND PERISPOMENI
+  { 0x03CB0300U, 0x1FE2 },  // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND VARIA
+  { 0x03CB0301U, 0x03B0 },  // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS
+  { 0x03CB0342U, 0x1FE7 },  // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND PERISPOMENI
+  { 0x03CE0345U, 0x1FF4 },  // GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI
+  { 0x03D20301U, 0x03D3 },  // GREEK UPSILON WITH ACUTE AND HOOK SYMBOL
+  { 0x03D20308U, 0x03D4 },  // GREEK UPSILON WITH DIAERESIS AND HOOK SYMBOL
+  { 0x04060308U, 0x0407 },  // CYRILLIC CAPITAL LETTER YI
+  { 0x04100306U, 0x04D0 },  // CYRILLIC CAPITAL LETTER A WITH BREVE
+  { 0x04100308U, 0x04D2 },  // CYRILLIC CAPITAL LETTER A WITH DIAERESIS
+  { 0x04130301U, 0x0403 },  // CYRILLIC CAPITAL LETTER GJE
+  { 0x04150300U, 0x0400 },  // CYRILLIC CAPITAL LETTER IE WITH GRAVE
+  { 0x04150306U, 0x04D6 },  // CYRILLIC CAPITAL LETTER IE WITH BREVE
+  { 0x04150308U, 0x0401 },  // CYRILLIC CAPITAL LETTER IO
+  { 0x04160306U, 0x04C1 },  // CYRILLIC CAPITAL LETTER ZHE WITH BREVE
+  { 0x04160308U, 0x04DC },  // CYRILLIC CAPITAL LETTER ZHE WITH DIAERESIS
+  { 0x04170308U, 0x04DE },  // CYRILLIC CAPITAL LETTER ZE WITH DIAERESIS
+  { 0x04180300U, 0x040D },  // CYRILLIC CAPITAL LETTER I WITH GRAVE
+  { 0x04180304U, 0x04E2 },  // CYRILLIC CAPITAL LETTER I WITH MACRON
+  { 0x04180306U, 0x0419 },  // CYRILLIC CAPITAL LETTER SHORT I
+  { 0x04180308U, 0x04E4 },  // CYRILLIC CAPITAL LETTER I WITH DIAERESIS
+  { 0x041A0301U, 0x040C },  // CYRILLIC CAPITAL LETTER KJE
+  { 0x041E0308U, 0x04E6 },  // CYRILLIC CAPITAL LETTER O WITH DIAERESIS
+  { 0x04230304U, 0x04EE },  // CYRILLIC CAPITAL LETTER U WITH MACRON
+  { 0x04230306U, 0x040E },  // CYRILLIC CAPITAL LETTER SHORT U
+  { 0x04230308U, 0x04F0 },  // CYRILLIC CAPITAL LETTER U WITH DIAERESIS
+  { 0x0423030BU, 0x04F2 },  // CYRILLIC CAPITAL LETTER U WITH DOUBLE ACUTE
+  { 0x04270308U, 0x04F4 },  // CYRILLIC CAPITAL LETTER CHE WITH DIAERESIS
+  { 0x042B0308U, 0x04F8 },  // CYRILLIC CAPITAL LETTER YERU WITH DIAERESIS
+  { 0x042D0308U, 0x04EC },  // CYRILLIC CAPITAL LETTER E WITH DIAERESIS
+  { 0x04300306U, 0x04D1 },  // CYRILLIC SMALL LETTER A WITH BREVE
+  { 0x04300308U, 0x04D3 },  // CYRILLIC SMALL LETTER A WITH DIAERESIS
+  { 0x04330301U, 0x0453 },  // CYRILLIC SMALL LETTER GJE
+  { 0x04350300U, 0x0450 },  // CYRILLIC SMALL LETTER IE WITH GRAVE
+  { 0x04350306U, 0x04D7 },  // CYRILLIC SMALL LETTER IE WITH BREVE
+  { 0x04350308U, 0x0451 },  // CYRILLIC SMALL LETTER IO
+  { 0x04360306U, 0x04C2 },  // CYRILLIC SMALL LETTER ZHE WITH BREVE
+  { 0x04360308U, 0x04DD },  // CYRILLIC SMALL LETTER ZHE WITH DIAERESIS
+  { 0x04370308U, 0x04DF },  // CYRILLIC SMALL LETTER ZE WITH DIAERESIS
+  { 0x04380300U, 0x045D },  // CYRILLIC SMALL LETTER I WITH GRAVE
+  { 0x04380304U, 0x04E3 },  // CYRILLIC SMALL LETTER I WITH MACRON
+  { 0x04380306U, 0x0439 },  // CYRILLIC SMALL LETTER SHORT I
+  { 0x04380308U, 0x04E5 },  // CYRILLIC SMALL LETTER I WITH DIAERESIS
+  { 0x043A0301U, 0x045C },  // CYRILLIC SMALL LETTER KJE
+  { 0x043E0308U, 0x04E7 },  // CYRILLIC SMALL LETTER O WITH DIAERESIS
+  { 0x04430304U, 0x04EF },  // CYRILLIC SMALL LETTER U WITH MACRON
+  { 0x04430306U, 0x045E },  // CYRILLIC SMALL LETTER SHORT U
+  { 0x04430308U, 0x04F1 },  // CYRILLIC SMALL LETTER U WITH DIAERESIS
+  { 0x0443030BU, 0x04F3 },  // CYRILLIC SMALL LETTER U WITH DOUBLE ACUTE
+  { 0x04470308U, 0x04F5 },  // CYRILLIC SMALL LETTER CHE WITH DIAERESIS
+  { 0x044B0308U, 0x04F9 },  // CYRILLIC SMALL LETTER YERU WITH DIAERESIS
+  { 0x044D0308U, 0x04ED },  // CYRILLIC SMALL LETTER E WITH DIAERESIS
+  { 0x04560308U, 0x0457 },  // CYRILLIC SMALL LETTER YI
+  { 0x0474030FU, 0x0476 },  // CYRILLIC CAPITAL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT
+  { 0x0475030FU, 0x0477 },  // CYRILLIC SMALL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT
+  { 0x04D80308U, 0x04DA },  // CYRILLIC CAPITAL LETTER SCHWA WITH DIAERESIS
+  { 0x04D90308U, 0x04DB },  // CYRILLIC SMALL LETTER SCHWA WITH DIAERESIS
+  { 0x04E80308U, 0x04EA },  // CYRILLIC CAPITAL LETTER BARRED O WITH DIAERESIS
+  { 0x04E90308U, 0x04EB },  // CYRILLIC SMALL LETTER BARRED O WITH DIAERESIS
+  { 0x06270653U, 0x0622 },  // ARABIC LETTER ALEF WITH MADDA ABOVE
+  { 0x06270654U, 0x0623 },  // ARABIC LETTER ALEF WITH HAMZA ABOVE
+  { 0x06270655U, 0x0625 },  // ARABIC LETTER ALEF WITH HAMZA BELOW
+  { 0x06480654U, 0x0624 },  // ARABIC LETTER WAW WITH HAMZA ABOVE
+  { 0x064A0654U, 0x0626 },  // ARABIC LETTER YEH WITH HAMZA ABOVE
+  { 0x06C10654U, 0x06C2 },  // ARABIC LETTER HEH GOAL WITH HAMZA ABOVE
+  { 0x06D20654U, 0x06D3 },  // ARABIC LETTER YEH BARREE WITH HAMZA ABOVE
+  { 0x06D50654U, 0x06C0 },  // ARABIC LETTER HEH WITH YEH ABOVE
+  { 0x0928093CU, 0x0929 },  // DEVANAGARI LETTER NNNA
+  { 0x0930093CU, 0x0931 },  // DEVANAGARI LETTER RRA
+  { 0x0933093CU, 0x0934 },  // DEVANAGARI LETTER LLLA
+  { 0x09C709BEU, 0x09CB },  // BENGALI VOWEL SIGN O
+  { 0x09C709D7U, 0x09CC },  // BENGALI VOWEL SIGN AU
+  { 0x0B470B3EU, 0x0B4B },  // ORIYA VOWEL SIGN O
+  { 0x0B470B56U, 0x0B48 },  // ORIYA VOWEL SIGN AI
+  { 0x0B470B57U, 0x0B4C },  // ORIYA VOWEL SIGN AU
+  { 0x0B920BD7U, 0x0B94 },  // TAMIL LETTER AU
+  { 0x0BC60BBEU, 0x0BCA },  // TAMIL VOWEL SIGN O
+  { 0x0BC60BD7U, 0x0BCC },  // TAMIL VOWEL SIGN AU
+  { 0x0BC70BBEU, 0x0BCB },  // TAMIL VOWEL SIGN OO
+  { 0x0C460C56U, 0x0C48 },  // TELUGU VOWEL SIGN AI
+  { 0x0CBF0CD5U, 0x0CC0 },  // KANNADA VOWEL SIGN II
+  { 0x0CC60CC2U, 0x0CCA },  // KANNADA VOWEL SIGN O
+  { 0x0CC60CD5U, 0x0CC7 },  // KANNADA VOWEL SIGN EE
+  { 0x0CC60CD6U, 0x0CC8 },  // KANNADA VOWEL SIGN AI
+  { 0x0CCA0CD5U, 0x0CCB },  // KANNADA VOWEL SIGN OO
+  { 0x0D460D3EU, 0x0D4A },  // MALAYALAM VOWEL SIGN O
+  { 0x0D460D57U, 0x0D4C },  // MALAYALAM VOWEL SIGN AU
+  { 0x0D470D3EU, 0x0D4B },  // MALAYALAM VOWEL SIGN OO
+  { 0x0DD90DCAU, 0x0DDA },  // SINHALA VOWEL SIGN DIGA KOMBUVA
+  { 0x0DD90DCFU, 0x0DDC },  // SINHALA VOWEL SIGN KOMBUVA HAA AELA-PILLA
+  { 0x0DD90DDFU, 0x0DDE },  // SINHALA VOWEL SIGN KOMBUVA HAA GAYANUKITTA
+  { 0x0DDC0DCAU, 0x0DDD },  // SINHALA VOWEL SIGN KOMBUVA HAA DIGA AELA-PILLA
+  { 0x1025102EU, 0x1026 },  // MYANMAR LETTER UU
+  { 0x1B051B35U, 0x1B06 },  // BALINESE LETTER AKARA TEDUNG
+  { 0x1B071B35U, 0x1B08 },  // BALINESE LETTER IKARA TEDUNG
+  { 0x1B091B35U, 0x1B0A },  // BALINESE LETTER UKARA TEDUNG
+  { 0x1B0B1B35U, 0x1B0C },  // BALINESE LETTER RA REPA TEDUNG
+  { 0x1B0D1B35U, 0x1B0E },  // BALINESE LETTER LA LENGA TEDUNG
+  { 0x1B111B35U, 0x1B12 },  // BALINESE LETTER OKARA TEDUNG
+  { 0x1B3A1B35U, 0x1B3B },  // BALINESE VOWEL SIGN RA REPA TEDUNG
+  { 0x1B3C1B35U, 0x1B3D },  // BALINESE VOWEL SIGN LA LENGA TEDUNG
+  { 0x1B3E1B35U, 0x1B40 },  // BALINESE VOWEL SIGN TALING TEDUNG
+  { 0x1B3F1B35U, 0x1B41 },  // BALINESE VOWEL SIGN TALING REPA TEDUNG
+  { 0x1B421B35U, 0x1B43 },  // BALINESE VOWEL SIGN PEPET TEDUNG
+  { 0x1E360304U, 0x1E38 },  // LATIN CAPITAL LETTER L WITH DOT BELOW AND MACRON
+  { 0x1E370304U, 0x1E39 },  // LATIN SMALL LETTER L WITH DOT BELOW AND MACRON
+  { 0x1E5A0304U, 0x1E5C },  // LATIN CAPITAL LETTER R WITH DOT BELOW AND MACRON
+  { 0x1E5B0304U, 0x1E5D },  // LATIN SMALL LETTER R WITH DOT BELOW AND MACRON
+  { 0x1E620307U, 0x1E68 },  // LATIN CAPITAL LETTER S WITH DOT BELOW AND DOT ABOVE
+  { 0x1E630307U, 0x1E69 },  // LATIN SMALL LETTER S WITH DOT BELOW AND DOT ABOVE
+  { 0x1EA00302U, 0x1EAC },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1EA00306U, 0x1EB6 },  // LATIN CAPITAL LETTER A WITH BREVE AND DOT BELOW
+  { 0x1EA10302U, 0x1EAD },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1EA10306U, 0x1EB7 },  // LATIN SMALL LETTER A WITH BREVE AND DOT BELOW
+  { 0x1EB80302U, 0x1EC6 },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1EB90302U, 0x1EC7 },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1ECC0302U, 0x1ED8 },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1ECD0302U, 0x1ED9 },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1F000300U, 0x1F02 },  // GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA
+  { 0x1F000301U, 0x1F04 },  // GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA
+  { 0x1F000342U, 0x1F06 },  // GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI
+  { 0x1F000345U, 0x1F80 },  // GREEK SMALL LETTER ALPHA WITH PSILI AND YPOGEGRAMMENI
+  { 0x1F010300U, 0x1F03 },  // GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA
+  { 0x1F010301U, 0x1F05 },  // GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA
+  { 0x1F010342U, 0x1F07 },  // GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI
+  { 0x1F010345U, 0x1F81 },  // GREEK SMALL LETTER ALPHA WITH DASIA AND YPOGEGRAMMENI
+  { 0x1F020345U, 0x1F82 },  // GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+  { 0x1F030345U, 0x1F83 },  // GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+  { 0x1F040345U, 0x1F84 },  // GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+  { 0x1F050345U, 0x1F85 },  // GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+  { 0x1F060345U, 0x1F86 },  // GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F070345U, 0x1F87 },  // GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F080300U, 0x1F0A },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA
+  { 0x1F080301U, 0x1F0C },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA
+  { 0x1F080342U, 0x1F0E },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI
+  { 0x1F080345U, 0x1F88 },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PROSGEGRAMMENI
+  { 0x1F090300U, 0x1F0B },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA
+  { 0x1F090301U, 0x1F0D },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA
+  { 0x1F090342U, 0x1F0F },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI
+  { 0x1F090345U, 0x1F89 },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PROSGEGRAMMENI
+  { 0x1F0A0345U, 0x1F8A },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+  { 0x1F0B0345U, 0x1F8B },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+  { 0x1F0C0345U, 0x1F8C },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+  { 0x1F0D0345U, 0x1F8D },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+  { 0x1F0E0345U, 0x1F8E },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1F0F0345U, 0x1F8F },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1F100300U, 0x1F12 },  // GREEK SMALL LETTER EPSILON WITH PSILI AND VARIA
+  { 0x1F100301U, 0x1F14 },  // GREEK SMALL LETTER EPSILON WITH PSILI AND OXIA
+  { 0x1F110300U, 0x1F13 },  // GREEK SMALL LETTER EPSILON WITH DASIA AND VARIA
+  { 0x1F110301U, 0x1F15 },  // GREEK SMALL LETTER EPSILON WITH DASIA AND OXIA
+  { 0x1F180300U, 0x1F1A },  // GREEK CAPITAL LETTER EPSILON WITH PSILI AND VARIA
+  { 0x1F180301U, 0x1F1C },  // GREEK CAPITAL LETTER EPSILON WITH PSILI AND OXIA
+  { 0x1F190300U, 0x1F1B },  // GREEK CAPITAL LETTER EPSILON WITH DASIA AND VARIA
+  { 0x1F190301U, 0x1F1D },  // GREEK CAPITAL LETTER EPSILON WITH DASIA AND OXIA
+  { 0x1F200300U, 0x1F22 },  // GREEK SMALL LETTER ETA WITH PSILI AND VARIA
+  { 0x1F200301U, 0x1F24 },  // GREEK SMALL LETTER ETA WITH PSILI AND OXIA
+  { 0x1F200342U, 0x1F26 },  // GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI
+  { 0x1F200345U, 0x1F90 },  // GREEK SMALL LETTER ETA WITH PSILI AND YPOGEGRAMMENI
+  { 0x1F210300U, 0x1F23 },  // GREEK SMALL LETTER ETA WITH DASIA AND VARIA
+  { 0x1F210301U, 0x1F25 },  // GREEK SMALL LETTER ETA WITH DASIA AND OXIA
+  { 0x1F210342U, 0x1F27 },  // GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI
+  { 0x1F210345U, 0x1F91 },  // GREEK SMALL LETTER ETA WITH DASIA AND YPOGEGRAMMENI
+  { 0x1F220345U, 0x1F92 },  // GREEK SMALL LETTER ETA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+  { 0x1F230345U, 0x1F93 },  // GREEK SMALL LETTER ETA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+  { 0x1F240345U, 0x1F94 },  // GREEK SMALL LETTER ETA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+  { 0x1F250345U, 0x1F95 },  // GREEK SMALL LETTER ETA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+  { 0x1F260345U, 0x1F96 },  // GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F270345U, 0x1F97 },  // GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F280300U, 0x1F2A },  // GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA
+  { 0x1F280301U, 0x1F2C },  // GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA
+  { 0x1F280342U, 0x1F2E },  // GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI
+  { 0x1F280345U, 0x1F98 },  // GREEK CAPITAL LETTER ETA WITH PSILI AND PROSGEGRAMMENI
+  { 0x1F290300U, 0x1F2B },  // GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA
+  { 0x1F290301U, 0x1F2D },  // GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA
+  { 0x1F290342U, 0x1F2F },  // GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI
+  { 0x1F290345U, 0x1F99 },  // GREEK CAPITAL LETTER ETA WITH DASIA AND PROSGEGRAMMENI
+  { 0x1F2A0345U, 0x1F9A },  // GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+  { 0x1F2B0345U, 0x1F9B },  // GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+  { 0x1F2C0345U, 0x1F9C },  // GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+  { 0x1F2D0345U, 0x1F9D },  // GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+  { 0x1F2E0345U, 0x1F9E },  // GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1F2F0345U, 0x1F9F },  // GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1F300300U, 0x1F32 },  // GREEK SMALL LETTER IOTA WITH PSILI AND VARIA
+  { 0x1F300301U, 0x1F34 },  // GREEK SMALL LETTER IOTA WITH PSILI AND OXIA
+  { 0x1F300342U, 0x1F36 },  // GREEK SMALL LETTER IOTA WITH PSILI AND PERISPOMENI
+  { 0x1F310300U, 0x1F33 },  // GREEK SMALL LETTER IOTA WITH DASIA AND VARIA
+  { 0x1F310301U, 0x1F35 },  // GREEK SMALL LETTER IOTA WITH DASIA AND OXIA
+  { 0x1F310342U, 0x1F37 },  // GREEK SMALL LETTER IOTA WITH DASIA AND PERISPOMENI
+  { 0x1F380300U, 0x1F3A },  // GREEK CAPITAL LETTER IOTA WITH PSILI AND VARIA
+  { 0x1F380301U, 0x1F3C },  // GREEK CAPITAL LETTER IOTA WITH PSILI AND OXIA
+  { 0x1F380342U, 0x1F3E },  // GREEK CAPITAL LETTER IOTA WITH PSILI AND PERISPOMENI
+  { 0x1F390300U, 0x1F3B },  // GREEK CAPITAL LETTER IOTA WITH DASIA AND VARIA
+  { 0x1F390301U, 0x1F3D },  // GREEK CAPITAL LETTER IOTA WITH DASIA AND OXIA
+  { 0x1F390342U, 0x1F3F },  // GREEK CAPITAL LETTER IOTA WITH DASIA AND PERISPOMENI
+  { 0x1F400300U, 0x1F42 },  // GREEK SMALL LETTER OMICRON WITH PSILI AND VARIA
+  { 0x1F400301U, 0x1F44 },  // GREEK SMALL LETTER OMICRON WITH PSILI AND OXIA
+  { 0x1F410300U, 0x1F43 },  // GREEK SMALL LETTER OMICRON WITH DASIA AND VARIA
+  { 0x1F410301U, 0x1F45 },  // GREEK SMALL LETTER OMICRON WITH DASIA AND OXIA
+  { 0x1F480300U, 0x1F4A },  // GREEK CAPITAL LETTER OMICRON WITH PSILI AND VARIA
+  { 0x1F480301U, 0x1F4C },  // GREEK CAPITAL LETTER OMICRON WITH PSILI AND OXIA
+  { 0x1F490300U, 0x1F4B },  // GREEK CAPITAL LETTER OMICRON WITH DASIA AND VARIA
+  { 0x1F490301U, 0x1F4D },  // GREEK CAPITAL LETTER OMICRON WITH DASIA AND OXIA
+  { 0x1F500300U, 0x1F52 },  // GREEK SMALL LETTER UPSILON WITH PSILI AND VARIA
+  { 0x1F500301U, 0x1F54 },  // GREEK SMALL LETTER UPSILON WITH PSILI AND OXIA
+  { 0x1F500342U, 0x1F56 },  // GREEK SMALL LETTER UPSILON WITH PSILI AND PERISPOMENI
+  { 0x1F510300U, 0x1F53 },  // GREEK SMALL LETTER UPSILON WITH DASIA AND VARIA
+  { 0x1F510301U, 0x1F55 },  // GREEK SMALL LETTER UPSILON WITH DASIA AND OXIA
+  { 0x1F510342U, 0x1F57 },  // GREEK SMALL LETTER UPSILON WITH DASIA AND PERISPOMENI
+  { 0x1F590300U, 0x1F5B },  // GREEK CAPITAL LETTER UPSILON WITH DASIA AND VARIA
+  { 0x1F590301U, 0x1F5D },  // GREEK CAPITAL LETTER UPSILON WITH DASIA AND OXIA
+  { 0x1F590342U, 0x1F5F },  // GREEK CAPITAL LETTER UPSILON WITH DASIA AND PERISPOMENI
+  { 0x1F600300U, 0x1F62 },  // GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA
+  { 0x1F600301U, 0x1F64 },  // GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA
+  { 0x1F600342U, 0x1F66 },  // GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI
+  { 0x1F600345U, 0x1FA0 },  // GREEK SMALL LETTER OMEGA WITH PSILI AND YPOGEGRAMMENI
+  { 0x1F610300U, 0x1F63 },  // GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA
+  { 0x1F610301U, 0x1F65 },  // GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA
+  { 0x1F610342U, 0x1F67 },  // GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI
+  { 0x1F610345U, 0x1FA1 },  // GREEK SMALL LETTER OMEGA WITH DASIA AND YPOGEGRAMMENI
+  { 0x1F620345U, 0x1FA2 },  // GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+  { 0x1F630345U, 0x1FA3 },  // GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+  { 0x1F640345U, 0x1FA4 },  // GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+  { 0x1F650345U, 0x1FA5 },  // GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+  { 0x1F660345U, 0x1FA6 },  // GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F670345U, 0x1FA7 },  // GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F680300U, 0x1F6A },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA
+  { 0x1F680301U, 0x1F6C },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA
+  { 0x1F680342U, 0x1F6E },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI
+  { 0x1F680345U, 0x1FA8 },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PROSGEGRAMMENI
+  { 0x1F690300U, 0x1F6B },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA
+  { 0x1F690301U, 0x1F6D },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA
+  { 0x1F690342U, 0x1F6F },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI
+  { 0x1F690345U, 0x1FA9 },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PROSGEGRAMMENI
+  { 0x1F6A0345U, 0x1FAA },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+  { 0x1F6B0345U, 0x1FAB },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+  { 0x1F6C0345U, 0x1FAC },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+  { 0x1F6D0345U, 0x1FAD },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+  { 0x1F6E0345U, 0x1FAE },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1F6F0345U, 0x1FAF },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1F700345U, 0x1FB2 },  // GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI
+  { 0x1F740345U, 0x1FC2 },  // GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI
+  { 0x1F7C0345U, 0x1FF2 },  // GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI
+  { 0x1FB60345U, 0x1FB7 },  // GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1FBF0300U, 0x1FCD },  // GREEK PSILI AND VARIA
+  { 0x1FBF0301U, 0x1FCE },  // GREEK PSILI AND OXIA
+  { 0x1FBF0342U, 0x1FCF },  // GREEK PSILI AND PERISPOMENI
+  { 0x1FC60345U, 0x1FC7 },  // GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1FF60345U, 0x1FF7 },  // GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1FFE0300U, 0x1FDD },  // GREEK DASIA AND VARIA
+  { 0x1FFE0301U, 0x1FDE },  // GREEK DASIA AND OXIA
+  { 0x1FFE0342U, 0x1FDF },  // GREEK DASIA AND PERISPOMENI
+  { 0x21900338U, 0x219A },  // LEFTWARDS ARROW WITH STROKE
+  { 0x21920338U, 0x219B },  // RIGHTWARDS ARROW WITH STROKE
+  { 0x21940338U, 0x21AE },  // LEFT RIGHT ARROW WITH STROKE
+  { 0x21D00338U, 0x21CD },  // LEFTWARDS DOUBLE ARROW WITH STROKE
+  { 0x21D20338U, 0x21CF },  // RIGHTWARDS DOUBLE ARROW WITH STROKE
+  { 0x21D40338U, 0x21CE },  // LEFT RIGHT DOUBLE ARROW WITH STROKE
+  { 0x22030338U, 0x2204 },  // THERE DOES NOT EXIST
+  { 0x22080338U, 0x2209 },  // NOT AN ELEMENT OF
+  { 0x220B0338U, 0x220C },  // DOES NOT CONTAIN AS MEMBER
+  { 0x22230338U, 0x2224 },  // DOES NOT DIVIDE
+  { 0x22250338U, 0x2226 },  // NOT PARALLEL TO
+  { 0x223C0338U, 0x2241 },  // NOT TILDE
+  { 0x22430338U, 0x2244 },  // NOT ASYMPTOTICALLY EQUAL TO
+  { 0x22450338U, 0x2247 },  // NEITHER APPROXIMATELY NOR ACTUALLY EQUAL TO
+  { 0x22480338U, 0x2249 },  // NOT ALMOST EQUAL TO
+  { 0x224D0338U, 0x226D },  // NOT EQUIVALENT TO
+  { 0x22610338U, 0x2262 },  // NOT IDENTICAL TO
+  { 0x22640338U, 0x2270 },  // NEITHER LESS-THAN NOR EQUAL TO
+  { 0x22650338U, 0x2271 },  // NEITHER GREATER-THAN NOR EQUAL TO
+  { 0x22720338U, 0x2274 },  // NEITHER LESS-THAN NOR EQUIVALENT TO
+  { 0x22730338U, 0x2275 },  // NEITHER GREATER-THAN NOR EQUIVALENT TO
+  { 0x22760338U, 0x2278 },  // NEITHER LESS-THAN NOR GREATER-THAN
+  { 0x22770338U, 0x2279 },  // NEITHER GREATER-THAN NOR LESS-THAN
+  { 0x227A0338U, 0x2280 },  // DOES NOT PRECEDE
+  { 0x227B0338U, 0x2281 },  // DOES NOT SUCCEED
+  { 0x227C0338U, 0x22E0 },  // DOES NOT PRECEDE OR EQUAL
+  { 0x227D0338U, 0x22E1 },  // DOES NOT SUCCEED OR EQUAL
+  { 0x22820338U, 0x2284 },  // NOT A SUBSET OF
+  { 0x22830338U, 0x2285 },  // NOT A SUPERSET OF
+  { 0x22860338U, 0x2288 },  // NEITHER A SUBSET OF NOR EQUAL TO
+  { 0x22870338U, 0x2289 },  // NEITHER A SUPERSET OF NOR EQUAL TO
+  { 0x22910338U, 0x22E2 },  // NOT SQUARE IMAGE OF OR EQUAL TO
+  { 0x22920338U, 0x22E3 },  // NOT SQUARE ORIGINAL OF OR EQUAL TO
+  { 0x22A20338U, 0x22AC },  // DOES NOT PROVE
+  { 0x22A80338U, 0x22AD },  // NOT TRUE
+  { 0x22A90338U, 0x22AE },  // DOES NOT FORCE
+  { 0x22AB0338U, 0x22AF },  // NEGATED DOUBLE VERTICAL BAR DOUBLE RIGHT TURNSTILE
+  { 0x22B20338U, 0x22EA },  // NOT NORMAL SUBGROUP OF
+  { 0x22B30338U, 0x22EB },  // DOES NOT CONTAIN AS NORMAL SUBGROUP
+  { 0x22B40338U, 0x22EC },  // NOT NORMAL SUBGROUP OF OR EQUAL TO
+  { 0x22B50338U, 0x22ED },  // DOES NOT CONTAIN AS NORMAL SUBGROUP OR EQUAL
+  { 0x30463099U, 0x3094 },  // HIRAGANA LETTER VU
+  { 0x304B3099U, 0x304C },  // HIRAGANA LETTER GA
+  { 0x304D3099U, 0x304E },  // HIRAGANA LETTER GI
+  { 0x304F3099U, 0x3050 },  // HIRAGANA LETTER GU
+  { 0x30513099U, 0x3052 },  // HIRAGANA LETTER GE
+  { 0x30533099U, 0x3054 },  // HIRAGANA LETTER GO
+  { 0x30553099U, 0x3056 },  // HIRAGANA LETTER ZA
+  { 0x30573099U, 0x3058 },  // HIRAGANA LETTER ZI
+  { 0x30593099U, 0x305A },  // HIRAGANA LETTER ZU
+  { 0x305B3099U, 0x305C },  // HIRAGANA LETTER ZE
+  { 0x305D3099U, 0x305E },  // HIRAGANA LETTER ZO
+  { 0x305F3099U, 0x3060 },  // HIRAGANA LETTER DA
+  { 0x30613099U, 0x3062 },  // HIRAGANA LETTER DI
+  { 0x30643099U, 0x3065 },  // HIRAGANA LETTER DU
+  { 0x30663099U, 0x3067 },  // HIRAGANA LETTER DE
+  { 0x30683099U, 0x3069 },  // HIRAGANA LETTER DO
+  { 0x306F3099U, 0x3070 },  // HIRAGANA LETTER BA
+  { 0x306F309AU, 0x3071 },  // HIRAGANA LETTER PA
+  { 0x30723099U, 0x3073 },  // HIRAGANA LETTER BI
+  { 0x3072309AU, 0x3074 },  // HIRAGANA LETTER PI
+  { 0x30753099U, 0x3076 },  // HIRAGANA LETTER BU
+  { 0x3075309AU, 0x3077 },  // HIRAGANA LETTER PU
+  { 0x30783099U, 0x3079 },  // HIRAGANA LETTER BE
+  { 0x3078309AU, 0x307A },  // HIRAGANA LETTER PE
+  { 0x307B3099U, 0x307C },  // HIRAGANA LETTER BO
+  { 0x307B309AU, 0x307D },  // HIRAGANA LETTER PO
+  { 0x309D3099U, 0x309E },  // HIRAGANA VOICED ITERATION MARK
+  { 0x30A63099U, 0x30F4 },  // KATAKANA LETTER VU
+  { 0x30AB3099U, 0x30AC },  // KATAKANA LETTER GA
+  { 0x30AD3099U, 0x30AE },  // KATAKANA LETTER GI
+  { 0x30AF3099U, 0x30B0 },  // KATAKANA LETTER GU
+  { 0x30B13099U, 0x30B2 },  // KATAKANA LETTER GE
+  { 0x30B33099U, 0x30B4 },  // KATAKANA LETTER GO
+  { 0x30B53099U, 0x30B6 },  // KATAKANA LETTER ZA
+  { 0x30B73099U, 0x30B8 },  // KATAKANA LETTER ZI
+  { 0x30B93099U, 0x30BA },  // KATAKANA LETTER ZU
+  { 0x30BB3099U, 0x30BC },  // KATAKANA LETTER ZE
+  { 0x30BD3099U, 0x30BE },  // KATAKANA LETTER ZO
+  { 0x30BF3099U, 0x30C0 },  // KATAKANA LETTER DA
+  { 0x30C13099U, 0x30C2 },  // KATAKANA LETTER DI
+  { 0x30C43099U, 0x30C5 },  // KATAKANA LETTER DU
+  { 0x30C63099U, 0x30C7 },  // KATAKANA LETTER DE
+  { 0x30C83099U, 0x30C9 },  // KATAKANA LETTER DO
+  { 0x30CF3099U, 0x30D0 },  // KATAKANA LETTER BA
+  { 0x30CF309AU, 0x30D1 },  // KATAKANA LETTER PA
+  { 0x30D23099U, 0x30D3 },  // KATAKANA LETTER BI
+  { 0x30D2309AU, 0x30D4 },  // KATAKANA LETTER PI
+  { 0x30D53099U, 0x30D6 },  // KATAKANA LETTER BU
+  { 0x30D5309AU, 0x30D7 },  // KATAKANA LETTER PU
+  { 0x30D83099U, 0x30D9 },  // KATAKANA LETTER BE
+  { 0x30D8309AU, 0x30DA },  // KATAKANA LETTER PE
+  { 0x30DB3099U, 0x30DC },  // KATAKANA LETTER BO
+  { 0x30DB309AU, 0x30DD },  // KATAKANA LETTER PO
+  { 0x30EF3099U, 0x30F7 },  // KATAKANA LETTER VA
+  { 0x30F03099U, 0x30F8 },  // KATAKANA LETTER VI
+  { 0x30F13099U, 0x30F9 },  // KATAKANA LETTER VE
+  { 0x30F23099U, 0x30FA },  // KATAKANA LETTER VO
+  { 0x30FD3099U, 0x30FE },  // KATAKANA VOICED ITERATION MARK
+};
+
+constexpr FoldEntry kFolds[] = {
+  { 0x00A0, 1, { 0x0020 } },  // NO-BREAK SPACE
+  { 0x00A8, 1, { 0x0020 } },  // DIAERESIS
+  { 0x00A9, 3, { 0x0028, 0x0063, 0x0029 } },  // COPYRIGHT SIGN
+  { 0x00AA, 1, { 0x0061 } },  // FEMININE ORDINAL INDICATOR
+  { 0x00AB, 2, { 0x003C, 0x003C } },  // LEFT-POINTING DOUBLE ANGLE QUOTATION MARK
+  { 0x00AD, 0, { 0 } },  // SOFT HYPHEN
+  { 0x00AE, 3, { 0x0028, 0x0052, 0x0029 } },  // REGISTERED SIGN
+  { 0x00AF, 1, { 0x0020 } },  // MACRON
+  { 0x00B2, 1, { 0x0032 } },  // SUPERSCRIPT TWO
+  { 0x00B3, 1, { 0x0033 } },  // SUPERSCRIPT THREE
+  { 0x00B4, 1, { 0x0020 } },  // ACUTE ACCENT
+  { 0x00B5, 1, { 0x03BC } },  // MICRO SIGN
+  { 0x00B7, 1, { 0x002E } },  // MIDDLE DOT
+  { 0x00B8, 1, { 0x0020 } },  // CEDILLA
+  { 0x00B9, 1, { 0x0031 } },  // SUPERSCRIPT ONE
+  { 0x00BA, 1, { 0x006F } },  // MASCULINE ORDINAL INDICATOR
+  { 0x00BB, 2, { 0x003E, 0x003E } },  // RIGHT-POINTING DOUBLE ANGLE QUOTATION MARK
+  { 0x00BC, 3, { 0x0031, 0x002F, 0x0034 } },  // VULGAR FRACTION ONE QUARTER
+  { 0x00BD, 3, { 0x0031, 0x002F, 0x0032 } },  // VULGAR FRACTION ONE HALF
+  { 0x00BE, 3, { 0x0033, 0x002F, 0x0034 } },  // VULGAR FRACTION THREE QUARTERS
+  { 0x00C0, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH GRAVE
+  { 0x00C1, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH ACUTE
+  { 0x00C2, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX
+  { 0x00C3, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH TILDE
+  { 0x00C4, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH DIAERESIS
+  { 0x00C5, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH RING ABOVE
+  { 0x00C6, 2, { 0x0041, 0x0045 } },  // LATIN CAPITAL LETTER AE
+  { 0x00C7, 1, { 0x0043 } },  // LATIN CAPITAL LETTER C WITH CEDILLA
+  { 0x00C8, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH GRAVE
+  { 0x00C9, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH ACUTE
+  { 0x00CA, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX
+  { 0x00CB, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH DIAERESIS
+  { 0x00CC, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH GRAVE
+  { 0x00CD, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH ACUTE
+  { 0x00CE, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH CIRCUMFLEX
+  { 0x00CF, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH DIAERESIS
+  { 0x00D0, 1, { 0x0044 } },  // LATIN CAPITAL LETTER ETH
+  { 0x00D1, 1, { 0x004E } },  // LATIN CAPITAL LETTER N WITH TILDE
+  { 0x00D2, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH GRAVE
+  { 0x00D3, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH ACUTE
+  { 0x00D4, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX
+  { 0x00D5, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH TILDE
+  { 0x00D6, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH DIAERESIS
+  { 0x00D7, 1, { 0x0078 } },  // MULTIPLICATION SIGN
+  { 0x00D8, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH STROKE
+  { 0x00D9, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH GRAVE
+  { 0x00DA, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH ACUTE
+  { 0x00DB, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH CIRCUMFLEX
+  { 0x00DC, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH DIAERESIS
+  { 0x00DD, 1, { 0x0059 } },  // LATIN CAPITAL LETTER Y WITH ACUTE
+  { 0x00DE, 2, { 0x0054, 0x0068 } },  // LATIN CAPITAL LETTER THORN
+  { 0x00DF, 2, { 0x0073, 0x0073 } },  // LATIN SMALL LETTER SHARP S
+  { 0x00E0, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH GRAVE
+  { 0x00E1, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH ACUTE
+  { 0x00E2, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH CIRCUMFLEX
+  { 0x00E3, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH TILDE
+  { 0x00E4, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH DIAERESIS
+  { 0x00E5, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH RING ABOVE
+  { 0x00E6, 2, { 0x0061, 0x0065 } },  // LATIN SMALL LETTER AE
+  { 0x00E7, 1, { 0x0063 } },  // LATIN SMALL LETTER C WITH CEDILLA
+  { 0x00E8, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH GRAVE
+  { 0x00E9, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH ACUTE
+  { 0x00EA, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH CIRCUMFLEX
+  { 0x00EB, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH DIAERESIS
+  { 0x00EC, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH GRAVE
+  { 0x00ED, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH ACUTE
+  { 0x00EE, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH CIRCUMFLEX
+  { 0x00EF, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH DIAERESIS
+  { 0x00F0, 1, { 0x0064 } },  // LATIN SMALL LETTER ETH
+  { 0x00F1, 1, { 0x006E } },  // LATIN SMALL LETTER N WITH TILDE
+  { 0x00F2, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH GRAVE
+  { 0x00F3, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH ACUTE
+  { 0x00F4, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH CIRCUMFLEX
+  { 0x00F5, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH TILDE
+  { 0x00F6, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH DIAERESIS
+  { 0x00F7, 1, { 0x002F } },  // DIVISION SIGN
+  { 0x00F8, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH STROKE
+  { 0x00F9, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH GRAVE
+  { 0x00FA, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH ACUTE
+  { 0x00FB, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH CIRCUMFLEX
+  { 0x00FC, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH DIAERESIS
+  { 0x00FD, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH ACUTE
+  { 0x00FE, 2, { 0x0074, 0x0068 } },  // LATIN SMALL LETTER THORN
+  { 0x00FF, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH DIAERESIS
+  { 0x0100, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH MACRON
+  { 0x0101, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH MACRON
+  { 0x0102, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH BREVE
+  { 0x0103, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH BREVE
+  { 0x0104, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH OGONEK
+  { 0x0105, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH OGONEK
+  { 0x0106, 1, { 0x0043 } },  // LATIN CAPITAL LETTER C WITH ACUTE
+  { 0x0107, 1, { 0x0063 } },  // LATIN SMALL LETTER C WITH ACUTE
+  { 0x0108, 1, { 0x0043 } },  // LATIN CAPITAL LETTER C WITH CIRCUMFLEX
+  { 0x0109, 1, { 0x0063 } },  // LATIN SMALL LETTER C WITH CIRCUMFLEX
+  { 0x010A, 1, { 0x0043 } },  // LATIN CAPITAL LETTER C WITH DOT ABOVE
+  { 0x010B, 1, { 0x0063 } },  // LATIN SMALL LETTER C WITH DOT ABOVE
+  { 0x010C, 1, { 0x0043 } },  // LATIN CAPITAL LETTER C WITH CARON
+  { 0x010D, 1, { 0x0063 } },  // LATIN SMALL LETTER C WITH CARON
+  { 0x010E, 1, { 0x0044 } },  // LATIN CAPITAL LETTER D WITH CARON
+  { 0x010F, 1, { 0x0064 } },  // LATIN SMALL LETTER D WITH CARON
+  { 0x0110, 1, { 0x0044 } },  // LATIN CAPITAL LETTER D WITH STROKE
+  { 0x0111, 1, { 0x0064 } },  // LATIN SMALL LETTER D WITH STROKE
+  { 0x0112, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH MACRON
+  { 0x0113, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH MACRON
+  { 0x0114, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH BREVE
+  { 0x0115, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH BREVE
+  { 0x0116, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH DOT ABOVE
+  { 0x0117, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH DOT ABOVE
+  { 0x0118, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH OGONEK
+  { 0x0119, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH OGONEK
+  { 0x011A, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH CARON
+  { 0x011B, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH CARON
+  { 0x011C, 1, { 0x0047 } },  // LATIN CAPITAL LETTER G WITH CIRCUMFLEX
+  { 0x011D, 1, { 0x0067 } },  // LATIN SMALL LETTER G WITH CIRCUMFLEX
+  { 0x011E, 1, { 0x0047 } },  // LATIN CAPITAL LETTER G WITH BREVE
+  { 0x011F, 1, { 0x0067 } },  // LATIN SMALL LETTER G WITH BREVE
+  { 0x0120, 1, { 0x0047 } },  // LATIN CAPITAL LETTER G WITH DOT ABOVE
+  { 0x0121, 1, { 0x0067 } },  // LATIN SMALL LETTER G WITH DOT ABOVE
+  { 0x0122, 1, { 0x0047 } },  // LATIN CAPITAL LETTER G WITH CEDILLA
+  { 0x0123, 1, { 0x0067 } },  // LATIN SMALL LETTER G WITH CEDILLA
+  { 0x0124, 1, { 0x0048 } },  // LATIN CAPITAL LETTER H WITH CIRCUMFLEX
+  { 0x0125, 1, { 0x0068 } },  // LATIN SMALL LETTER H WITH CIRCUMFLEX
+  { 0x0126, 1, { 0x0048 } },  // LATIN CAPITAL LETTER H WITH STROKE
+  { 0x0127, 1, { 0x0068 } },  // LATIN SMALL LETTER H WITH STROKE
+  { 0x0128, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH TILDE
+  { 0x0129, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH TILDE
+  { 0x012A, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH MACRON
+  { 0x012B, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH MACRON
+  { 0x012C, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH BREVE
+  { 0x012D, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH BREVE
+  { 0x012E, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH OGONEK
+  { 0x012F, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH OGONEK
+  { 0x0130, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH DOT ABOVE
+  { 0x0131, 1, { 0x0069 } },  // LATIN SMALL LETTER DOTLESS I
+  { 0x0132, 2, { 0x0049, 0x004A } },  // LATIN CAPITAL LIGATURE IJ
+  { 0x0133, 2, { 0x0069, 0x006A } },  // LATIN SMALL LIGATURE IJ
+  { 0x0134, 1, { 0x004A } },  // LATIN CAPITAL LETTER J WITH CIRCUMFLEX
+  { 0x0135, 1, { 0x006A } },  // LATIN SMALL LETTER J WITH CIRCUMFLEX
+  { 0x0136, 1, { 0x004B } },  // LATIN CAPITAL LETTER K WITH CEDILLA
+  { 0x0137, 1, { 0x006B } },  // LATIN SMALL LETTER K WITH CEDILLA
+  { 0x0138, 1, { 0x0071 } },  // LATIN SMALL LETTER KRA
+  { 0x0139, 1, { 0x004C } },  // LATIN CAPITAL LETTER L WITH ACUTE
+  { 0x013A, 1, { 0x006C } },  // LATIN SMALL LETTER L WITH ACUTE
+  { 0x013B, 1, { 0x004C } },  // LATIN CAPITAL LETTER L WITH CEDILLA
+  { 0x013C, 1, { 0x006C } },  // LATIN SMALL LETTER L WITH CEDILLA
+  { 0x013D, 1, { 0x004C } },  // LATIN CAPITAL LETTER L WITH CARON
+  { 0x013E, 1, { 0x006C } },  // LATIN SMALL LETTER L WITH CARON
+  { 0x013F, 2, { 0x004C, 0x00B7 } },  // LATIN CAPITAL LETTER L WITH MIDDLE DOT
+  { 0x0140, 2, { 0x006C, 0x00B7 } },  // LATIN SMALL LETTER L WITH MIDDLE DOT
+  { 0x0141, 1, { 0x004C } },  // LATIN CAPITAL LETTER L WITH STROKE
+  { 0x0142, 1, { 0x006C } },  // LATIN SMALL LETTER L WITH STROKE
+  { 0x0143, 1, { 0x004E } },  // LATIN CAPITAL LETTER N WITH ACUTE
+  { 0x0144, 1, { 0x006E } },  // LATIN SMALL LETTER N WITH ACUTE
+  { 0x0145, 1, { 0x004E } },  // LATIN CAPITAL LETTER N WITH CEDILLA
+  { 0x0146, 1, { 0x006E } },  // LATIN SMALL LETTER N WITH CEDILLA
+  { 0x0147, 1, { 0x004E } },  // LATIN CAPITAL LETTER N WITH CARON
+  { 0x0148, 1, { 0x006E } },  // LATIN SMALL LETTER N WITH CARON
+  { 0x0149, 2, { 0x02BC, 0x006E } },  // LATIN SMALL LETTER N PRECEDED BY APOSTROPHE
+  { 0x014A, 1, { 0x004E } },  // LATIN CAPITAL LETTER ENG
+  { 0x014B, 1, { 0x006E } },  // LATIN SMALL LETTER ENG
+  { 0x014C, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH MACRON
+  { 0x014D, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH MACRON
+  { 0x014E, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH BREVE
+  { 0x014F, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH BREVE
+  { 0x0150, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH DOUBLE ACUTE
+  { 0x0151, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH DOUBLE ACUTE
+  { 0x0152, 2, { 0x004F, 0x0045 } },  // LATIN CAPITAL LIGATURE OE
+  { 0x0153, 2, { 0x006F, 0x0065 } },  // LATIN SMALL LIGATURE OE
+  { 0x0154, 1, { 0x0052 } },  // LATIN CAPITAL LETTER R WITH ACUTE
+  { 0x0155, 1, { 0x0072 } },  // LATIN SMALL LETTER R WITH ACUTE
+  { 0x0156, 1, { 0x0052 } },  // LATIN CAPITAL LETTER R WITH CEDILLA
+  { 0x0157, 1, { 0x0072 } },  // LATIN SMALL LETTER R WITH CEDILLA
+  { 0x0158, 1, { 0x0052 } },  // LATIN CAPITAL LETTER R WITH CARON
+  { 0x0159, 1, { 0x0072 } },  // LATIN SMALL LETTER R WITH CARON
+  { 0x015A, 1, { 0x0053 } },  // LATIN CAPITAL LETTER S WITH ACUTE
+  { 0x015B, 1, { 0x0073 } },  // LATIN SMALL LETTER S WITH ACUTE
+  { 0x015C, 1, { 0x0053 } },  // LATIN CAPITAL LETTER S WITH CIRCUMFLEX
+  { 0x015D, 1, { 0x0073 } },  // LATIN SMALL LETTER S WITH CIRCUMFLEX
+  { 0x015E, 1, { 0x0053 } },  // LATIN CAPITAL LETTER S WITH CEDILLA
+  { 0x015F, 1, { 0x0073 } },  // LATIN SMALL LETTER S WITH CEDILLA
+  { 0x0160, 1, { 0x0053 } },  // LATIN CAPITAL LETTER S WITH CARON
+  { 0x0161, 1, { 0x0073 } },  // LATIN SMALL LETTER S WITH CARON
+  { 0x0162, 1, { 0x0054 } },  // LATIN CAPITAL LETTER T WITH CEDILLA
+  { 0x0163, 1, { 0x0074 } },  // LATIN SMALL LETTER T WITH CEDILLA
+  { 0x0164, 1, { 0x0054 } },  // LATIN CAPITAL LETTER T WITH CARON
+  { 0x0165, 1, { 0x0074 } },  // LATIN SMALL LETTER T WITH CARON
+  { 0x0166, 1, { 0x0054 } },  // LATIN CAPITAL LETTER T WITH STROKE
+  { 0x0167, 1, { 0x0074 } },  // LATIN SMALL LETTER T WITH STROKE
+  { 0x0168, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH TILDE
+  { 0x0169, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH TILDE
+  { 0x016A, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH MACRON
+  { 0x016B, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH MACRON
+  { 0x016C, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH BREVE
+  { 0x016D, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH BREVE
+  { 0x016E, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH RING ABOVE
+  { 0x016F, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH RING ABOVE
+  { 0x0170, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH DOUBLE ACUTE
+  { 0x0171, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH DOUBLE ACUTE
+  { 0x0172, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH OGONEK
+  { 0x0173, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH OGONEK
+  { 0x0174, 1, { 0x0057 } },  // LATIN CAPITAL LETTER W WITH CIRCUMFLEX
+  { 0x0175, 1, { 0x0077 } },  // LATIN SMALL LETTER W WITH CIRCUMFLEX
+  { 0x0176, 1, { 0x0059 } },  // LATIN CAPITAL LETTER Y WITH CIRCUMFLEX
+  { 0x0177, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH CIRCUMFLEX
+  { 0x0178, 1, { 0x0059 } },  // LATIN CAPITAL LETTER Y WITH DIAERESIS
+  { 0x0179, 1, { 0x005A } },  // LATIN CAPITAL LETTER Z WITH ACUTE
+  { 0x017A, 1, { 0x007A } },  // LATIN SMALL LETTER Z WITH ACUTE
+  { 0x017B, 1, { 0x005A } },  // LATIN CAPITAL LETTER Z WITH DOT ABOVE
+  { 0x017C, 1, { 0x007A } },  // LATIN SMALL LETTER Z WITH DOT ABOVE
+  { 0x017D, 1, { 0x005A } },  // LATIN CAPITAL LETTER Z WITH CARON
+  { 0x017E, 1, { 0x007A } },  // LATIN SMALL LETTER Z WITH CARON
+  { 0x017F, 1, { 0x0073 } },  // LATIN SMALL LETTER LONG S
+  { 0x018F, 1, { 0x0045 } },  // LATIN CAPITAL LETTER SCHWA
+  { 0x0192, 1, { 0x0066 } },  // LATIN SMALL LETTER F WITH HOOK
+  { 0x01A0, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH HORN
+  { 0x01A1, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH HORN
+  { 0x01AF, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH HORN
+  { 0x01B0, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH HORN
+  { 0x01C4, 2, { 0x0044, 0x017D } },  // LATIN CAPITAL LETTER DZ WITH CARON
+  { 0x01C5, 2, { 0x0044, 0x017E } },  // LATIN CAPITAL LETTER D WITH SMALL LETTER Z WITH CARON
+  { 0x01C6, 2, { 0x0064, 0x017E } },  // LATIN SMALL LETTER DZ WITH CARON
+  { 0x01C7, 2, { 0x004C, 0x004A } },  // LATIN CAPITAL LETTER LJ
+  { 0x01C8, 2, { 0x004C, 0x006A } },  // LATIN CAPITAL LETTER L WITH SMALL LETTER J
+  { 0x01C9, 2, { 0x006C, 0x006A } },  // LATIN SMALL LETTER LJ
+  { 0x01CA, 2, { 0x004E, 0x004A } },  // LATIN CAPITAL LETTER NJ
+  { 0x01CB, 2, { 0x004E, 0x006A } },  // LATIN CAPITAL LETTER N WITH SMALL LETTER J
+  { 0x01CC, 2, { 0x006E, 0x006A } },  // LATIN SMALL LETTER NJ
+  { 0x01CD, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH CARON
+  { 0x01CE, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH CARON
+  { 0x01CF, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH CARON
+  { 0x01D0, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH CARON
+  { 0x01D1, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH CARON
+  { 0x01D2, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH CARON
+  { 0x01D3, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH CARON
+  { 0x01D4, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH CARON
+  { 0x01D5, 1, { 0x00DC } },  // LATIN CAPITAL LETTER U WITH DIAERESIS AND MACRON
+  { 0x01D6, 1, { 0x00FC } },  // LATIN SMALL LETTER U WITH DIAERESIS AND MACRON
+  { 0x01D7, 1, { 0x00DC } },  // LATIN CAPITAL LETTER U WITH DIAERESIS AND ACUTE
+  { 0x01D8, 1, { 0x00FC } },  // LATIN SMALL LETTER U WITH DIAERESIS AND ACUTE
+  { 0x01D9, 1, { 0x00DC } },  // LATIN CAPITAL LETTER U WITH DIAERESIS AND CARON
+  { 0x01DA, 1, { 0x00FC } },  // LATIN SMALL LETTER U WITH DIAERESIS AND CARON
+  { 0x01DB, 1, { 0x00DC } },  // LATIN CAPITAL LETTER U WITH DIAERESIS AND GRAVE
+  { 0x01DC, 1, { 0x00FC } },  // LATIN SMALL LETTER U WITH DIAERESIS AND GRAVE
+  { 0x01DE, 1, { 0x00C4 } },  // LATIN CAPITAL LETTER A WITH DIAERESIS AND MACRON
+  { 0x01DF, 1, { 0x00E4 } },  // LATIN SMALL LETTER A WITH DIAERESIS AND MACRON
+  { 0x01E0, 1, { 0x0226 } },  // LATIN CAPITAL LETTER A WITH DOT ABOVE AND MACRON
+  { 0x01E1, 1, { 0x0227 } },  // LATIN SMALL LETTER A WITH DOT ABOVE AND MACRON
+  { 0x01E2, 1, { 0x00C6 } },  // LATIN CAPITAL LETTER AE WITH MACRON
+  { 0x01E3, 1, { 0x00E6 } },  // LATIN SMALL LETTER AE WITH MACRON
+  { 0x01E6, 1, { 0x0047 } },  // LATIN CAPITAL LETTER G WITH CARON
+  { 0x01E7, 1, { 0x0067 } },  // LATIN SMALL LETTER G WITH CARON
+  { 0x01E8, 1, { 0x004B } },  // LATIN CAPITAL LETTER K WITH CARON
+  { 0x01E9, 1, { 0x006B } },  // LATIN SMALL LETTER K WITH CARON
+  { 0x01EA, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH OGONEK
+  { 0x01EB, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH OGONEK
+  { 0x01EC, 1, { 0x01EA } },  // LATIN CAPITAL LETTER O WITH OGONEK AND MACRON
+  { 0x01ED, 1, { 0x01EB } },  // LATIN SMALL LETTER O WITH OGONEK AND MACRON
+  { 0x01EE, 1, { 0x01B7 } },  // LATIN CAPITAL LETTER EZH WITH CARON
+  { 0x01EF, 1, { 0x0292 } },  // LATIN SMALL LETTER EZH WITH CARON
+  { 0x01F0, 1, { 0x006A } },  // LATIN SMALL LETTER J WITH CARON
+  { 0x01F1, 2, { 0x0044, 0x005A } },  // LATIN CAPITAL LETTER DZ
+  { 0x01F2, 2, { 0x0044, 0x007A } },  // LATIN CAPITAL LETTER D WITH SMALL LETTER Z
+  { 0x01F3, 2, { 0x0064, 0x007A } },  // LATIN SMALL LETTER DZ
+  { 0x01F4, 1, { 0x0047 } },  // LATIN CAPITAL LETTER G WITH ACUTE
+  { 0x01F5, 1, { 0x0067 } },  // LATIN SMALL LETTER G WITH ACUTE
+  { 0x01F8, 1, { 0x004E } },  // LATIN CAPITAL LETTER N WITH GRAVE
+  { 0x01F9, 1, { 0x006E } },  // LATIN SMALL LETTER N WITH GRAVE
+  { 0x01FA, 1, { 0x00C5 } },  // LATIN CAPITAL LETTER A WITH RING ABOVE AND ACUTE
+  { 0x01FB, 1, { 0x00E5 } },  // LATIN SMALL LETTER A WITH RING ABOVE AND ACUTE
+  { 0x01FC, 1, { 0x00C6 } },  // LATIN CAPITAL LETTER AE WITH ACUTE
+  { 0x01FD, 1, { 0x00E6 } },  // LATIN SMALL LETTER AE WITH ACUTE
+  { 0x01FE, 1, { 0x00D8 } },  // LATIN CAPITAL LETTER O WITH STROKE AND ACUTE
+  { 0x01FF, 1, { 0x00F8 } },  // LATIN SMALL LETTER O WITH STROKE AND ACUTE
+  { 0x0200, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH DOUBLE GRAVE
+  { 0x0201, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH DOUBLE GRAVE
+  { 0x0202, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH INVERTED BREVE
+  { 0x0203, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH INVERTED BREVE
+  { 0x0204, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH DOUBLE GRAVE
+  { 0x0205, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH DOUBLE GRAVE
+  { 0x0206, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH INVERTED BREVE
+  { 0x0207, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH INVERTED BREVE
+  { 0x0208, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH DOUBLE GRAVE
+  { 0x0209, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH DOUBLE GRAVE
+  { 0x020A, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH INVERTED BREVE
+  { 0x020B, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH INVERTED BREVE
+  { 0x020C, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH DOUBLE GRAVE
+  { 0x020D, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH DOUBLE GRAVE
+  { 0x020E, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH INVERTED BREVE
+  { 0x020F, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH INVERTED BREVE
+  { 0x0210, 1, { 0x0052 } },  // LATIN CAPITAL LETTER R WITH DOUBLE GRAVE
+  { 0x0211, 1, { 0x0072 } },  // LATIN SMALL LETTER R WITH DOUBLE GRAVE
+  { 0x0212, 1, { 0x0052 } },  // LATIN CAPITAL LETTER R WITH INVERTED BREVE
+  { 0x0213, 1, { 0x0072 } },  // LATIN SMALL LETTER R WITH INVERTED BREVE
+  { 0x0214, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH DOUBLE GRAVE
+  { 0x0215, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH DOUBLE GRAVE
+  { 0x0216, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH INVERTED BREVE
+  { 0x0217, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH INVERTED BREVE
+  { 0x0218, 1, { 0x0053 } },  // LATIN CAPITAL LETTER S WITH COMMA BELOW
+  { 0x0219, 1, { 0x0073 } },  // LATIN SMALL LETTER S WITH COMMA BELOW
+  { 0x021A, 1, { 0x0054 } },  // LATIN CAPITAL LETTER T WITH COMMA BELOW
+  { 0x021B, 1, { 0x0074 } },  // LATIN SMALL LETTER T WITH COMMA BELOW
+  { 0x021E, 1, { 0x0048 } },  // LATIN CAPITAL LETTER H WITH CARON
+  { 0x021F, 1, { 0x0068 } },  // LATIN SMALL LETTER H WITH CARON
+  { 0x0226, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH DOT ABOVE
+  { 0x0227, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH DOT ABOVE
+  { 0x0228, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH CEDILLA
+  { 0x0229, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH CEDILLA
+  { 0x022A, 1, { 0x00D6 } },  // LATIN CAPITAL LETTER O WITH DIAERESIS AND MACRON
+  { 0x022B, 1, { 0x00F6 } },  // LATIN SMALL LETTER O WITH DIAERESIS AND MACRON
+  { 0x022C, 1, { 0x00D5 } },  // LATIN CAPITAL LETTER O WITH TILDE AND MACRON
+  { 0x022D, 1, { 0x00F5 } },  // LATIN SMALL LETTER O WITH TILDE AND MACRON
+  { 0x022E, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH DOT ABOVE
+  { 0x022F, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH DOT ABOVE
+  { 0x0230, 1, { 0x022E } },  // LATIN CAPITAL LETTER O WITH DOT ABOVE AND MACRON
+  { 0x0231, 1, { 0x022F } },  // LATIN SMALL LETTER O WITH DOT ABOVE AND MACRON
+  { 0x0232, 1, { 0x0059 } },  // LATIN CAPITAL LETTER Y WITH MACRON
+  { 0x0233, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH MACRON
+  { 0x0259, 1, { 0x0065 } },  // LATIN SMALL LETTER SCHWA
+  { 0x02B0, 1, { 0x0068 } },  // MODIFIER LETTER SMALL H
+  { 0x02B1, 1, { 0x0266 } },  // MODIFIER LETTER SMALL H WITH HOOK
+  { 0x02B2, 1, { 0x006A } },  // MODIFIER LETTER SMALL J
+  { 0x02B3, 1, { 0x0072 } },  // MODIFIER LETTER SMALL R
+  { 0x02B4, 1, { 0x0279 } },  // MODIFIER LETTER SMALL TURNED R
+  { 0x02B5, 1, { 0x027B } },  // MODIFIER LETTER SMALL TURNED R WITH HOOK
+  { 0x02B6, 1, { 0x0281 } },  // MODIFIER LETTER SMALL CAPITAL INVERTED R
+  { 0x02B7, 1, { 0x0077 } },  // MODIFIER LETTER SMALL W
+  { 0x02B8, 1, { 0x0079 } },  // MODIFIER LETTER SMALL Y
+  { 0x02BB, 1, { 0x0027 } },  // MODIFIER LETTER TURNED COMMA
+  { 0x02BC, 1, { 0x0027 } },  // MODIFIER LETTER APOSTROPHE
+  { 0x02D8, 1, { 0x0020 } },  // BREVE
+  { 0x02D9, 1, { 0x0020 } },  // DOT ABOVE
+  { 0x02DA, 1, { 0x0020 } },  // RING ABOVE
+  { 0x02DB, 1, { 0x0020 } },  // OGONEK
+  { 0x02DC, 1, { 0x0020 } },  // SMALL TILDE
+  { 0x02DD, 1, { 0x0020 } },  // DOUBLE ACUTE ACCENT
+  { 0x02E0, 1, { 0x0263 } },  // MODIFIER LETTER SMALL GAMMA
+  { 0x02E1, 1, { 0x006C } },  // MODIFIER LETTER SMALL L
+  { 0x02E2, 1, { 0x0073 } },  // MODIFIER LETTER SMALL S
+  { 0x02E3, 1, { 0x0078 } },  // MODIFIER LETTER SMALL X
+  { 0x02E4, 1, { 0x0295 } },  // MODIFIER LETTER SMALL REVERSED GLOTTAL STOP
+  { 0x0374, 1, { 0x02B9 } },  // GREEK NUMERAL SIGN
+  { 0x037A, 1, { 0x0020 } },  // GREEK YPOGEGRAMMENI
+  { 0x037E, 1, { 0x003B } },  // GREEK QUESTION MARK
+  { 0x0384, 1, { 0x0020 } },  // GREEK TONOS
+  { 0x0385, 1, { 0x00A8 } },  // GREEK DIALYTIKA TONOS
+  { 0x0386, 1, { 0x0391 } },  // GREEK CAPITAL LETTER ALPHA WITH TONOS
+  { 0x0387, 1, { 0x00B7 } },  // GREEK ANO TELEIA
+  { 0x0388, 1, { 0x0395 } },  // GREEK CAPITAL LETTER EPSILON WITH TONOS
+  { 0x0389, 1, { 0x0397 } },  // GREEK CAPITAL LETTER ETA WITH TONOS
+  { 0x038A, 1, { 0x0399 } },  // GREEK CAPITAL LETTER IOTA WITH TONOS
+  { 0x038C, 1, { 0x039F } },  // GREEK CAPITAL LETTER OMICRON WITH TONOS
+  { 0x038E, 1, { 0x03A5 } },  // GREEK CAPITAL LETTER UPSILON WITH TONOS
+  { 0x038F, 1, { 0x03A9 } },  // GREEK CAPITAL LETTER OMEGA WITH TONOS
+  { 0x0390, 1, { 0x03CA } },  // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS
+  { 0x0391, 1, { 0x0041 } },  // GREEK CAPITAL LETTER ALPHA
+  { 0x0392, 1, { 0x0042 } },  // GREEK CAPITAL LETTER BETA
+  { 0x0393, 1, { 0x0047 } },  // GREEK CAPITAL LETTER GAMMA
+  { 0x0394, 1, { 0x0044 } },  // GREEK CAPITAL LETTER DELTA
+  { 0x0395, 1, { 0x0045 } },  // GREEK CAPITAL LETTER EPSILON
+  { 0x0396, 1, { 0x005A } },  // GREEK CAPITAL LETTER ZETA
+  { 0x0397, 1, { 0x0049 } },  // GREEK CAPITAL LETTER ETA
+  { 0x0398, 2, { 0x0054, 0x0068 } },  // GREEK CAPITAL LETTER THETA
+  { 0x0399, 1, { 0x0049 } },  // GREEK CAPITAL LETTER IOTA
+  { 0x039A, 1, { 0x004B } },  // GREEK CAPITAL LETTER KAPPA
+  { 0x039B, 1, { 0x004C } },  // GREEK CAPITAL LETTER LAMDA
+  { 0x039C, 1, { 0x004D } },  // GREEK CAPITAL LETTER MU
+  { 0x039D, 1, { 0x004E } },  // GREEK CAPITAL LETTER NU
+  { 0x039E, 1, { 0x0058 } },  // GREEK CAPITAL LETTER XI
+  { 0x039F, 1, { 0x004F } },  // GREEK CAPITAL LETTER OMICRON
+  { 0x03A0, 1, { 0x0050 } },  // GREEK CAPITAL LETTER PI
+  { 0x03A1, 1, { 0x0052 } },  // GREEK CAPITAL LETTER RHO
+  { 0x03A3, 1, { 0x0053 } },  // GREEK CAPITAL LETTER SIGMA
+  { 0x03A4, 1, { 0x0054 } },  // GREEK CAPITAL LETTER TAU
+  { 0x03A5, 1, { 0x0059 } },  // GREEK CAPITAL LETTER UPSILON
+  { 0x03A6, 1, { 0x0046 } },  // GREEK CAPITAL LETTER PHI
+  { 0x03A7, 2, { 0x0043, 0x0068 } },  // GREEK CAPITAL LETTER CHI
+  { 0x03A8, 2, { 0x0050, 0x0073 } },  // GREEK CAPITAL LETTER PSI
+  { 0x03A9, 1, { 0x004F } },  // GREEK CAPITAL LETTER OMEGA
+  { 0x03AA, 1, { 0x0399 } },  // GREEK CAPITAL LETTER IOTA WITH DIALYTIKA
+  { 0x03AB, 1, { 0x03A5 } },  // GREEK CAPITAL LETTER UPSILON WITH DIALYTIKA
+  { 0x03AC, 1, { 0x03B1 } },  // GREEK SMALL LETTER ALPHA WITH TONOS
+  { 0x03AD, 1, { 0x03B5 } },  // GREEK SMALL LETTER EPSILON WITH TONOS
+  { 0x03AE, 1, { 0x03B7 } },  // GREEK SMALL LETTER ETA WITH TONOS
+  { 0x03AF, 1, { 0x03B9 } },  // GREEK SMALL LETTER IOTA WITH TONOS
+  { 0x03B0, 1, { 0x03CB } },  // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS
+  { 0x03B1, 1, { 0x0061 } },  // GREEK SMALL LETTER ALPHA
+  { 0x03B2, 1, { 0x0062 } },  // GREEK SMALL LETTER BETA
+  { 0x03B3, 1, { 0x0067 } },  // GREEK SMALL LETTER GAMMA
+  { 0x03B4, 1, { 0x0064 } },  // GREEK SMALL LETTER DELTA
+  { 0x03B5, 1, { 0x0065 } },  // GREEK SMALL LETTER EPSILON
+  { 0x03B6, 1, { 0x007A } },  // GREEK SMALL LETTER ZETA
+  { 0x03B7, 1, { 0x0069 } },  // GREEK SMALL LETTER ETA
+  { 0x03B8, 2, { 0x0074, 0x0068 } },  // GREEK SMALL LETTER THETA
+  { 0x03B9, 1, { 0x0069 } },  // GREEK SMALL LETTER IOTA
+  { 0x03BA, 1, { 0x006B } },  // GREEK SMALL LETTER KAPPA
+  { 0x03BB, 1, { 0x006C } },  // GREEK SMALL LETTER LAMDA
+  { 0x03BC, 1, { 0x006D } },  // GREEK SMALL LETTER MU
+  { 0x03BD, 1, { 0x006E } },  // GREEK SMALL LETTER NU
+  { 0x03BE, 1, { 0x0078 } },  // GREEK SMALL LETTER XI
+  { 0x03BF, 1, { 0x006F } },  // GREEK SMALL LETTER OMICRON
+  { 0x03C0, 1, { 0x0070 } },  // GREEK SMALL LETTER PI
+  { 0x03C1, 1, { 0x0072 } },  // GREEK SMALL LETTER RHO
+  { 0x03C2, 1, { 0x0073 } },  // GREEK SMALL LETTER FINAL SIGMA
+  { 0x03C3, 1, { 0x0073 } },  // GREEK SMALL LETTER SIGMA
+  { 0x03C4, 1, { 0x0074 } },  // GREEK SMALL LETTER TAU
+  { 0x03C5, 1, { 0x0079 } },  // GREEK SMALL LETTER UPSILON
+  { 0x03C6, 1, { 0x0066 } },  // GREEK SMALL LETTER PHI
+  { 0x03C7, 2, { 0x0063, 0x0068 } },  // GREEK SMALL LETTER CHI
+  { 0x03C8, 2, { 0x0070, 0x0073 } },  // GREEK SMALL LETTER PSI
+  { 0x03C9, 1, { 0x006F } },  // GREEK SMALL LETTER OMEGA
+  { 0x03CA, 1, { 0x03B9 } },  // GREEK SMALL LETTER IOTA WITH DIALYTIKA
+  { 0x03CB, 1, { 0x03C5 } },  // GREEK SMALL LETTER UPSILON WITH DIALYTIKA
+  { 0x03CC, 1, { 0x03BF } },  // GREEK SMALL LETTER OMICRON WITH TONOS
+  { 0x03CD, 1, { 0x03C5 } },  // GREEK SMALL LETTER UPSILON WITH TONOS
+  { 0x03CE, 1, { 0x03C9 } },  // GREEK SMALL LETTER OMEGA WITH TONOS
+  { 0x03D0, 1, { 0x03B2 } },  // GREEK BETA SYMBOL
+  { 0x03D1, 1, { 0x03B8 } },  // GREEK THETA SYMBOL
+  { 0x03D2, 1, { 0x03A5 } },  // GREEK UPSILON WITH HOOK SYMBOL
+  { 0x03D3, 1, { 0x03D2 } },  // GREEK UPSILON WITH ACUTE AND HOOK SYMBOL
+  { 0x03D4, 1, { 0x03D2 } },  // GREEK UPSILON WITH DIAERESIS AND HOOK SYMBOL
+  { 0x03D5, 1, { 0x03C6 } },  // GREEK PHI SYMBOL
+  { 0x03D6, 1, { 0x03C0 } },  // GREEK PI SYMBOL
+  { 0x03F0, 1, { 0x03BA } },  // GREEK KAPPA SYMBOL
+  { 0x03F1, 1, { 0x03C1 } },  // GREEK RHO SYMBOL
+  { 0x03F2, 1, { 0x03C2 } },  // GREEK LUNATE SIGMA SYMBOL
+  { 0x03F4, 1, { 0x0398 } },  // GREEK CAPITAL THETA SYMBOL
+  { 0x03F5, 1, { 0x03B5 } },  // GREEK LUNATE EPSILON SYMBOL
+  { 0x03F9, 1, { 0x03A3 } },  // GREEK CAPITAL LUNATE SIGMA SYMBOL
+  { 0x0400, 1, { 0x0415 } },  // CYRILLIC CAPITAL LETTER IE WITH GRAVE
+  { 0x0401, 2, { 0x0059, 0x006F } },  // CYRILLIC CAPITAL LETTER IO
+  { 0x0403, 1, { 0x0413 } },  // CYRILLIC CAPITAL LETTER GJE
+  { 0x0404, 2, { 0x0059, 0x0065 } },  // CYRILLIC CAPITAL LETTER UKRAINIAN IE
+  { 0x0406, 1, { 0x0049 } },  // CYRILLIC CAPITAL LETTER BYELORUSSIAN-UKRAINIAN I
+  { 0x0407, 2, { 0x0059, 0x0069 } },  // CYRILLIC CAPITAL LETTER YI
+  { 0x040C, 1, { 0x041A } },  // CYRILLIC CAPITAL LETTER KJE
+  { 0x040D, 1, { 0x0418 } },  // CYRILLIC CAPITAL LETTER I WITH GRAVE
+  { 0x040E, 1, { 0x0055 } },  // CYRILLIC CAPITAL LETTER SHORT U
+  { 0x0410, 1, { 0x0041 } },  // CYRILLIC CAPITAL LETTER A
+  { 0x0411, 1, { 0x0042 } },  // CYRILLIC CAPITAL LETTER BE
+  { 0x0412, 1, { 0x0056 } },  // CYRILLIC CAPITAL LETTER VE
+  { 0x0413, 1, { 0x0047 } },  // CYRILLIC CAPITAL LETTER GHE
+  { 0x0414, 1, { 0x0044 } },  // CYRILLIC CAPITAL LETTER DE
+  { 0x0415, 1, { 0x0045 } },  // CYRILLIC CAPITAL LETTER IE
+  { 0x0416, 2, { 0x005A, 0x0068 } },  // CYRILLIC CAPITAL LETTER ZHE
+  { 0x0417, 1, { 0x005A } },  // CYRILLIC CAPITAL LETTER ZE
+  { 0x0418, 1, { 0x0049 } },  // CYRILLIC CAPITAL LETTER I
+  { 0x0419, 1, { 0x0059 } },  // CYRILLIC CAPITAL LETTER SHORT I
+  { 0x041A, 1, { 0x004B } },  // CYRILLIC CAPITAL LETTER KA
+  { 0x041B, 1, { 0x004C } },  // CYRILLIC CAPITAL LETTER EL
+  { 0x041C, 1, { 0x004D } },  // CYRILLIC CAPITAL LETTER EM
+  { 0x041D, 1, { 0x004E } },  // CYRILLIC CAPITAL LETTER EN
+  { 0x041E, 1, { 0x004F } },  // CYRILLIC CAPITAL LETTER O
+  { 0x041F, 1, { 0x0050 } },  // CYRILLIC CAPITAL LETTER PE
+  { 0x0420, 1, { 0x0052 } },  // CYRILLIC CAPITAL LETTER ER
+  { 0x0421, 1, { 0x0053 } },  // CYRILLIC CAPITAL LETTER ES
+  { 0x0422, 1, { 0x0054 } },  // CYRILLIC CAPITAL LETTER TE
+  { 0x0423, 1, { 0x0055 } },  // CYRILLIC CAPITAL LETTER U
+  { 0x0424, 1, { 0x0046 } },  // CYRILLIC CAPITAL LETTER EF
+  { 0x0425, 2, { 0x004B, 0x0068 } },  // CYRILLIC CAPITAL LETTER HA
+  { 0x0426, 2, { 0x0054, 0x0073 } },  // CYRILLIC CAPITAL LETTER TSE
+  { 0x0427, 2, { 0x0043, 0x0068 } },  // CYRILLIC CAPITAL LETTER CHE
+  { 0x0428, 2, { 0x0053, 0x0068 } },  // CYRILLIC CAPITAL LETTER SHA
+  { 0x0429, 4, { 0x0053, 0x0068, 0x0063, 0x0068 } },  // CYRILLIC CAPITAL LETTER SHCHA
+  { 0x042A, 1, { 0x0027 } },  // CYRILLIC CAPITAL LETTER HARD SIGN
+  { 0x042B, 1, { 0x0059 } },  // CYRILLIC CAPITAL LETTER YERU
+  { 0x042C, 1, { 0x0027 } },  // CYRILLIC CAPITAL LETTER SOFT SIGN
+  { 0x042D, 1, { 0x0045 } },  // CYRILLIC CAPITAL LETTER E
+  { 0x042E, 2, { 0x0059, 0x0075 } },  // CYRILLIC CAPITAL LETTER YU
+  { 0x042F, 2, { 0x0059, 0x0061 } },  // CYRILLIC CAPITAL LETTER YA
+  { 0x0430, 1, { 0x0061 } },  // CYRILLIC SMALL LETTER A
+  { 0x0431, 1, { 0x0062 } },  // CYRILLIC SMALL LETTER BE
+  { 0x0432, 1, { 0x0076 } },  // CYRILLIC SMALL LETTER VE
+  { 0x0433, 1, { 0x0067 } },  // CYRILLIC SMALL LETTER GHE
+  { 0x0434, 1, { 0x0064 } },  // CYRILLIC SMALL LETTER DE
+  { 0x0435, 1, { 0x0065 } },  // CYRILLIC SMALL LETTER IE
+  { 0x0436, 2, { 0x007A, 0x0068 } },  // CYRILLIC SMALL LETTER ZHE
+  { 0x0437, 1, { 0x007A } },  // CYRILLIC SMALL LETTER ZE
+  { 0x0438, 1, { 0x0069 } },  // CYRILLIC SMALL LETTER I
+  { 0x0439, 1, { 0x0079 } },  // CYRILLIC SMALL LETTER SHORT I
+  { 0x043A, 1, { 0x006B } },  // CYRILLIC SMALL LETTER KA
+  { 0x043B, 1, { 0x006C } },  // CYRILLIC SMALL LETTER EL
+  { 0x043C, 1, { 0x006D } },  // CYRILLIC SMALL LETTER EM
+  { 0x043D, 1, { 0x006E } },  // CYRILLIC SMALL LETTER EN
+  { 0x043E, 1, { 0x006F } },  // CYRILLIC SMALL LETTER O
+  { 0x043F, 1, { 0x0070 } },  // CYRILLIC SMALL LETTER PE
+  { 0x0440, 1, { 0x0072 } },  // CYRILLIC SMALL LETTER ER
+  { 0x0441, 1, { 0x0073 } },  // CYRILLIC SMALL LETTER ES
+  { 0x0442, 1, { 0x0074 } },  // CYRILLIC SMALL LETTER TE
+  { 0x0443, 1, { 0x0075 } },  // CYRILLIC SMALL LETTER U
+  { 0x0444, 1, { 0x0066 } },  // CYRILLIC SMALL LETTER EF
+  { 0x0445, 2, { 0x006B, 0x0068 } },  // CYRILLIC SMALL LETTER HA
+  { 0x0446, 2, { 0x0074, 0x0073 } },  // CYRILLIC SMALL LETTER TSE
+  { 0x0447, 2, { 0x0063, 0x0068 } },  // CYRILLIC SMALL LETTER CHE
+  { 0x0448, 2, { 0x0073, 0x0068 } },  // CYRILLIC SMALL LETTER SHA
+  { 0x0449, 4, { 0x0073, 0x0068, 0x0063, 0x0068 } },  // CYRILLIC SMALL LETTER SHCHA
+  { 0x044A, 1, { 0x0027 } },  // CYRILLIC SMALL LETTER HARD SIGN
+  { 0x044B, 1, { 0x0079 } },  // CYRILLIC SMALL LETTER YERU
+  { 0x044C, 1, { 0x0027 } },  // CYRILLIC SMALL LETTER SOFT SIGN
+  { 0x044D, 1, { 0x0065 } },  // CYRILLIC SMALL LETTER E
+  { 0x044E, 2, { 0x0079, 0x0075 } },  // CYRILLIC SMALL LETTER YU
+  { 0x044F, 2, { 0x0079, 0x0061 } },  // CYRILLIC SMALL LETTER YA
+  { 0x0450, 1, { 0x0435 } },  // CYRILLIC SMALL LETTER IE WITH GRAVE
+  { 0x0451, 2, { 0x0079, 0x006F } },  // CYRILLIC SMALL LETTER IO
+  { 0x0453, 1, { 0x0433 } },  // CYRILLIC SMALL LETTER GJE
+  { 0x0454, 2, { 0x0079, 0x0065 } },  // CYRILLIC SMALL LETTER UKRAINIAN IE
+  { 0x0456, 1, { 0x0069 } },  // CYRILLIC SMALL LETTER BYELORUSSIAN-UKRAINIAN I
+  { 0x0457, 2, { 0x0079, 0x0069 } },  // CYRILLIC SMALL LETTER YI
+  { 0x045C, 1, { 0x043A } },  // CYRILLIC SMALL LETTER KJE
+  { 0x045D, 1, { 0x0438 } },  // CYRILLIC SMALL LETTER I WITH GRAVE
+  { 0x045E, 1, { 0x0075 } },  // CYRILLIC SMALL LETTER SHORT U
+  { 0x0476, 1, { 0x0474 } },  // CYRILLIC CAPITAL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT
+  { 0x0477, 1, { 0x0475 } },  // CYRILLIC SMALL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT
+  { 0x0490, 1, { 0x0047 } },  // CYRILLIC CAPITAL LETTER GHE WITH UPTURN
+  { 0x0491, 1, { 0x0067 } },  // CYRILLIC SMALL LETTER GHE WITH UPTURN
+  { 0x04C1, 1, { 0x0416 } },  // CYRILLIC CAPITAL LETTER ZHE WITH BREVE
+  { 0x04C2, 1, { 0x0436 } },  // CYRILLIC SMALL LETTER ZHE WITH BREVE
+  { 0x04D0, 1, { 0x0410 } },  // CYRILLIC CAPITAL LETTER A WITH BREVE
+  { 0x04D1, 1, { 0x0430 } },  // CYRILLIC SMALL LETTER A WITH BREVE
+  { 0x04D2, 1, { 0x0410 } },  // CYRILLIC CAPITAL LETTER A WITH DIAERESIS
+  { 0x04D3, 1, { 0x0430 } },  // CYRILLIC SMALL LETTER A WITH DIAERESIS
+  { 0x04D6, 1, { 0x0415 } },  // CYRILLIC CAPITAL LETTER IE WITH BREVE
+  { 0x04D7, 1, { 0x0435 } },  // CYRILLIC SMALL LETTER IE WITH BREVE
+  { 0x04DA, 1, { 0x04D8 } },  // CYRILLIC CAPITAL LETTER SCHWA WITH DIAERESIS
+  { 0x04DB, 1, { 0x04D9 } },  // CYRILLIC SMALL LETTER SCHWA WITH DIAERESIS
+  { 0x04DC, 1, { 0x0416 } },  // CYRILLIC CAPITAL LETTER ZHE WITH DIAERESIS
+  { 0x04DD, 1, { 0x0436 } },  // CYRILLIC SMALL LETTER ZHE WITH DIAERESIS
+  { 0x04DE, 1, { 0x0417 } },  // CYRILLIC CAPITAL LETTER ZE WITH DIAERESIS
+  { 0x04DF, 1, { 0x0437 } },  // CYRILLIC SMALL LETTER ZE WITH DIAERESIS
+  { 0x04E2, 1, { 0x0418 } },  // CYRILLIC CAPITAL LETTER I WITH MACRON
+  { 0x04E3, 1, { 0x0438 } },  // CYRILLIC SMALL LETTER I WITH MACRON
+  { 0x04E4, 1, { 0x0418 } },  // CYRILLIC CAPITAL LETTER I WITH DIAERESIS
+  { 0x04E5, 1, { 0x0438 } },  // CYRILLIC SMALL LETTER I WITH DIAERESIS
+  { 0x04E6, 1, { 0x041E } },  // CYRILLIC CAPITAL LETTER O WITH DIAERESIS
+  { 0x04E7, 1, { 0x043E } },  // CYRILLIC SMALL LETTER O WITH DIAERESIS
+  { 0x04EA, 1, { 0x04E8 } },  // CYRILLIC CAPITAL LETTER BARRED O WITH DIAERESIS
+  { 0x04EB, 1, { 0x04E9 } },  // CYRILLIC SMALL LETTER BARRED O WITH DIAERESIS
+  { 0x04EC, 1, { 0x042D } },  // CYRILLIC CAPITAL LETTER E WITH DIAERESIS
+  { 0x04ED, 1, { 0x044D } },  // CYRILLIC SMALL LETTER E WITH DIAERESIS
+  { 0x04EE, 1, { 0x0423 } },  // CYRILLIC CAPITAL LETTER U WITH MACRON
+  { 0x04EF, 1, { 0x0443 } },  // CYRILLIC SMALL LETTER U WITH MACRON
+  { 0x04F0, 1, { 0x0423 } },  // CYRILLIC CAPITAL LETTER U WITH DIAERESIS
+  { 0x04F1, 1, { 0x0443 } },  // CYRILLIC SMALL LETTER U WITH DIAERESIS
+  { 0x04F2, 1, { 0x0423 } },  // CYRILLIC CAPITAL LETTER U WITH DOUBLE ACUTE
+  { 0x04F3, 1, { 0x0443 } },  // CYRILLIC SMALL LETTER U WITH DOUBLE ACUTE
+  { 0x04F4, 1, { 0x0427 } },  // CYRILLIC CAPITAL LETTER CHE WITH DIAERESIS
+  { 0x04F5, 1, { 0x0447 } },  // CYRILLIC SMALL LETTER CHE WITH DIAERESIS
+  { 0x04F8, 1, { 0x042B } },  // CYRILLIC CAPITAL LETTER YERU WITH DIAERESIS
+  { 0x04F9, 1, { 0x044B } },  // CYRILLIC SMALL LETTER YERU WITH DIAERESIS
+  { 0x0587, 2, { 0x0565, 0x0582 } },  // ARMENIAN SMALL LIGATURE ECH YIWN
+  { 0x0622, 1, { 0x0627 } },  // ARABIC LETTER ALEF WITH MADDA ABOVE
+  { 0x0623, 1, { 0x0627 } },  // ARABIC LETTER ALEF WITH HAMZA ABOVE
+  { 0x0624, 1, { 0x0648 } },  // ARABIC LETTER WAW WITH HAMZA ABOVE
+  { 0x0625, 1, { 0x0627 } },  // ARABIC LETTER ALEF WITH HAMZA BELOW
+  { 0x0626, 1, { 0x064A } },  // ARABIC LETTER YEH WITH HAMZA ABOVE
+  { 0x0675, 2, { 0x0627, 0x0674 } },  // ARABIC LETTER HIGH HAMZA ALEF
+  { 0x0676, 2, { 0x0648, 0x0674 } },  // ARABIC LETTER HIGH HAMZA WAW
+  { 0x0677, 2, { 0x06C7, 0x0674 } },  // ARABIC LETTER U WITH HAMZA ABOVE
+  { 0x0678, 2, { 0x064A, 0x0674 } },  // ARABIC LETTER HIGH HAMZA YEH
+  { 0x06C0, 1, { 0x06D5 } },  // ARABIC LETTER HEH WITH YEH ABOVE
+  { 0x06C2, 1, { 0x06C1 } },  // ARABIC LETTER HEH GOAL WITH HAMZA ABOVE
+  { 0x06D3, 1, { 0x06D2 } },  // ARABIC LETTER YEH BARREE WITH HAMZA ABOVE
+  { 0x0929, 1, { 0x0928 } },  // DEVANAGARI LETTER NNNA
+  { 0x0931, 1, { 0x0930 } },  // DEVANAGARI LETTER RRA
+  { 0x0934, 1, { 0x0933 } },  // DEVANAGARI LETTER LLLA
+  { 0x0958, 1, { 0x0915 } },  // DEVANAGARI LETTER QA
+  { 0x0959, 1, { 0x0916 } },  // DEVANAGARI LETTER KHHA
+  { 0x095A, 1, { 0x0917 } },  // DEVANAGARI LETTER GHHA
+  { 0x095B, 1, { 0x091C } },  // DEVANAGARI LETTER ZA
+  { 0x095C, 1, { 0x0921 } },  // DEVANAGARI LETTER DDDHA
+  { 0x095D, 1, { 0x0922 } },  // DEVANAGARI LETTER RHA
+  { 0x095E, 1, { 0x092B } },  // DEVANAGARI LETTER FA
+  { 0x095F, 1, { 0x092F } },  // DEVANAGARI LETTER YYA
+  { 0x09DC, 1, { 0x09A1 } },  // BENGALI LETTER RRA
+  { 0x09DD, 1, { 0x09A2 } },  // BENGALI LETTER RHA
+  { 0x09DF, 1, { 0x09AF } },  // BENGALI LETTER YYA
+  { 0x0A33, 1, { 0x0A32 } },  // GURMUKHI LETTER LLA
+  { 0x0A36, 1, { 0x0A38 } },  // GURMUKHI LETTER SHA
+  { 0x0A59, 1, { 0x0A16 } },  // GURMUKHI LETTER KHHA
+  { 0x0A5A, 1, { 0x0A17 } },  // GURMUKHI LETTER GHHA
+  { 0x0A5B, 1, { 0x0A1C } },  // GURMUKHI LETTER ZA
+  { 0x0A5E, 1, { 0x0A2B } },  // GURMUKHI LETTER FA
+  { 0x0B5C, 1, { 0x0B21 } },  // ORIYA LETTER RRA
+  { 0x0B5D, 1, { 0x0B22 } },  // ORIYA LETTER RHA
+  { 0x0B94, 1, { 0x0B92 } },  // TAMIL LETTER AU
+  { 0x0E33, 1, { 0x0E32 } },  // THAI CHARACTER SARA AM
+  { 0x0EB3, 1, { 0x0EB2 } },  // LAO VOWEL SIGN AM
+  { 0x0EDC, 2, { 0x0EAB, 0x0E99 } },  // LAO HO NO
+  { 0x0EDD, 2, { 0x0EAB, 0x0EA1 } },  // LAO HO MO
+  { 0x0F0C, 1, { 0x0F0B } },  // TIBETAN MARK DELIMITER TSHEG BSTAR
+  { 0x0F43, 1, { 0x0F42 } },  // TIBETAN LETTER GHA
+  { 0x0F4D, 1, { 0x0F4C } },  // TIBETAN LETTER DDHA
+  { 0x0F52, 1, { 0x0F51 } },  // TIBETAN LETTER DHA
+  { 0x0F57, 1, { 0x0F56 } },  // TIBETAN LETTER BHA
+  { 0x0F5C, 1, { 0x0F5B } },  // TIBETAN LETTER DZHA
+  { 0x0F69, 1, { 0x0F40 } },  // TIBETAN LETTER KSSA
+  { 0x1026, 1, { 0x1025 } },  // MYANMAR LETTER UU
+  { 0x10FC, 1, { 0x10DC } },  // MODIFIER LETTER GEORGIAN NAR
+  { 0x1B06, 1, { 0x1B05 } },  // BALINESE LETTER AKARA TEDUNG
+  { 0x1B08, 1, { 0x1B07 } },  // BALINESE LETTER IKARA TEDUNG
+  { 0x1B0A, 1, { 0x1B09 } },  // BALINESE LETTER UKARA TEDUNG
+  { 0x1B0C, 1, { 0x1B0B } },  // BALINESE LETTER RA REPA TEDUNG
+  { 0x1B0E, 1, { 0x1B0D } },  // BALINESE LETTER LA LENGA TEDUNG
+  { 0x1B12, 1, { 0x1B11 } },  // BALINESE LETTER OKARA TEDUNG
+  { 0x1D2C, 1, { 0x0041 } },  // MODIFIER LETTER CAPITAL A
+  { 0x1D2D, 1, { 0x00C6 } },  // MODIFIER LETTER CAPITAL AE
+  { 0x1D2E, 1, { 0x0042 } },  // MODIFIER LETTER CAPITAL B
+  { 0x1D30, 1, { 0x0044 } },  // MODIFIER LETTER CAPITAL D
+  { 0x1D31, 1, { 0x0045 } },  // MODIFIER LETTER CAPITAL E
+  { 0x1D32, 1, { 0x018E } },  // MODIFIER LETTER CAPITAL REVERSED E
+  { 0x1D33, 1, { 0x0047 } },  // MODIFIER LETTER CAPITAL G
+  { 0x1D34, 1, { 0x0048 } },  // MODIFIER LETTER CAPITAL H
+  { 0x1D35, 1, { 0x0049 } },  // MODIFIER LETTER CAPITAL I
+  { 0x1D36, 1, { 0x004A } },  // MODIFIER LETTER CAPITAL J
+  { 0x1D37, 1, { 0x004B } },  // MODIFIER LETTER CAPITAL K
+  { 0x1D38, 1, { 0x004C } },  // MODIFIER LETTER CAPITAL L
+  { 0x1D39, 1, { 0x004D } },  // MODIFIER LETTER CAPITAL M
+  { 0x1D3A, 1, { 0x004E } },  // MODIFIER LETTER CAPITAL N
+  { 0x1D3C, 1, { 0x004F } },  // MODIFIER LETTER CAPITAL O
+  { 0x1D3D, 1, { 0x0222 } },  // MODIFIER LETTER CAPITAL OU
+  { 0x1D3E, 1, { 0x0050 } },  // MODIFIER LETTER CAPITAL P
+  { 0x1D3F, 1, { 0x0052 } },  // MODIFIER LETTER CAPITAL R
+  { 0x1D40, 1, { 0x0054 } },  // MODIFIER LETTER CAPITAL T
+  { 0x1D41, 1, { 0x0055 } },  // MODIFIER LETTER CAPITAL U
+  { 0x1D42, 1, { 0x0057 } },  // MODIFIER LETTER CAPITAL W
+  { 0x1D43, 1, { 0x0061 } },  // MODIFIER LETTER SMALL A
+  { 0x1D44, 1, { 0x0250 } },  // MODIFIER LETTER SMALL TURNED A
+  { 0x1D45, 1, { 0x0251 } },  // MODIFIER LETTER SMALL ALPHA
+  { 0x1D46, 1, { 0x1D02 } },  // MODIFIER LETTER SMALL TURNED AE
+  { 0x1D47, 1, { 0x0062 } },  // MODIFIER LETTER SMALL B
+  { 0x1D48, 1, { 0x0064 } },  // MODIFIER LETTER SMALL D
+  { 0x1D49, 1, { 0x0065 } },  // MODIFIER LETTER SMALL E
+  { 0x1D4A, 1, { 0x0259 } },  // MODIFIER LETTER SMALL SCHWA
+  { 0x1D4B, 1, { 0x025B } },  // MODIFIER LETTER SMALL OPEN E
+  { 0x1D4C, 1, { 0x025C } },  // MODIFIER LETTER SMALL TURNED OPEN E
+  { 0x1D4D, 1, { 0x0067 } },  // MODIFIER LETTER SMALL G
+  { 0x1D4F, 1, { 0x006B } },  // MODIFIER LETTER SMALL K
+  { 0x1D50, 1, { 0x006D } },  // MODIFIER LETTER SMALL M
+  { 0x1D51, 1, { 0x014B } },  // MODIFIER LETTER SMALL ENG
+  { 0x1D52, 1, { 0x006F } },  // MODIFIER LETTER SMALL O
+  { 0x1D53, 1, { 0x0254 } },  // MODIFIER LETTER SMALL OPEN O
+  { 0x1D54, 1, { 0x1D16 } },  // MODIFIER LETTER SMALL TOP HALF O
+  { 0x1D55, 1, { 0x1D17 } },  // MODIFIER LETTER SMALL BOTTOM HALF O
+  { 0x1D56, 1, { 0x0070 } },  // MODIFIER LETTER SMALL P
+  { 0x1D57, 1, { 0x0074 } },  // MODIFIER LETTER SMALL T
+  { 0x1D58, 1, { 0x0075 } },  // MODIFIER LETTER SMALL U
+  { 0x1D59, 1, { 0x1D1D } },  // MODIFIER LETTER SMALL SIDEWAYS U
+  { 0x1D5A, 1, { 0x026F } },  // MODIFIER LETTER SMALL TURNED M
+  { 0x1D5B, 1, { 0x0076 } },  // MODIFIER LETTER SMALL V
+  { 0x1D5C, 1, { 0x1D25 } },  // MODIFIER LETTER SMALL AIN
+  { 0x1D5D, 1, { 0x03B2 } },  // MODIFIER LETTER SMALL BETA
+  { 0x1D5E, 1, { 0x03B3 } },  // MODIFIER LETTER SMALL GREEK GAMMA
+  { 0x1D5F, 1, { 0x03B4 } },  // MODIFIER LETTER SMALL DELTA
+  { 0x1D60, 1, { 0x03C6 } },  // MODIFIER LETTER SMALL GREEK PHI
+  { 0x1D61, 1, { 0x03C7 } },  // MODIFIER LETTER SMALL CHI
+  { 0x1D62, 1, { 0x0069 } },  // LATIN SUBSCRIPT SMALL LETTER I
+  { 0x1D63, 1, { 0x0072 } },  // LATIN SUBSCRIPT SMALL LETTER R
+  { 0x1D64, 1, { 0x0075 } },  // LATIN SUBSCRIPT SMALL LETTER U
+  { 0x1D65, 1, { 0x0076 } },  // LATIN SUBSCRIPT SMALL LETTER V
+  { 0x1D66, 1, { 0x03B2 } },  // GREEK SUBSCRIPT SMALL LETTER BETA
+  { 0x1D67, 1, { 0x03B3 } },  // GREEK SUBSCRIPT SMALL LETTER GAMMA
+  { 0x1D68, 1, { 0x03C1 } },  // GREEK SUBSCRIPT SMALL LETTER RHO
+  { 0x1D69, 1, { 0x03C6 } },  // GREEK SUBSCRIPT SMALL LETTER PHI
+  { 0x1D6A, 1, { 0x03C7 } },  // GREEK SUBSCRIPT SMALL LETTER CHI
+  { 0x1D78, 1, { 0x043D } },  // MODIFIER LETTER CYRILLIC EN
+  { 0x1D9B, 1, { 0x0252 } },  // MODIFIER LETTER SMALL TURNED ALPHA
+  { 0x1D9C, 1, { 0x0063 } },  // MODIFIER LETTER SMALL C
+  { 0x1D9D, 1, { 0x0255 } },  // MODIFIER LETTER SMALL C WITH CURL
+  { 0x1D9E, 1, { 0x00F0 } },  // MODIFIER LETTER SMALL ETH
+  { 0x1D9F, 1, { 0x025C } },  // MODIFIER LETTER SMALL REVERSED OPEN E
+  { 0x1DA0, 1, { 0x0066 } },  // MODIFIER LETTER SMALL F
+  { 0x1DA1, 1, { 0x025F } },  // MODIFIER LETTER SMALL DOTLESS J WITH STROKE
+  { 0x1DA2, 1, { 0x0261 } },  // MODIFIER LETTER SMALL SCRIPT G
+  { 0x1DA3, 1, { 0x0265 } },  // MODIFIER LETTER SMALL TURNED H
+  { 0x1DA4, 1, { 0x0268 } },  // MODIFIER LETTER SMALL I WITH STROKE
+  { 0x1DA5, 1, { 0x0269 } },  // MODIFIER LETTER SMALL IOTA
+  { 0x1DA6, 1, { 0x026A } },  // MODIFIER LETTER SMALL CAPITAL I
+  { 0x1DA7, 1, { 0x1D7B } },  // MODIFIER LETTER SMALL CAPITAL I WITH STROKE
+  { 0x1DA8, 1, { 0x029D } },  // MODIFIER LETTER SMALL J WITH CROSSED-TAIL
+  { 0x1DA9, 1, { 0x026D } },  // MODIFIER LETTER SMALL L WITH RETROFLEX HOOK
+  { 0x1DAA, 1, { 0x1D85 } },  // MODIFIER LETTER SMALL L WITH PALATAL HOOK
+  { 0x1DAB, 1, { 0x029F } },  // MODIFIER LETTER SMALL CAPITAL L
+  { 0x1DAC, 1, { 0x0271 } },  // MODIFIER LETTER SMALL M WITH HOOK
+  { 0x1DAD, 1, { 0x0270 } },  // MODIFIER LETTER SMALL TURNED M WITH LONG LEG
+  { 0x1DAE, 1, { 0x0272 } },  // MODIFIER LETTER SMALL N WITH LEFT HOOK
+  { 0x1DAF, 1, { 0x0273 } },  // MODIFIER LETTER SMALL N WITH RETROFLEX HOOK
+  { 0x1DB0, 1, { 0x0274 } },  // MODIFIER LETTER SMALL CAPITAL N
+  { 0x1DB1, 1, { 0x0275 } },  // MODIFIER LETTER SMALL BARRED O
+  { 0x1DB2, 1, { 0x0278 } },  // MODIFIER LETTER SMALL PHI
+  { 0x1DB3, 1, { 0x0282 } },  // MODIFIER LETTER SMALL S WITH HOOK
+  { 0x1DB4, 1, { 0x0283 } },  // MODIFIER LETTER SMALL ESH
+  { 0x1DB5, 1, { 0x01AB } },  // MODIFIER LETTER SMALL T WITH PALATAL HOOK
+  { 0x1DB6, 1, { 0x0289 } },  // MODIFIER LETTER SMALL U BAR
+  { 0x1DB7, 1, { 0x028A } },  // MODIFIER LETTER SMALL UPSILON
+  { 0x1DB8, 1, { 0x1D1C } },  // MODIFIER LETTER SMALL CAPITAL U
+  { 0x1DB9, 1, { 0x028B } },  // MODIFIER LETTER SMALL V WITH HOOK
+  { 0x1DBA, 1, { 0x028C } },  // MODIFIER LETTER SMALL TURNED V
+  { 0x1DBB, 1, { 0x007A } },  // MODIFIER LETTER SMALL Z
+  { 0x1DBC, 1, { 0x0290 } },  // MODIFIER LETTER SMALL Z WITH RETROFLEX HOOK
+  { 0x1DBD, 1, { 0x0291 } },  // MODIFIER LETTER SMALL Z WITH CURL
+  { 0x1DBE, 1, { 0x0292 } },  // MODIFIER LETTER SMALL EZH
+  { 0x1DBF, 1, { 0x03B8 } },  // MODIFIER LETTER SMALL THETA
+  { 0x1E00, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH RING BELOW
+  { 0x1E01, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH RING BELOW
+  { 0x1E02, 1, { 0x0042 } },  // LATIN CAPITAL LETTER B WITH DOT ABOVE
+  { 0x1E03, 1, { 0x0062 } },  // LATIN SMALL LETTER B WITH DOT ABOVE
+  { 0x1E04, 1, { 0x0042 } },  // LATIN CAPITAL LETTER B WITH DOT BELOW
+  { 0x1E05, 1, { 0x0062 } },  // LATIN SMALL LETTER B WITH DOT BELOW
+  { 0x1E06, 1, { 0x0042 } },  // LATIN CAPITAL LETTER B WITH LINE BELOW
+  { 0x1E07, 1, { 0x0062 } },  // LATIN SMALL LETTER B WITH LINE BELOW
+  { 0x1E08, 1, { 0x00C7 } },  // LATIN CAPITAL LETTER C WITH CEDILLA AND ACUTE
+  { 0x1E09, 1, { 0x00E7 } },  // LATIN SMALL LETTER C WITH CEDILLA AND ACUTE
+  { 0x1E0A, 1, { 0x0044 } },  // LATIN CAPITAL LETTER D WITH DOT ABOVE
+  { 0x1E0B, 1, { 0x0064 } },  // LATIN SMALL LETTER D WITH DOT ABOVE
+  { 0x1E0C, 1, { 0x0044 } },  // LATIN CAPITAL LETTER D WITH DOT BELOW
+  { 0x1E0D, 1, { 0x0064 } },  // LATIN SMALL LETTER D WITH DOT BELOW
+  { 0x1E0E, 1, { 0x0044 } },  // LATIN CAPITAL LETTER D WITH LINE BELOW
+  { 0x1E0F, 1, { 0x0064 } },  // LATIN SMALL LETTER D WITH LINE BELOW
+  { 0x1E10, 1, { 0x0044 } },  // LATIN CAPITAL LETTER D WITH CEDILLA
+  { 0x1E11, 1, { 0x0064 } },  // LATIN SMALL LETTER D WITH CEDILLA
+  { 0x1E12, 1, { 0x0044 } },  // LATIN CAPITAL LETTER D WITH CIRCUMFLEX BELOW
+  { 0x1E13, 1, { 0x0064 } },  // LATIN SMALL LETTER D WITH CIRCUMFLEX BELOW
+  { 0x1E14, 1, { 0x0112 } },  // LATIN CAPITAL LETTER E WITH MACRON AND GRAVE
+  { 0x1E15, 1, { 0x0113 } },  // LATIN SMALL LETTER E WITH MACRON AND GRAVE
+  { 0x1E16, 1, { 0x0112 } },  // LATIN CAPITAL LETTER E WITH MACRON AND ACUTE
+  { 0x1E17, 1, { 0x0113 } },  // LATIN SMALL LETTER E WITH MACRON AND ACUTE
+  { 0x1E18, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX BELOW
+  { 0x1E19, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH CIRCUMFLEX BELOW
+  { 0x1E1A, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH TILDE BELOW
+  { 0x1E1B, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH TILDE BELOW
+  { 0x1E1C, 1, { 0x0228 } },  // LATIN CAPITAL LETTER E WITH CEDILLA AND BREVE
+  { 0x1E1D, 1, { 0x0229 } },  // LATIN SMALL LETTER E WITH CEDILLA AND BREVE
+  { 0x1E1E, 1, { 0x0046 } },  // LATIN CAPITAL LETTER F WITH DOT ABOVE
+  { 0x1E1F, 1, { 0x0066 } },  // LATIN SMALL LETTER F WITH DOT ABOVE
+  { 0x1E20, 1, { 0x0047 } },  // LATIN CAPITAL LETTER G WITH MACRON
+  { 0x1E21, 1, { 0x0067 } },  // LATIN SMALL LETTER G WITH MACRON
+  { 0x1E22, 1, { 0x0048 } },  // LATIN CAPITAL LETTER H WITH DOT ABOVE
+  { 0x1E23, 1, { 0x0068 } },  // LATIN SMALL LETTER H WITH DOT ABOVE
+  { 0x1E24, 1, { 0x0048 } },  // LATIN CAPITAL LETTER H WITH DOT BELOW
+  { 0x1E25, 1, { 0x0068 } },  // LATIN SMALL LETTER H WITH DOT BELOW
+  { 0x1E26, 1, { 0x0048 } },  // LATIN CAPITAL LETTER H WITH DIAERESIS
+  { 0x1E27, 1, { 0x0068 } },  // LATIN SMALL LETTER H WITH DIAERESIS
+  { 0x1E28, 1, { 0x0048 } },  // LATIN CAPITAL LETTER H WITH CEDILLA
+  { 0x1E29, 1, { 0x0068 } },  // LATIN SMALL LETTER H WITH CEDILLA
+  { 0x1E2A, 1, { 0x0048 } },  // LATIN CAPITAL LETTER H WITH BREVE BELOW
+  { 0x1E2B, 1, { 0x0068 } },  // LATIN SMALL LETTER H WITH BREVE BELOW
+  { 0x1E2C, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH TILDE BELOW
+  { 0x1E2D, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH TILDE BELOW
+  { 0x1E2E, 1, { 0x00CF } },  // LATIN CAPITAL LETTER I WITH DIAERESIS AND ACUTE
+  { 0x1E2F, 1, { 0x00EF } },  // LATIN SMALL LETTER I WITH DIAERESIS AND ACUTE
+  { 0x1E30, 1, { 0x004B } },  // LATIN CAPITAL LETTER K WITH ACUTE
+  { 0x1E31, 1, { 0x006B } },  // LATIN SMALL LETTER K WITH ACUTE
+  { 0x1E32, 1, { 0x004B } },  // LATIN CAPITAL LETTER K WITH DOT BELOW
+  { 0x1E33, 1, { 0x006B } },  // LATIN SMALL LETTER K WITH DOT BELOW
+  { 0x1E34, 1, { 0x004B } },  // LATIN CAPITAL LETTER K WITH LINE BELOW
+  { 0x1E35, 1, { 0x006B } },  // LATIN SMALL LETTER K WITH LINE BELOW
+  { 0x1E36, 1, { 0x004C } },  // LATIN CAPITAL LETTER L WITH DOT BELOW
+  { 0x1E37, 1, { 0x006C } },  // LATIN SMALL LETTER L WITH DOT BELOW
+  { 0x1E38, 1, { 0x1E36 } },  // LATIN CAPITAL LETTER L WITH DOT BELOW AND MACRON
+  { 0x1E39, 1, { 0x1E37 } },  // LATIN SMALL LETTER L WITH DOT BELOW AND MACRON
+  { 0x1E3A, 1, { 0x004C } },  // LATIN CAPITAL LETTER L WITH LINE BELOW
+  { 0x1E3B, 1, { 0x006C } },  // LATIN SMALL LETTER L WITH LINE BELOW
+  { 0x1E3C, 1, { 0x004C } },  // LATIN CAPITAL LETTER L WITH CIRCUMFLEX BELOW
+  { 0x1E3D, 1, { 0x006C } },  // LATIN SMALL LETTER L WITH CIRCUMFLEX BELOW
+  { 0x1E3E, 1, { 0x004D } },  // LATIN CAPITAL LETTER M WITH ACUTE
+  { 0x1E3F, 1, { 0x006D } },  // LATIN SMALL LETTER M WITH ACUTE
+  { 0x1E40, 1, { 0x004D } },  // LATIN CAPITAL LETTER M WITH DOT ABOVE
+  { 0x1E41, 1, { 0x006D } },  // LATIN SMALL LETTER M WITH DOT ABOVE
+  { 0x1E42, 1, { 0x004D } },  // LATIN CAPITAL LETTER M WITH DOT BELOW
+  { 0x1E43, 1, { 0x006D } },  // LATIN SMALL LETTER M WITH DOT BELOW
+  { 0x1E44, 1, { 0x004E } },  // LATIN CAPITAL LETTER N WITH DOT ABOVE
+  { 0x1E45, 1, { 0x006E } },  // LATIN SMALL LETTER N WITH DOT ABOVE
+  { 0x1E46, 1, { 0x004E } },  // LATIN CAPITAL LETTER N WITH DOT BELOW
+  { 0x1E47, 1, { 0x006E } },  // LATIN SMALL LETTER N WITH DOT BELOW
+  { 0x1E48, 1, { 0x004E } },  // LATIN CAPITAL LETTER N WITH LINE BELOW
+  { 0x1E49, 1, { 0x006E } },  // LATIN SMALL LETTER N WITH LINE BELOW
+  { 0x1E4A, 1, { 0x004E } },  // LATIN CAPITAL LETTER N WITH CIRCUMFLEX BELOW
+  { 0x1E4B, 1, { 0x006E } },  // LATIN SMALL LETTER N WITH CIRCUMFLEX BELOW
+  { 0x1E4C, 1, { 0x00D5 } },  // LATIN CAPITAL LETTER O WITH TILDE AND ACUTE
+  { 0x1E4D, 1, { 0x00F5 } },  // LATIN SMALL LETTER O WITH TILDE AND ACUTE
+  { 0x1E4E, 1, { 0x00D5 } },  // LATIN CAPITAL LETTER O WITH TILDE AND DIAERESIS
+  { 0x1E4F, 1, { 0x00F5 } },  // LATIN SMALL LETTER O WITH TILDE AND DIAERESIS
+  { 0x1E50, 1, { 0x014C } },  // LATIN CAPITAL LETTER O WITH MACRON AND GRAVE
+  { 0x1E51, 1, { 0x014D } },  // LATIN SMALL LETTER O WITH MACRON AND GRAVE
+  { 0x1E52, 1, { 0x014C } },  // LATIN CAPITAL LETTER O WITH MACRON AND ACUTE
+  { 0x1E53, 1, { 0x014D } },  // LATIN SMALL LETTER O WITH MACRON AND ACUTE
+  { 0x1E54, 1, { 0x0050 } },  // LATIN CAPITAL LETTER P WITH ACUTE
+  { 0x1E55, 1, { 0x0070 } },  // LATIN SMALL LETTER P WITH ACUTE
+  { 0x1E56, 1, { 0x0050 } },  // LATIN CAPITAL LETTER P WITH DOT ABOVE
+  { 0x1E57, 1, { 0x0070 } },  // LATIN SMALL LETTER P WITH DOT ABOVE
+  { 0x1E58, 1, { 0x0052 } },  // LATIN CAPITAL LETTER R WITH DOT ABOVE
+  { 0x1E59, 1, { 0x0072 } },  // LATIN SMALL LETTER R WITH DOT ABOVE
+  { 0x1E5A, 1, { 0x0052 } },  // LATIN CAPITAL LETTER R WITH DOT BELOW
+  { 0x1E5B, 1, { 0x0072 } },  // LATIN SMALL LETTER R WITH DOT BELOW
+  { 0x1E5C, 1, { 0x1E5A } },  // LATIN CAPITAL LETTER R WITH DOT BELOW AND MACRON
+  { 0x1E5D, 1, { 0x1E5B } },  // LATIN SMALL LETTER R WITH DOT BELOW AND MACRON
+  { 0x1E5E, 1, { 0x0052 } },  // LATIN CAPITAL LETTER R WITH LINE BELOW
+  { 0x1E5F, 1, { 0x0072 } },  // LATIN SMALL LETTER R WITH LINE BELOW
+  { 0x1E60, 1, { 0x0053 } },  // LATIN CAPITAL LETTER S WITH DOT ABOVE
+  { 0x1E61, 1, { 0x0073 } },  // LATIN SMALL LETTER S WITH DOT ABOVE
+  { 0x1E62, 1, { 0x0053 } },  // LATIN CAPITAL LETTER S WITH DOT BELOW
+  { 0x1E63, 1, { 0x0073 } },  // LATIN SMALL LETTER S WITH DOT BELOW
+  { 0x1E64, 1, { 0x015A } },  // LATIN CAPITAL LETTER S WITH ACUTE AND DOT ABOVE
+  { 0x1E65, 1, { 0x015B } },  // LATIN SMALL LETTER S WITH ACUTE AND DOT ABOVE
+  { 0x1E66, 1, { 0x0160 } },  // LATIN CAPITAL LETTER S WITH CARON AND DOT ABOVE
+  { 0x1E67, 1, { 0x0161 } },  // LATIN SMALL LETTER S WITH CARON AND DOT ABOVE
+  { 0x1E68, 1, { 0x1E62 } },  // LATIN CAPITAL LETTER S WITH DOT BELOW AND DOT ABOVE
+  { 0x1E69, 1, { 0x1E63 } },  // LATIN SMALL LETTER S WITH DOT BELOW AND DOT ABOVE
+  { 0x1E6A, 1, { 0x0054 } },  // LATIN CAPITAL LETTER T WITH DOT ABOVE
+  { 0x1E6B, 1, { 0x0074 } },  // LATIN SMALL LETTER T WITH DOT ABOVE
+  { 0x1E6C, 1, { 0x0054 } },  // LATIN CAPITAL LETTER T WITH DOT BELOW
+  { 0x1E6D, 1, { 0x0074 } },  // LATIN SMALL LETTER T WITH DOT BELOW
+  { 0x1E6E, 1, { 0x0054 } },  // LATIN CAPITAL LETTER T WITH LINE BELOW
+  { 0x1E6F, 1, { 0x0074 } },  // LATIN SMALL LETTER T WITH LINE BELOW
+  { 0x1E70, 1, { 0x0054 } },  // LATIN CAPITAL LETTER T WITH CIRCUMFLEX BELOW
+  { 0x1E71, 1, { 0x0074 } },  // LATIN SMALL LETTER T WITH CIRCUMFLEX BELOW
+  { 0x1E72, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH DIAERESIS BELOW
+  { 0x1E73, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH DIAERESIS BELOW
+  { 0x1E74, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH TILDE BELOW
+  { 0x1E75, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH TILDE BELOW
+  { 0x1E76, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH CIRCUMFLEX BELOW
+  { 0x1E77, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH CIRCUMFLEX BELOW
+  { 0x1E78, 1, { 0x0168 } },  // LATIN CAPITAL LETTER U WITH TILDE AND ACUTE
+  { 0x1E79, 1, { 0x0169 } },  // LATIN SMALL LETTER U WITH TILDE AND ACUTE
+  { 0x1E7A, 1, { 0x016A } },  // LATIN CAPITAL LETTER U WITH MACRON AND DIAERESIS
+  { 0x1E7B, 1, { 0x016B } },  // LATIN SMALL LETTER U WITH MACRON AND DIAERESIS
+  { 0x1E7C, 1, { 0x0056 } },  // LATIN CAPITAL LETTER V WITH TILDE
+  { 0x1E7D, 1, { 0x0076 } },  // LATIN SMALL LETTER V WITH TILDE
+  { 0x1E7E, 1, { 0x0056 } },  // LATIN CAPITAL LETTER V WITH DOT BELOW
+  { 0x1E7F, 1, { 0x0076 } },  // LATIN SMALL LETTER V WITH DOT BELOW
+  { 0x1E80, 1, { 0x0057 } },  // LATIN CAPITAL LETTER W WITH GRAVE
+  { 0x1E81, 1, { 0x0077 } },  // LATIN SMALL LETTER W WITH GRAVE
+  { 0x1E82, 1, { 0x0057 } },  // LATIN CAPITAL LETTER W WITH ACUTE
+  { 0x1E83, 1, { 0x0077 } },  // LATIN SMALL LETTER W WITH ACUTE
+  { 0x1E84, 1, { 0x0057 } },  // LATIN CAPITAL LETTER W WITH DIAERESIS
+  { 0x1E85, 1, { 0x0077 } },  // LATIN SMALL LETTER W WITH DIAERESIS
+  { 0x1E86, 1, { 0x0057 } },  // LATIN CAPITAL LETTER W WITH DOT ABOVE
+  { 0x1E87, 1, { 0x0077 } },  // LATIN SMALL LETTER W WITH DOT ABOVE
+  { 0x1E88, 1, { 0x0057 } },  // LATIN CAPITAL LETTER W WITH DOT BELOW
+  { 0x1E89, 1, { 0x0077 } },  // LATIN SMALL LETTER W WITH DOT BELOW
+  { 0x1E8A, 1, { 0x0058 } },  // LATIN CAPITAL LETTER X WITH DOT ABOVE
+  { 0x1E8B, 1, { 0x0078 } },  // LATIN SMALL LETTER X WITH DOT ABOVE
+  { 0x1E8C, 1, { 0x0058 } },  // LATIN CAPITAL LETTER X WITH DIAERESIS
+  { 0x1E8D, 1, { 0x0078 } },  // LATIN SMALL LETTER X WITH DIAERESIS
+  { 0x1E8E, 1, { 0x0059 } },  // LATIN CAPITAL LETTER Y WITH DOT ABOVE
+  { 0x1E8F, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH DOT ABOVE
+  { 0x1E90, 1, { 0x005A } },  // LATIN CAPITAL LETTER Z WITH CIRCUMFLEX
+  { 0x1E91, 1, { 0x007A } },  // LATIN SMALL LETTER Z WITH CIRCUMFLEX
+  { 0x1E92, 1, { 0x005A } },  // LATIN CAPITAL LETTER Z WITH DOT BELOW
+  { 0x1E93, 1, { 0x007A } },  // LATIN SMALL LETTER Z WITH DOT BELOW
+  { 0x1E94, 1, { 0x005A } },  // LATIN CAPITAL LETTER Z WITH LINE BELOW
+  { 0x1E95, 1, { 0x007A } },  // LATIN SMALL LETTER Z WITH LINE BELOW
+  { 0x1E96, 1, { 0x0068 } },  // LATIN SMALL LETTER H WITH LINE BELOW
+  { 0x1E97, 1, { 0x0074 } },  // LATIN SMALL LETTER T WITH DIAERESIS
+  { 0x1E98, 1, { 0x0077 } },  // LATIN SMALL LETTER W WITH RING ABOVE
+  { 0x1E99, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH RING ABOVE
+  { 0x1E9A, 2, { 0x0061, 0x02BE } },  // LATIN SMALL LETTER A WITH RIGHT HALF RING
+  { 0x1E9B, 1, { 0x017F } },  // LATIN SMALL LETTER LONG S WITH DOT ABOVE
+  { 0x1E9E, 2, { 0x0053, 0x0053 } },  // LATIN CAPITAL LETTER SHARP S
+  { 0x1EA0, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH DOT BELOW
+  { 0x1EA1, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH DOT BELOW
+  { 0x1EA2, 1, { 0x0041 } },  // LATIN CAPITAL LETTER A WITH HOOK ABOVE
+  { 0x1EA3, 1, { 0x0061 } },  // LATIN SMALL LETTER A WITH HOOK ABOVE
+  { 0x1EA4, 1, { 0x00C2 } },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND ACUTE
+  { 0x1EA5, 1, { 0x00E2 } },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND ACUTE
+  { 0x1EA6, 1, { 0x00C2 } },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND GRAVE
+  { 0x1EA7, 1, { 0x00E2 } },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND GRAVE
+  { 0x1EA8, 1, { 0x00C2 } },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x1EA9, 1, { 0x00E2 } },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x1EAA, 1, { 0x00C2 } },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND TILDE
+  { 0x1EAB, 1, { 0x00E2 } },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND TILDE
+  { 0x1EAC, 1, { 0x1EA0 } },  // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1EAD, 1, { 0x1EA1 } },  // LATIN SMALL LETTER A WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1EAE, 1, { 0x0102 } },  // LATIN CAPITAL LETTER A WITH BREVE AND ACUTE
+  { 0x1EAF, 1, { 0x0103 } },  // LATIN SMALL LETTER A WITH BREVE AND ACUTE
+  { 0x1EB0, 1, { 0x0102 } },  // LATIN CAPITAL LETTER A WITH BREVE AND GRAVE
+  { 0x1EB1, 1, { 0x0103 } },  // LATIN SMALL LETTER A WITH BREVE AND GRAVE
+  { 0x1EB2, 1, { 0x0102 } },  // LATIN CAPITAL LETTER A WITH BREVE AND HOOK ABOVE
+  { 0x1EB3, 1, { 0x0103 } },  // LATIN SMALL LETTER A WITH BREVE AND HOOK ABOVE
+  { 0x1EB4, 1, { 0x0102 } },  // LATIN CAPITAL LETTER A WITH BREVE AND TILDE
+  { 0x1EB5, 1, { 0x0103 } },  // LATIN SMALL LETTER A WITH BREVE AND TILDE
+  { 0x1EB6, 1, { 0x1EA0 } },  // LATIN CAPITAL LETTER A WITH BREVE AND DOT BELOW
+  { 0x1EB7, 1, { 0x1EA1 } },  // LATIN SMALL LETTER A WITH BREVE AND DOT BELOW
+  { 0x1EB8, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH DOT BELOW
+  { 0x1EB9, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH DOT BELOW
+  { 0x1EBA, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH HOOK ABOVE
+  { 0x1EBB, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH HOOK ABOVE
+  { 0x1EBC, 1, { 0x0045 } },  // LATIN CAPITAL LETTER E WITH TILDE
+  { 0x1EBD, 1, { 0x0065 } },  // LATIN SMALL LETTER E WITH TILDE
+  { 0x1EBE, 1, { 0x00CA } },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND ACUTE
+  { 0x1EBF, 1, { 0x00EA } },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND ACUTE
+  { 0x1EC0, 1, { 0x00CA } },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND GRAVE
+  { 0x1EC1, 1, { 0x00EA } },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND GRAVE
+  { 0x1EC2, 1, { 0x00CA } },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x1EC3, 1, { 0x00EA } },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x1EC4, 1, { 0x00CA } },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND TILDE
+  { 0x1EC5, 1, { 0x00EA } },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND TILDE
+  { 0x1EC6, 1, { 0x1EB8 } },  // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1EC7, 1, { 0x1EB9 } },  // LATIN SMALL LETTER E WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1EC8, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH HOOK ABOVE
+  { 0x1EC9, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH HOOK ABOVE
+  { 0x1ECA, 1, { 0x0049 } },  // LATIN CAPITAL LETTER I WITH DOT BELOW
+  { 0x1ECB, 1, { 0x0069 } },  // LATIN SMALL LETTER I WITH DOT BELOW
+  { 0x1ECC, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH DOT BELOW
+  { 0x1ECD, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH DOT BELOW
+  { 0x1ECE, 1, { 0x004F } },  // LATIN CAPITAL LETTER O WITH HOOK ABOVE
+  { 0x1ECF, 1, { 0x006F } },  // LATIN SMALL LETTER O WITH HOOK ABOVE
+  { 0x1ED0, 1, { 0x00D4 } },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND ACUTE
+  { 0x1ED1, 1, { 0x00F4 } },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND ACUTE
+  { 0x1ED2, 1, { 0x00D4 } },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND GRAVE
+  { 0x1ED3, 1, { 0x00F4 } },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND GRAVE
+  { 0x1ED4, 1, { 0x00D4 } },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x1ED5, 1, { 0x00F4 } },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE
+  { 0x1ED6, 1, { 0x00D4 } },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND TILDE
+  { 0x1ED7, 1, { 0x00F4 } },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND TILDE
+  { 0x1ED8, 1, { 0x1ECC } },  // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1ED9, 1, { 0x1ECD } },  // LATIN SMALL LETTER O WITH CIRCUMFLEX AND DOT BELOW
+  { 0x1EDA, 1, { 0x01A0 } },  // LATIN CAPITAL LETTER O WITH HORN AND ACUTE
+  { 0x1EDB, 1, { 0x01A1 } },  // LATIN SMALL LETTER O WITH HORN AND ACUTE
+  { 0x1EDC, 1, { 0x01A0 } },  // LATIN CAPITAL LETTER O WITH HORN AND GRAVE
+  { 0x1EDD, 1, { 0x01A1 } },  // LATIN SMALL LETTER O WITH HORN AND GRAVE
+  { 0x1EDE, 1, { 0x01A0 } },  // LATIN CAPITAL LETTER O WITH HORN AND HOOK ABOVE
+  { 0x1EDF, 1, { 0x01A1 } },  // LATIN SMALL LETTER O WITH HORN AND HOOK ABOVE
+  { 0x1EE0, 1, { 0x01A0 } },  // LATIN CAPITAL LETTER O WITH HORN AND TILDE
+  { 0x1EE1, 1, { 0x01A1 } },  // LATIN SMALL LETTER O WITH HORN AND TILDE
+  { 0x1EE2, 1, { 0x01A0 } },  // LATIN CAPITAL LETTER O WITH HORN AND DOT BELOW
+  { 0x1EE3, 1, { 0x01A1 } },  // LATIN SMALL LETTER O WITH HORN AND DOT BELOW
+  { 0x1EE4, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH DOT BELOW
+  { 0x1EE5, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH DOT BELOW
+  { 0x1EE6, 1, { 0x0055 } },  // LATIN CAPITAL LETTER U WITH HOOK ABOVE
+  { 0x1EE7, 1, { 0x0075 } },  // LATIN SMALL LETTER U WITH HOOK ABOVE
+  { 0x1EE8, 1, { 0x01AF } },  // LATIN CAPITAL LETTER U WITH HORN AND ACUTE
+  { 0x1EE9, 1, { 0x01B0 } },  // LATIN SMALL LETTER U WITH HORN AND ACUTE
+  { 0x1EEA, 1, { 0x01AF } },  // LATIN CAPITAL LETTER U WITH HORN AND GRAVE
+  { 0x1EEB, 1, { 0x01B0 } },  // LATIN SMALL LETTER U WITH HORN AND GRAVE
+  { 0x1EEC, 1, { 0x01AF } },  // LATIN CAPITAL LETTER U WITH HORN AND HOOK ABOVE
+  { 0x1EED, 1, { 0x01B0 } },  // LATIN SMALL LETTER U WITH HORN AND HOOK ABOVE
+  { 0x1EEE, 1, { 0x01AF } },  // LATIN CAPITAL LETTER U WITH HORN AND TILDE
+  { 0x1EEF, 1, { 0x01B0 } },  // LATIN SMALL LETTER U WITH HORN AND TILDE
+  { 0x1EF0, 1, { 0x01AF } },  // LATIN CAPITAL LETTER U WITH HORN AND DOT BELOW
+  { 0x1EF1, 1, { 0x01B0 } },  // LATIN SMALL LETTER U WITH HORN AND DOT BELOW
+  { 0x1EF2, 1, { 0x0059 } },  // LATIN CAPITAL LETTER Y WITH GRAVE
+  { 0x1EF3, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH GRAVE
+  { 0x1EF4, 1, { 0x0059 } },  // LATIN CAPITAL LETTER Y WITH DOT BELOW
+  { 0x1EF5, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH DOT BELOW
+  { 0x1EF6, 1, { 0x0059 } },  // LATIN CAPITAL LETTER Y WITH HOOK ABOVE
+  { 0x1EF7, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH HOOK ABOVE
+  { 0x1EF8, 1, { 0x0059 } },  // LATIN CAPITAL LETTER Y WITH TILDE
+  { 0x1EF9, 1, { 0x0079 } },  // LATIN SMALL LETTER Y WITH TILDE
+  { 0x1F00, 1, { 0x03B1 } },  // GREEK SMALL LETTER ALPHA WITH PSILI
+  { 0x1F01, 1, { 0x03B1 } },  // GREEK SMALL LETTER ALPHA WITH DASIA
+  { 0x1F02, 1, { 0x1F00 } },  // GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA
+  { 0x1F03, 1, { 0x1F01 } },  // GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA
+  { 0x1F04, 1, { 0x1F00 } },  // GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA
+  { 0x1F05, 1, { 0x1F01 } },  // GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA
+  { 0x1F06, 1, { 0x1F00 } },  // GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI
+  { 0x1F07, 1, { 0x1F01 } },  // GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI
+  { 0x1F08, 1, { 0x0391 } },  // GREEK CAPITAL LETTER ALPHA WITH PSILI
+  { 0x1F09, 1, { 0x0391 } },  // GREEK CAPITAL LETTER ALPHA WITH DASIA
+  { 0x1F0A, 1, { 0x1F08 } },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA
+  { 0x1F0B, 1, { 0x1F09 } },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA
+  { 0x1F0C, 1, { 0x1F08 } },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA
+  { 0x1F0D, 1, { 0x1F09 } },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA
+  { 0x1F0E, 1, { 0x1F08 } },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI
+  { 0x1F0F, 1, { 0x1F09 } },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI
+  { 0x1F10, 1, { 0x03B5 } },  // GREEK SMALL LETTER EPSILON WITH PSILI
+  { 0x1F11, 1, { 0x03B5 } },  // GREEK SMALL LETTER EPSILON WITH DASIA
+  { 0x1F12, 1, { 0x1F10 } },  // GREEK SMALL LETTER EPSILON WITH PSILI AND VARIA
+  { 0x1F13, 1, { 0x1F11 } },  // GREEK SMALL LETTER EPSILON WITH DASIA AND VARIA
+  { 0x1F14, 1, { 0x1F10 } },  // GREEK SMALL LETTER EPSILON WITH PSILI AND OXIA
+  { 0x1F15, 1, { 0x1F11 } },  // GREEK SMALL LETTER EPSILON WITH DASIA AND OXIA
+  { 0x1F18, 1, { 0x0395 } },  // GREEK CAPITAL LETTER EPSILON WITH PSILI
+  { 0x1F19, 1, { 0x0395 } },  // GREEK CAPITAL LETTER EPSILON WITH DASIA
+  { 0x1F1A, 1, { 0x1F18 } },  // GREEK CAPITAL LETTER EPSILON WITH PSILI AND VARIA
+  { 0x1F1B, 1, { 0x1F19 } },  // GREEK CAPITAL LETTER EPSILON WITH DASIA AND VARIA
+  { 0x1F1C, 1, { 0x1F18 } },  // GREEK CAPITAL LETTER EPSILON WITH PSILI AND OXIA
+  { 0x1F1D, 1, { 0x1F19 } },  // GREEK CAPITAL LETTER EPSILON WITH DASIA AND OXIA
+  { 0x1F20, 1, { 0x03B7 } },  // GREEK SMALL LETTER ETA WITH PSILI
+  { 0x1F21, 1, { 0x03B7 } },  // GREEK SMALL LETTER ETA WITH DASIA
+  { 0x1F22, 1, { 0x1F20 } },  // GREEK SMALL LETTER ETA WITH PSILI AND VARIA
+  { 0x1F23, 1, { 0x1F21 } },  // GREEK SMALL LETTER ETA WITH DASIA AND VARIA
+  { 0x1F24, 1, { 0x1F20 } },  // GREEK SMALL LETTER ETA WITH PSILI AND OXIA
+  { 0x1F25, 1, { 0x1F21 } },  // GREEK SMALL LETTER ETA WITH DASIA AND OXIA
+  { 0x1F26, 1, { 0x1F20 } },  // GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI
+  { 0x1F27, 1, { 0x1F21 } },  // GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI
+  { 0x1F28, 1, { 0x0397 } },  // GREEK CAPITAL LETTER ETA WITH PSILI
+  { 0x1F29, 1, { 0x0397 } },  // GREEK CAPITAL LETTER ETA WITH DASIA
+  { 0x1F2A, 1, { 0x1F28 } },  // GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA
+  { 0x1F2B, 1, { 0x1F29 } },  // GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA
+  { 0x1F2C, 1, { 0x1F28 } },  // GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA
+  { 0x1F2D, 1, { 0x1F29 } },  // GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA
+  { 0x1F2E, 1, { 0x1F28 } },  // GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI
+  { 0x1F2F, 1, { 0x1F29 } },  // GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI
+  { 0x1F30, 1, { 0x03B9 } },  // GREEK SMALL LETTER IOTA WITH PSILI
+  { 0x1F31, 1, { 0x03B9 } },  // GREEK SMALL LETTER IOTA WITH DASIA
+  { 0x1F32, 1, { 0x1F30 } },  // GREEK SMALL LETTER IOTA WITH PSILI AND VARIA
+  { 0x1F33, 1, { 0x1F31 } },  // GREEK SMALL LETTER IOTA WITH DASIA AND VARIA
+  { 0x1F34, 1, { 0x1F30 } },  // GREEK SMALL LETTER IOTA WITH PSILI AND OXIA
+  { 0x1F35, 1, { 0x1F31 } },  // GREEK SMALL LETTER IOTA WITH DASIA AND OXIA
+  { 0x1F36, 1, { 0x1F30 } },  // GREEK SMALL LETTER IOTA WITH PSILI AND PERISPOMENI
+  { 0x1F37, 1, { 0x1F31 } },  // GREEK SMALL LETTER IOTA WITH DASIA AND PERISPOMENI
+  { 0x1F38, 1, { 0x0399 } },  // GREEK CAPITAL LETTER IOTA WITH PSILI
+  { 0x1F39, 1, { 0x0399 } },  // GREEK CAPITAL LETTER IOTA WITH DASIA
+  { 0x1F3A, 1, { 0x1F38 } },  // GREEK CAPITAL LETTER IOTA WITH PSILI AND VARIA
+  { 0x1F3B, 1, { 0x1F39 } },  // GREEK CAPITAL LETTER IOTA WITH DASIA AND VARIA
+  { 0x1F3C, 1, { 0x1F38 } },  // GREEK CAPITAL LETTER IOTA WITH PSILI AND OXIA
+  { 0x1F3D, 1, { 0x1F39 } },  // GREEK CAPITAL LETTER IOTA WITH DASIA AND OXIA
+  { 0x1F3E, 1, { 0x1F38 } },  // GREEK CAPITAL LETTER IOTA WITH PSILI AND PERISPOMENI
+  { 0x1F3F, 1, { 0x1F39 } },  // GREEK CAPITAL LETTER IOTA WITH DASIA AND PERISPOMENI
+  { 0x1F40, 1, { 0x03BF } },  // GREEK SMALL LETTER OMICRON WITH PSILI
+  { 0x1F41, 1, { 0x03BF } },  // GREEK SMALL LETTER OMICRON WITH DASIA
+  { 0x1F42, 1, { 0x1F40 } },  // GREEK SMALL LETTER OMICRON WITH PSILI AND VARIA
+  { 0x1F43, 1, { 0x1F41 } },  // GREEK SMALL LETTER OMICRON WITH DASIA AND VARIA
+  { 0x1F44, 1, { 0x1F40 } },  // GREEK SMALL LETTER OMICRON WITH PSILI AND OXIA
+  { 0x1F45, 1, { 0x1F41 } },  // GREEK SMALL LETTER OMICRON WITH DASIA AND OXIA
+  { 0x1F48, 1, { 0x039F } },  // GREEK CAPITAL LETTER OMICRON WITH PSILI
+  { 0x1F49, 1, { 0x039F } },  // GREEK CAPITAL LETTER OMICRON WITH DASIA
+  { 0x1F4A, 1, { 0x1F48 } },  // GREEK CAPITAL LETTER OMICRON WITH PSILI AND VARIA
+  { 0x1F4B, 1, { 0x1F49 } },  // GREEK CAPITAL LETTER OMICRON WITH DASIA AND VARIA
+  { 0x1F4C, 1, { 0x1F48 } },  // GREEK CAPITAL LETTER OMICRON WITH PSILI AND OXIA
+  { 0x1F4D, 1, { 0x1F49 } },  // GREEK CAPITAL LETTER OMICRON WITH DASIA AND OXIA
+  { 0x1F50, 1, { 0x03C5 } },  // GREEK SMALL LETTER UPSILON WITH PSILI
+  { 0x1F51, 1, { 0x03C5 } },  // GREEK SMALL LETTER UPSILON WITH DASIA
+  { 0x1F52, 1, { 0x1F50 } },  // GREEK SMALL LETTER UPSILON WITH PSILI AND VARIA
+  { 0x1F53, 1, { 0x1F51 } },  // GREEK SMALL LETTER UPSILON WITH DASIA AND VARIA
+  { 0x1F54, 1, { 0x1F50 } },  // GREEK SMALL LETTER UPSILON WITH PSILI AND OXIA
+  { 0x1F55, 1, { 0x1F51 } },  // GREEK SMALL LETTER UPSILON WITH DASIA AND OXIA
+  { 0x1F56, 1, { 0x1F50 } },  // GREEK SMALL LETTER UPSILON WITH PSILI AND PERISPOMENI
+  { 0x1F57, 1, { 0x1F51 } },  // GREEK SMALL LETTER UPSILON WITH DASIA AND PERISPOMENI
+  { 0x1F59, 1, { 0x03A5 } },  // GREEK CAPITAL LETTER UPSILON WITH DASIA
+  { 0x1F5B, 1, { 0x1F59 } },  // GREEK CAPITAL LETTER UPSILON WITH DASIA AND VARIA
+  { 0x1F5D, 1, { 0x1F59 } },  // GREEK CAPITAL LETTER UPSILON WITH DASIA AND OXIA
+  { 0x1F5F, 1, { 0x1F59 } },  // GREEK CAPITAL LETTER UPSILON WITH DASIA AND PERISPOMENI
+  { 0x1F60, 1, { 0x03C9 } },  // GREEK SMALL LETTER OMEGA WITH PSILI
+  { 0x1F61, 1, { 0x03C9 } },  // GREEK SMALL LETTER OMEGA WITH DASIA
+  { 0x1F62, 1, { 0x1F60 } },  // GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA
+  { 0x1F63, 1, { 0x1F61 } },  // GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA
+  { 0x1F64, 1, { 0x1F60 } },  // GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA
+  { 0x1F65, 1, { 0x1F61 } },  // GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA
+  { 0x1F66, 1, { 0x1F60 } },  // GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI
+  { 0x1F67, 1, { 0x1F61 } },  // GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI
+  { 0x1F68, 1, { 0x03A9 } },  // GREEK CAPITAL LETTER OMEGA WITH PSILI
+  { 0x1F69, 1, { 0x03A9 } },  // GREEK CAPITAL LETTER OMEGA WITH DASIA
+  { 0x1F6A, 1, { 0x1F68 } },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA
+  { 0x1F6B, 1, { 0x1F69 } },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA
+  { 0x1F6C, 1, { 0x1F68 } },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA
+  { 0x1F6D, 1, { 0x1F69 } },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA
+  { 0x1F6E, 1, { 0x1F68 } },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI
+  { 0x1F6F, 1, { 0x1F69 } },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI
+  { 0x1F70, 1, { 0x03B1 } },  // GREEK SMALL LETTER ALPHA WITH VARIA
+  { 0x1F71, 1, { 0x03AC } },  // GREEK SMALL LETTER ALPHA WITH OXIA
+  { 0x1F72, 1, { 0x03B5 } },  // GREEK SMALL LETTER EPSILON WITH VARIA
+  { 0x1F73, 1, { 0x03AD } },  // GREEK SMALL LETTER EPSILON WITH OXIA
+  { 0x1F74, 1, { 0x03B7 } },  // GREEK SMALL LETTER ETA WITH VARIA
+  { 0x1F75, 1, { 0x03AE } },  // GREEK SMALL LETTER ETA WITH OXIA
+  { 0x1F76, 1, { 0x03B9 } },  // GREEK SMALL LETTER IOTA WITH VARIA
+  { 0x1F77, 1, { 0x03AF } },  // GREEK SMALL LETTER IOTA WITH OXIA
+  { 0x1F78, 1, { 0x03BF } },  // GREEK SMALL LETTER OMICRON WITH VARIA
+  { 0x1F79, 1, { 0x03CC } },  // GREEK SMALL LETTER OMICRON WITH OXIA
+  { 0x1F7A, 1, { 0x03C5 } },  // GREEK SMALL LETTER UPSILON WITH VARIA
+  { 0x1F7B, 1, { 0x03CD } },  // GREEK SMALL LETTER UPSILON WITH OXIA
+  { 0x1F7C, 1, { 0x03C9 } },  // GREEK SMALL LETTER OMEGA WITH VARIA
+  { 0x1F7D, 1, { 0x03CE } },  // GREEK SMALL LETTER OMEGA WITH OXIA
+  { 0x1F80, 1, { 0x1F00 } },  // GREEK SMALL LETTER ALPHA WITH PSILI AND YPOGEGRAMMENI
+  { 0x1F81, 1, { 0x1F01 } },  // GREEK SMALL LETTER ALPHA WITH DASIA AND YPOGEGRAMMENI
+  { 0x1F82, 1, { 0x1F02 } },  // GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+  { 0x1F83, 1, { 0x1F03 } },  // GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+  { 0x1F84, 1, { 0x1F04 } },  // GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+  { 0x1F85, 1, { 0x1F05 } },  // GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+  { 0x1F86, 1, { 0x1F06 } },  // GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F87, 1, { 0x1F07 } },  // GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F88, 1, { 0x1F08 } },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PROSGEGRAMMENI
+  { 0x1F89, 1, { 0x1F09 } },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PROSGEGRAMMENI
+  { 0x1F8A, 1, { 0x1F0A } },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+  { 0x1F8B, 1, { 0x1F0B } },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+  { 0x1F8C, 1, { 0x1F0C } },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+  { 0x1F8D, 1, { 0x1F0D } },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+  { 0x1F8E, 1, { 0x1F0E } },  // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1F8F, 1, { 0x1F0F } },  // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1F90, 1, { 0x1F20 } },  // GREEK SMALL LETTER ETA WITH PSILI AND YPOGEGRAMMENI
+  { 0x1F91, 1, { 0x1F21 } },  // GREEK SMALL LETTER ETA WITH DASIA AND YPOGEGRAMMENI
+  { 0x1F92, 1, { 0x1F22 } },  // GREEK SMALL LETTER ETA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+  { 0x1F93, 1, { 0x1F23 } },  // GREEK SMALL LETTER ETA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+  { 0x1F94, 1, { 0x1F24 } },  // GREEK SMALL LETTER ETA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+  { 0x1F95, 1, { 0x1F25 } },  // GREEK SMALL LETTER ETA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+  { 0x1F96, 1, { 0x1F26 } },  // GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F97, 1, { 0x1F27 } },  // GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1F98, 1, { 0x1F28 } },  // GREEK CAPITAL LETTER ETA WITH PSILI AND PROSGEGRAMMENI
+  { 0x1F99, 1, { 0x1F29 } },  // GREEK CAPITAL LETTER ETA WITH DASIA AND PROSGEGRAMMENI
+  { 0x1F9A, 1, { 0x1F2A } },  // GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+  { 0x1F9B, 1, { 0x1F2B } },  // GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+  { 0x1F9C, 1, { 0x1F2C } },  // GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+  { 0x1F9D, 1, { 0x1F2D } },  // GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+  { 0x1F9E, 1, { 0x1F2E } },  // GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1F9F, 1, { 0x1F2F } },  // GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1FA0, 1, { 0x1F60 } },  // GREEK SMALL LETTER OMEGA WITH PSILI AND YPOGEGRAMMENI
+  { 0x1FA1, 1, { 0x1F61 } },  // GREEK SMALL LETTER OMEGA WITH DASIA AND YPOGEGRAMMENI
+  { 0x1FA2, 1, { 0x1F62 } },  // GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+  { 0x1FA3, 1, { 0x1F63 } },  // GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+  { 0x1FA4, 1, { 0x1F64 } },  // GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+  { 0x1FA5, 1, { 0x1F65 } },  // GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+  { 0x1FA6, 1, { 0x1F66 } },  // GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1FA7, 1, { 0x1F67 } },  // GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1FA8, 1, { 0x1F68 } },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PROSGEGRAMMENI
+  { 0x1FA9, 1, { 0x1F69 } },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PROSGEGRAMMENI
+  { 0x1FAA, 1, { 0x1F6A } },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+  { 0x1FAB, 1, { 0x1F6B } },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+  { 0x1FAC, 1, { 0x1F6C } },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+  { 0x1FAD, 1, { 0x1F6D } },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+  { 0x1FAE, 1, { 0x1F6E } },  // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1FAF, 1, { 0x1F6F } },  // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+  { 0x1FB0, 1, { 0x03B1 } },  // GREEK SMALL LETTER ALPHA WITH VRACHY
+  { 0x1FB1, 1, { 0x03B1 } },  // GREEK SMALL LETTER ALPHA WITH MACRON
+  { 0x1FB2, 1, { 0x1F70 } },  // GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI
+  { 0x1FB3, 1, { 0x03B1 } },  // GREEK SMALL LETTER ALPHA WITH YPOGEGRAMMENI
+  { 0x1FB4, 1, { 0x03AC } },  // GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI
+  { 0x1FB6, 1, { 0x03B1 } },  // GREEK SMALL LETTER ALPHA WITH PERISPOMENI
+  { 0x1FB7, 1, { 0x1FB6 } },  // GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1FB8, 1, { 0x0391 } },  // GREEK CAPITAL LETTER ALPHA WITH VRACHY
+  { 0x1FB9, 1, { 0x0391 } },  // GREEK CAPITAL LETTER ALPHA WITH MACRON
+  { 0x1FBA, 1, { 0x0391 } },  // GREEK CAPITAL LETTER ALPHA WITH VARIA
+  { 0x1FBB, 1, { 0x0386 } },  // GREEK CAPITAL LETTER ALPHA WITH OXIA
+  { 0x1FBC, 1, { 0x0391 } },  // GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI
+  { 0x1FBD, 1, { 0x0020 } },  // GREEK KORONIS
+  { 0x1FBE, 1, { 0x03B9 } },  // GREEK PROSGEGRAMMENI
+  { 0x1FBF, 1, { 0x0020 } },  // GREEK PSILI
+  { 0x1FC0, 1, { 0x0020 } },  // GREEK PERISPOMENI
+  { 0x1FC1, 1, { 0x00A8 } },  // GREEK DIALYTIKA AND PERISPOMENI
+  { 0x1FC2, 1, { 0x1F74 } },  // GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI
+  { 0x1FC3, 1, { 0x03B7 } },  // GREEK SMALL LETTER ETA WITH YPOGEGRAMMENI
+  { 0x1FC4, 1, { 0x03AE } },  // GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI
+  { 0x1FC6, 1, { 0x03B7 } },  // GREEK SMALL LETTER ETA WITH PERISPOMENI
+  { 0x1FC7, 1, { 0x1FC6 } },  // GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1FC8, 1, { 0x0395 } },  // GREEK CAPITAL LETTER EPSILON WITH VARIA
+  { 0x1FC9, 1, { 0x0388 } },  // GREEK CAPITAL LETTER EPSILON WITH OXIA
+  { 0x1FCA, 1, { 0x0397 } },  // GREEK CAPITAL LETTER ETA WITH VARIA
+  { 0x1FCB, 1, { 0x0389 } },  // GREEK CAPITAL LETTER ETA WITH OXIA
+  { 0x1FCC, 1, { 0x0397 } },  // GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI
+  { 0x1FCD, 1, { 0x1FBF } },  // GREEK PSILI AND VARIA
+  { 0x1FCE, 1, { 0x1FBF } },  // GREEK PSILI AND OXIA
+  { 0x1FCF, 1, { 0x1FBF } },  // GREEK PSILI AND PERISPOMENI
+  { 0x1FD0, 1, { 0x03B9 } },  // GREEK SMALL LETTER IOTA WITH VRACHY
+  { 0x1FD1, 1, { 0x03B9 } },  // GREEK SMALL LETTER IOTA WITH MACRON
+  { 0x1FD2, 1, { 0x03CA } },  // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND VARIA
+  { 0x1FD3, 1, { 0x0390 } },  // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND OXIA
+  { 0x1FD6, 1, { 0x03B9 } },  // GREEK SMALL LETTER IOTA WITH PERISPOMENI
+  { 0x1FD7, 1, { 0x03CA } },  // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND PERISPOMENI
+  { 0x1FD8, 1, { 0x0399 } },  // GREEK CAPITAL LETTER IOTA WITH VRACHY
+  { 0x1FD9, 1, { 0x0399 } },  // GREEK CAPITAL LETTER IOTA WITH MACRON
+  { 0x1FDA, 1, { 0x0399 } },  // GREEK CAPITAL LETTER IOTA WITH VARIA
+  { 0x1FDB, 1, { 0x038A } },  // GREEK CAPITAL LETTER IOTA WITH OXIA
+  { 0x1FDD, 1, { 0x1FFE } },  // GREEK DASIA AND VARIA
+  { 0x1FDE, 1, { 0x1FFE } },  // GREEK DASIA AND OXIA
+  { 0x1FDF, 1, { 0x1FFE } },  // GREEK DASIA AND PERISPOMENI
+  { 0x1FE0, 1, { 0x03C5 } },  // GREEK SMALL LETTER UPSILON WITH VRACHY
+  { 0x1FE1, 1, { 0x03C5 } },  // GREEK SMALL LETTER UPSILON WITH MACRON
+  { 0x1FE2, 1, { 0x03CB } },  // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND VARIA
+  { 0x1FE3, 1, { 0x03B0 } },  // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND OXIA
+  { 0x1FE4, 1, { 0x03C1 } },  // GREEK SMALL LETTER RHO WITH PSILI
+  { 0x1FE5, 1, { 0x03C1 } },  // GREEK SMALL LETTER RHO WITH DASIA
+  { 0x1FE6, 1, { 0x03C5 } },  // GREEK SMALL LETTER UPSILON WITH PERISPOMENI
+  { 0x1FE7, 1, { 0x03CB } },  // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND PERISPOMENI
+  { 0x1FE8, 1, { 0x03A5 } },  // GREEK CAPITAL LETTER UPSILON WITH VRACHY
+  { 0x1FE9, 1, { 0x03A5 } },  // GREEK CAPITAL LETTER UPSILON WITH MACRON
+  { 0x1FEA, 1, { 0x03A5 } },  // GREEK CAPITAL LETTER UPSILON WITH VARIA
+  { 0x1FEB, 1, { 0x038E } },  // GREEK CAPITAL LETTER UPSILON WITH OXIA
+  { 0x1FEC, 1, { 0x03A1 } },  // GREEK CAPITAL LETTER RHO WITH DASIA
+  { 0x1FED, 1, { 0x00A8 } },  // GREEK DIALYTIKA AND VARIA
+  { 0x1FEE, 1, { 0x0385 } },  // GREEK DIALYTIKA AND OXIA
+  { 0x1FEF, 1, { 0x0060 } },  // GREEK VARIA
+  { 0x1FF2, 1, { 0x1F7C } },  // GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI
+  { 0x1FF3, 1, { 0x03C9 } },  // GREEK SMALL LETTER OMEGA WITH YPOGEGRAMMENI
+  { 0x1FF4, 1, { 0x03CE } },  // GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI
+  { 0x1FF6, 1, { 0x03C9 } },  // GREEK SMALL LETTER OMEGA WITH PERISPOMENI
+  { 0x1FF7, 1, { 0x1FF6 } },  // GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI
+  { 0x1FF8, 1, { 0x039F } },  // GREEK CAPITAL LETTER OMICRON WITH VARIA
+  { 0x1FF9, 1, { 0x038C } },  // GREEK CAPITAL LETTER OMICRON WITH OXIA
+  { 0x1FFA, 1, { 0x03A9 } },  // GREEK CAPITAL LETTER OMEGA WITH VARIA
+  { 0x1FFB, 1, { 0x038F } },  // GREEK CAPITAL LETTER OMEGA WITH OXIA
+  { 0x1FFC, 1, { 0x03A9 } },  // GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI
+  { 0x1FFD, 1, { 0x00B4 } },  // GREEK OXIA
+  { 0x1FFE, 1, { 0x0020 } },  // GREEK DASIA
+  { 0x2000, 1, { 0x2002 } },  // EN QUAD
+  { 0x2001, 1, { 0x2003 } },  // EM QUAD
+  { 0x2002, 1, { 0x0020 } },  // EN SPACE
+  { 0x2003, 1, { 0x0020 } },  // EM SPACE
+  { 0x2004, 1, { 0x0020 } },  // THREE-PER-EM SPACE
+  { 0x2005, 1, { 0x0020 } },  // FOUR-PER-EM SPACE
+  { 0x2006, 1, { 0x0020 } },  // SIX-PER-EM SPACE
+  { 0x2007, 1, { 0x0020 } },  // FIGURE SPACE
+  { 0x2008, 1, { 0x0020 } },  // PUNCTUATION SPACE
+  { 0x2009, 1, { 0x0020 } },  // THIN SPACE
+  { 0x200A, 1, { 0x0020 } },  // HAIR SPACE
+  { 0x200B, 0, { 0 } },  // ZERO WIDTH SPACE
+  { 0x2010, 1, { 0x002D } },  // HYPHEN
+  { 0x2011, 1, { 0x002D } },  // NON-BREAKING HYPHEN
+  { 0x2012, 1, { 0x002D } },  // FIGURE DASH
+  { 0x2013, 1, { 0x002D } },  // EN DASH
+  { 0x2014, 1, { 0x002D } },  // EM DASH
+  { 0x2015, 1, { 0x002D } },  // HORIZONTAL BAR
+  { 0x2017, 1, { 0x0020 } },  // DOUBLE LOW LINE
+  { 0x2018, 1, { 0x0027 } },  // LEFT SINGLE QUOTATION MARK
+  { 0x2019, 1, { 0x0027 } },  // RIGHT SINGLE QUOTATION MARK
+  { 0x201A, 1, { 0x0027 } },  // SINGLE LOW-9 QUOTATION MARK
+  { 0x201B, 1, { 0x0027 } },  // SINGLE HIGH-REVERSED-9 QUOTATION MARK
+  { 0x201C, 1, { 0x0022 } },  // LEFT DOUBLE QUOTATION MARK
+  { 0x201D, 1, { 0x0022 } },  // RIGHT DOUBLE QUOTATION MARK
+  { 0x201E, 1, { 0x0022 } },  // DOUBLE LOW-9 QUOTATION MARK
+  { 0x201F, 1, { 0x0022 } },  // DOUBLE HIGH-REVERSED-9 QUOTATION MARK
+  { 0x2022, 1, { 0x002A } },  // BULLET
+  { 0x2024, 1, { 0x002E } },  // ONE DOT LEADER
+  { 0x2025, 2, { 0x002E, 0x002E } },  // TWO DOT LEADER
+  { 0x2026, 3, { 0x002E, 0x002E, 0x002E } },  // HORIZONTAL ELLIPSIS
+  { 0x202F, 1, { 0x0020 } },  // NARROW NO-BREAK SPACE
+  { 0x2032, 1, { 0x0027 } },  // PRIME
+  { 0x2033, 1, { 0x0022 } },  // DOUBLE PRIME
+  { 0x2034, 3, { 0x2032, 0x2032, 0x2032 } },  // TRIPLE PRIME
+  { 0x2035, 1, { 0x0027 } },  // REVERSED PRIME
+  { 0x2036, 2, { 0x2035, 0x2035 } },  // REVERSED DOUBLE PRIME
+  { 0x2037, 3, { 0x2035, 0x2035, 0x2035 } },  // REVERSED TRIPLE PRIME
+  { 0x2039, 1, { 0x003C } },  // SINGLE LEFT-POINTING ANGLE QUOTATION MARK
+  { 0x203A, 1, { 0x003E } },  // SINGLE RIGHT-POINTING ANGLE QUOTATION MARK
+  { 0x203C, 2, { 0x0021, 0x0021 } },  // DOUBLE EXCLAMATION MARK
+  { 0x203E, 1, { 0x0020 } },  // OVERLINE
+  { 0x2047, 2, { 0x003F, 0x003F } },  // DOUBLE QUESTION MARK
+  { 0x2048, 2, { 0x003F, 0x0021 } },  // QUESTION EXCLAMATION MARK
+  { 0x2049, 2, { 0x0021, 0x003F } },  // EXCLAMATION QUESTION MARK
+  { 0x2057, 4, { 0x2032, 0x2032, 0x2032, 0x2032 } },  // QUADRUPLE PRIME
+  { 0x205F, 1, { 0x0020 } },  // MEDIUM MATHEMATICAL SPACE
+  { 0x2070, 1, { 0x0030 } },  // SUPERSCRIPT ZERO
+  { 0x2071, 1, { 0x0069 } },  // SUPERSCRIPT LATIN SMALL LETTER I
+  { 0x2074, 1, { 0x0034 } },  // SUPERSCRIPT FOUR
+  { 0x2075, 1, { 0x0035 } },  // SUPERSCRIPT FIVE
+  { 0x2076, 1, { 0x0036 } },  // SUPERSCRIPT SIX
+  { 0x2077, 1, { 0x0037 } },  // SUPERSCRIPT SEVEN
+  { 0x2078, 1, { 0x0038 } },  // SUPERSCRIPT EIGHT
+  { 0x2079, 1, { 0x0039 } },  // SUPERSCRIPT NINE
+  { 0x207A, 1, { 0x002B } },  // SUPERSCRIPT PLUS SIGN
+  { 0x207B, 1, { 0x2212 } },  // SUPERSCRIPT MINUS
+  { 0x207C, 1, { 0x003D } },  // SUPERSCRIPT EQUALS SIGN
+  { 0x207D, 1, { 0x0028 } },  // SUPERSCRIPT LEFT PARENTHESIS
+  { 0x207E, 1, { 0x0029 } },  // SUPERSCRIPT RIGHT PARENTHESIS
+  { 0x207F, 1, { 0x006E } },  // SUPERSCRIPT LATIN SMALL LETTER N
+  { 0x2080, 1, { 0x0030 } },  // SUBSCRIPT ZERO
+  { 0x2081, 1, { 0x0031 } },  // SUBSCRIPT ONE
+  { 0x2082, 1, { 0x0032 } },  // SUBSCRIPT TWO
+  { 0x2083, 1, { 0x0033 } },  // SUBSCRIPT THREE
+  { 0x2084, 1, { 0x0034 } },  // SUBSCRIPT FOUR
+  { 0x2085, 1, { 0x0035 } },  // SUBSCRIPT FIVE
+  { 0x2086, 1, { 0x0036 } },  // SUBSCRIPT SIX
+  { 0x2087, 1, { 0x0037 } },  // SUBSCRIPT SEVEN
+  { 0x2088, 1, { 0x0038 } },  // SUBSCRIPT EIGHT
+  { 0x2089, 1, { 0x0039 } },  // SUBSCRIPT NINE
+  { 0x208A, 1, { 0x002B } },  // SUBSCRIPT PLUS SIGN
+  { 0x208B, 1, { 0x2212 } },  // SUBSCRIPT MINUS
+  { 0x208C, 1, { 0x003D } },  // SUBSCRIPT EQUALS SIGN
+  { 0x208D, 1, { 0x0028 } },  // SUBSCRIPT LEFT PARENTHESIS
+  { 0x208E, 1, { 0x0029 } },  // SUBSCRIPT RIGHT PARENTHESIS
+  { 0x2090, 1, { 0x0061 } },  // LATIN SUBSCRIPT SMALL LETTER A
+  { 0x2091, 1, { 0x0065 } },  // LATIN SUBSCRIPT SMALL LETTER E
+  { 0x2092, 1, { 0x006F } },  // LATIN SUBSCRIPT SMALL LETTER O
+  { 0x2093, 1, { 0x0078 } },  // LATIN SUBSCRIPT SMALL LETTER X
+  { 0x2094, 1, { 0x0259 } },  // LATIN SUBSCRIPT SMALL LETTER SCHWA
+  { 0x2095, 1, { 0x0068 } },  // LATIN SUBSCRIPT SMALL LETTER H
+  { 0x2096, 1, { 0x006B } },  // LATIN SUBSCRIPT SMALL LETTER K
+  { 0x2097, 1, { 0x006C } },  // LATIN SUBSCRIPT SMALL LETTER L
+  { 0x2098, 1, { 0x006D } },  // LATIN SUBSCRIPT SMALL LETTER M
+  { 0x2099, 1, { 0x006E } },  // LATIN SUBSCRIPT SMALL LETTER N
+  { 0x209A, 1, { 0x0070 } },  // LATIN SUBSCRIPT SMALL LETTER P
+  { 0x209B, 1, { 0x0073 } },  // LATIN SUBSCRIPT SMALL LETTER S
+  { 0x209C, 1, { 0x0074 } },  // LATIN SUBSCRIPT SMALL LETTER T
+  { 0x20A8, 2, { 0x0052, 0x0073 } },  // RUPEE SIGN
+  { 0x2100, 3, { 0x0061, 0x002F, 0x0063 } },  // ACCOUNT OF
+  { 0x2101, 3, { 0x0061, 0x002F, 0x0073 } },  // ADDRESSED TO THE SUBJECT
+  { 0x2102, 1, { 0x0043 } },  // DOUBLE-STRUCK CAPITAL C
+  { 0x2103, 2, { 0x00B0, 0x0043 } },  // DEGREE CELSIUS
+  { 0x2105, 3, { 0x0063, 0x002F, 0x006F } },  // CARE OF
+  { 0x2106, 3, { 0x0063, 0x002F, 0x0075 } },  // CADA UNA
+  { 0x2107, 1, { 0x0190 } },  // EULER CONSTANT
+  { 0x2109, 2, { 0x00B0, 0x0046 } },  // DEGREE FAHRENHEIT
+  { 0x210A, 1, { 0x0067 } },  // SCRIPT SMALL G
+  { 0x210B, 1, { 0x0048 } },  // SCRIPT CAPITAL H
+  { 0x210C, 1, { 0x0048 } },  // BLACK-LETTER CAPITAL H
+  { 0x210D, 1, { 0x0048 } },  // DOUBLE-STRUCK CAPITAL H
+  { 0x210E, 1, { 0x0068 } },  // PLANCK CONSTANT
+  { 0x210F, 1, { 0x0127 } },  // PLANCK CONSTANT OVER TWO PI
+  { 0x2110, 1, { 0x0049 } },  // SCRIPT CAPITAL I
+  { 0x2111, 1, { 0x0049 } },  // BLACK-LETTER CAPITAL I
+  { 0x2112, 1, { 0x004C } },  // SCRIPT CAPITAL L
+  { 0x2113, 1, { 0x006C } },  // SCRIPT SMALL L
+  { 0x2115, 1, { 0x004E } },  // DOUBLE-STRUCK CAPITAL N
+  { 0x2116, 2, { 0x004E, 0x006F } },  // NUMERO SIGN
+  { 0x2119, 1, { 0x0050 } },  // DOUBLE-STRUCK CAPITAL P
+  { 0x211A, 1, { 0x0051 } },  // DOUBLE-STRUCK CAPITAL Q
+  { 0x211B, 1, { 0x0052 } },  // SCRIPT CAPITAL R
+  { 0x211C, 1, { 0x0052 } },  // BLACK-LETTER CAPITAL R
+  { 0x211D, 1, { 0x0052 } },  // DOUBLE-STRUCK CAPITAL R
+  { 0x2120, 2, { 0x0053, 0x004D } },  // SERVICE MARK
+  { 0x2121, 3, { 0x0054, 0x0045, 0x004C } },  // TELEPHONE SIGN
+  { 0x2122, 2, { 0x0054, 0x004D } },  // TRADE MARK SIGN
+  { 0x2124, 1, { 0x005A } },  // DOUBLE-STRUCK CAPITAL Z
+  { 0x2126, 1, { 0x03A9 } },  // OHM SIGN
+  { 0x2128, 1, { 0x005A } },  // BLACK-LETTER CAPITAL Z
+  { 0x212A, 1, { 0x004B } },  // KELVIN SIGN
+  { 0x212B, 1, { 0x00C5 } },  // ANGSTROM SIGN
+  { 0x212C, 1, { 0x0042 } },  // SCRIPT CAPITAL B
+  { 0x212D, 1, { 0x0043 } },  // BLACK-LETTER CAPITAL C
+  { 0x212F, 1, { 0x0065 } },  // SCRIPT SMALL E
+  { 0x2130, 1, { 0x0045 } },  // SCRIPT CAPITAL E
+  { 0x2131, 1, { 0x0046 } },  // SCRIPT CAPITAL F
+  { 0x2133, 1, { 0x004D } },  // SCRIPT CAPITAL M
+  { 0x2134, 1, { 0x006F } },  // SCRIPT SMALL O
+  { 0x2135, 1, { 0x05D0 } },  // ALEF SYMBOL
+  { 0x2136, 1, { 0x05D1 } },  // BET SYMBOL
+  { 0x2137, 1, { 0x05D2 } },  // GIMEL SYMBOL
+  { 0x2138, 1, { 0x05D3 } },  // DALET SYMBOL
+  { 0x2139, 1, { 0x0069 } },  // INFORMATION SOURCE
+  { 0x213B, 3, { 0x0046, 0x0041, 0x0058 } },  // FACSIMILE SIGN
+  { 0x213C, 1, { 0x03C0 } },  // DOUBLE-STRUCK SMALL PI
+  { 0x213D, 1, { 0x03B3 } },  // DOUBLE-STRUCK SMALL GAMMA
+  { 0x213E, 1, { 0x0393 } },  // DOUBLE-STRUCK CAPITAL GAMMA
+  { 0x213F, 1, { 0x03A0 } },  // DOUBLE-STRUCK CAPITAL PI
+  { 0x2140, 1, { 0x2211 } },  // DOUBLE-STRUCK N-ARY SUMMATION
+  { 0x2145, 1, { 0x0044 } },  // DOUBLE-STRUCK ITALIC CAPITAL D
+  { 0x2146, 1, { 0x0064 } },  // DOUBLE-STRUCK ITALIC SMALL D
+  { 0x2147, 1, { 0x0065 } },  // DOUBLE-STRUCK ITALIC SMALL E
+  { 0x2148, 1, { 0x0069 } },  // DOUBLE-STRUCK ITALIC SMALL I
+  { 0x2149, 1, { 0x006A } },  // DOUBLE-STRUCK ITALIC SMALL J
+  { 0x2150, 3, { 0x0031, 0x002F, 0x0037 } },  // VULGAR FRACTION ONE SEVENTH
+  { 0x2151, 3, { 0x0031, 0x002F, 0x0039 } },  // VULGAR FRACTION ONE NINTH
+  { 0x2152, 4, { 0x0031, 0x002F, 0x0031, 0x0030 } },  // VULGAR FRACTION ONE TENTH
+  { 0x2153, 3, { 0x0031, 0x002F, 0x0033 } },  // VULGAR FRACTION ONE THIRD
+  { 0x2154, 3, { 0x0032, 0x002F, 0x0033 } },  // VULGAR FRACTION TWO THIRDS
+  { 0x2155, 3, { 0x0031, 0x002F, 0x0035 } },  // VULGAR FRACTION ONE FIFTH
+  { 0x2156, 3, { 0x0032, 0x002F, 0x0035 } },  // VULGAR FRACTION TWO FIFTHS
+  { 0x2157, 3, { 0x0033, 0x002F, 0x0035 } },  // VULGAR FRACTION THREE FIFTHS
+  { 0x2158, 3, { 0x0034, 0x002F, 0x0035 } },  // VULGAR FRACTION FOUR FIFTHS
+  { 0x2159, 3, { 0x0031, 0x002F, 0x0036 } },  // VULGAR FRACTION ONE SIXTH
+  { 0x215A, 3, { 0x0035, 0x002F, 0x0036 } },  // VULGAR FRACTION FIVE SIXTHS
+  { 0x215B, 3, { 0x0031, 0x002F, 0x0038 } },  // VULGAR FRACTION ONE EIGHTH
+  { 0x215C, 3, { 0x0033, 0x002F, 0x0038 } },  // VULGAR FRACTION THREE EIGHTHS
+  { 0x215D, 3, { 0x0035, 0x002F, 0x0038 } },  // VULGAR FRACTION FIVE EIGHTHS
+  { 0x215E, 3, { 0x0037, 0x002F, 0x0038 } },  // VULGAR FRACTION SEVEN EIGHTHS
+  { 0x215F, 2, { 0x0031, 0x002F } },  // FRACTION NUMERATOR ONE
+  { 0x2160, 1, { 0x0049 } },  // ROMAN NUMERAL ONE
+  { 0x2161, 2, { 0x0049, 0x0049 } },  // ROMAN NUMERAL TWO
+  { 0x2162, 3, { 0x0049, 0x0049, 0x0049 } },  // ROMAN NUMERAL THREE
+  { 0x2163, 2, { 0x0049, 0x0056 } },  // ROMAN NUMERAL FOUR
+  { 0x2164, 1, { 0x0056 } },  // ROMAN NUMERAL FIVE
+  { 0x2165, 2, { 0x0056, 0x0049 } },  // ROMAN NUMERAL SIX
+  { 0x2166, 3, { 0x0056, 0x0049, 0x0049 } },  // ROMAN NUMERAL SEVEN
+  { 0x2167, 4, { 0x0056, 0x0049, 0x0049, 0x0049 } },  // ROMAN NUMERAL EIGHT
+  { 0x2168, 2, { 0x0049, 0x0058 } },  // ROMAN NUMERAL NINE
+  { 0x2169, 1, { 0x0058 } },  // ROMAN NUMERAL TEN
+  { 0x216A, 2, { 0x0058, 0x0049 } },  // ROMAN NUMERAL ELEVEN
+  { 0x216B, 3, { 0x0058, 0x0049, 0x0049 } },  // ROMAN NUMERAL TWELVE
+  { 0x216C, 1, { 0x004C } },  // ROMAN NUMERAL FIFTY
+  { 0x216D, 1, { 0x0043 } },  // ROMAN NUMERAL ONE HUNDRED
+  { 0x216E, 1, { 0x0044 } },  // ROMAN NUMERAL FIVE HUNDRED
+  { 0x216F, 1, { 0x004D } },  // ROMAN NUMERAL ONE THOUSAND
+  { 0x2170, 1, { 0x0069 } },  // SMALL ROMAN NUMERAL ONE
+  { 0x2171, 2, { 0x0069, 0x0069 } },  // SMALL ROMAN NUMERAL TWO
+  { 0x2172, 3, { 0x0069, 0x0069, 0x0069 } },  // SMALL ROMAN NUMERAL THREE
+  { 0x2173, 2, { 0x0069, 0x0076 } },  // SMALL ROMAN NUMERAL FOUR
+  { 0x2174, 1, { 0x0076 } },  // SMALL ROMAN NUMERAL FIVE
+  { 0x2175, 2, { 0x0076, 0x0069 } },  // SMALL ROMAN NUMERAL SIX
+  { 0x2176, 3, { 0x0076, 0x0069, 0x0069 } },  // SMALL ROMAN NUMERAL SEVEN
+  { 0x2177, 4, { 0x0076, 0x0069, 0x0069, 0x0069 } },  // SMALL ROMAN NUMERAL EIGHT
+  { 0x2178, 2, { 0x0069, 0x0078 } },  // SMALL ROMAN NUMERAL NINE
+  { 0x2179, 1, { 0x0078 } },  // SMALL ROMAN NUMERAL TEN
+  { 0x217A, 2, { 0x0078, 0x0069 } },  // SMALL ROMAN NUMERAL ELEVEN
+  { 0x217B, 3, { 0x0078, 0x0069, 0x0069 } },  // SMALL ROMAN NUMERAL TWELVE
+  { 0x217C, 1, { 0x006C } },  // SMALL ROMAN NUMERAL FIFTY
+  { 0x217D, 1, { 0x0063 } },  // SMALL ROMAN NUMERAL ONE HUNDRED
+  { 0x217E, 1, { 0x0064 } },  // SMALL ROMAN NUMERAL FIVE HUNDRED
+  { 0x217F, 1, { 0x006D } },  // SMALL ROMAN NUMERAL ONE THOUSAND
+  { 0x2189, 3, { 0x0030, 0x002F, 0x0033 } },  // VULGAR FRACTION ZERO THIRDS
+  { 0x2190, 2, { 0x003C, 0x002D } },  // LEFTWARDS ARROW
+  { 0x2192, 2, { 0x002D, 0x003E } },  // RIGHTWARDS ARROW
+  { 0x219A, 1, { 0x2190 } },  // LEFTWARDS ARROW WITH STROKE
+  { 0x219B, 1, { 0x2192 } },  // RIGHTWARDS ARROW WITH STROKE
+  { 0x21AE, 1, { 0x2194 } },  // LEFT RIGHT ARROW WITH STROKE
+  { 0x21CD, 1, { 0x21D0 } },  // LEFTWARDS DOUBLE ARROW WITH STROKE
+  { 0x21CE, 1, { 0x21D4 } },  // LEFT RIGHT DOUBLE ARROW WITH STROKE
+  { 0x21CF, 1, { 0x21D2 } },  // RIGHTWARDS DOUBLE ARROW WITH STROKE
+  { 0x21D0, 2, { 0x003C, 0x003D } },  // LEFTWARDS DOUBLE ARROW
+  { 0x21D2, 2, { 0x003D, 0x003E } },  // RIGHTWARDS DOUBLE ARROW
+  { 0x2204, 1, { 0x2203 } },  // THERE DOES NOT EXIST
+  { 0x2209, 1, { 0x2208 } },  // NOT AN ELEMENT OF
+  { 0x220C, 1, { 0x220B } },  // DOES NOT CONTAIN AS MEMBER
+  { 0x2212, 1, { 0x002D } },  // MINUS SIGN
+  { 0x2224, 1, { 0x2223 } },  // DOES NOT DIVIDE
+  { 0x2226, 1, { 0x2225 } },  // NOT PARALLEL TO
+  { 0x222C, 2, { 0x222B, 0x222B } },  // DOUBLE INTEGRAL
+  { 0x222D, 3, { 0x222B, 0x222B, 0x222B } },  // TRIPLE INTEGRAL
+  { 0x222F, 2, { 0x222E, 0x222E } },  // SURFACE INTEGRAL
+  { 0x2230, 3, { 0x222E, 0x222E, 0x222E } },  // VOLUME INTEGRAL
+  { 0x2241, 1, { 0x223C } },  // NOT TILDE
+  { 0x2244, 1, { 0x2243 } },  // NOT ASYMPTOTICALLY EQUAL TO
+  { 0x2247, 1, { 0x2245 } },  // NEITHER APPROXIMATELY NOR ACTUALLY EQUAL TO
+  { 0x2249, 1, { 0x2248 } },  // NOT ALMOST EQUAL TO
+  { 0x2260, 1, { 0x003D } },  // NOT EQUAL TO
+  { 0x2262, 1, { 0x2261 } },  // NOT IDENTICAL TO
+  { 0x226D, 1, { 0x224D } },  // NOT EQUIVALENT TO
+  { 0x226E, 1, { 0x003C } },  // NOT LESS-THAN
+  { 0x226F, 1, { 0x003E } },  // NOT GREATER-THAN
+  { 0x2270, 1, { 0x2264 } },  // NEITHER LESS-THAN NOR EQUAL TO
+  { 0x2271, 1, { 0x2265 } },  // NEITHER GREATER-THAN NOR EQUAL TO
+  { 0x2274, 1, { 0x2272 } },  // NEITHER LESS-THAN NOR EQUIVALENT TO
+  { 0x2275, 1, { 0x2273 } },  // NEITHER GREATER-THAN NOR EQUIVALENT TO
+  { 0x2278, 1, { 0x2276 } },  // NEITHER LESS-THAN NOR GREATER-THAN
+  { 0x2279, 1, { 0x2277 } },  // NEITHER GREATER-THAN NOR LESS-THAN
+  { 0x2280, 1, { 0x227A } },  // DOES NOT PRECEDE
+  { 0x2281, 1, { 0x227B } },  // DOES NOT SUCCEED
+  { 0x2284, 1, { 0x2282 } },  // NOT A SUBSET OF
+  { 0x2285, 1, { 0x2283 } },  // NOT A SUPERSET OF
+  { 0x2288, 1, { 0x2286 } },  // NEITHER A SUBSET OF NOR EQUAL TO
+  { 0x2289, 1, { 0x2287 } },  // NEITHER A SUPERSET OF NOR EQUAL TO
+  { 0x22AC, 1, { 0x22A2 } },  // DOES NOT PROVE
+  { 0x22AD, 1, { 0x22A8 } },  // NOT TRUE
+  { 0x22AE, 1, { 0x22A9 } },  // DOES NOT FORCE
+  { 0x22AF, 1, { 0x22AB } },  // NEGATED DOUBLE VERTICAL BAR DOUBLE RIGHT TURNSTILE
+  { 0x22E0, 1, { 0x227C } },  // DOES NOT PRECEDE OR EQUAL
+  { 0x22E1, 1, { 0x227D } },  // DOES NOT SUCCEED OR EQUAL
+  { 0x22E2, 1, { 0x2291 } },  // NOT SQUARE IMAGE OF OR EQUAL TO
+  { 0x22E3, 1, { 0x2292 } },  // NOT SQUARE ORIGINAL OF OR EQUAL TO
+  { 0x22EA, 1, { 0x22B2 } },  // NOT NORMAL SUBGROUP OF
+  { 0x22EB, 1, { 0x22B3 } },  // DOES NOT CONTAIN AS NORMAL SUBGROUP
+  { 0x22EC, 1, { 0x22B4 } },  // NOT NORMAL SUBGROUP OF OR EQUAL TO
+  { 0x22ED, 1, { 0x22B5 } },  // DOES NOT CONTAIN AS NORMAL SUBGROUP OR EQUAL
+  { 0x2474, 3, { 0x0028, 0x0031, 0x0029 } },  // PARENTHESIZED DIGIT ONE
+  { 0x2475, 3, { 0x0028, 0x0032, 0x0029 } },  // PARENTHESIZED DIGIT TWO
+  { 0x2476, 3, { 0x0028, 0x0033, 0x0029 } },  // PARENTHESIZED DIGIT THREE
+  { 0x2477, 3, { 0x0028, 0x0034, 0x0029 } },  // PARENTHESIZED DIGIT FOUR
+  { 0x2478, 3, { 0x0028, 0x0035, 0x0029 } },  // PARENTHESIZED DIGIT FIVE
+  { 0x2479, 3, { 0x0028, 0x0036, 0x0029 } },  // PARENTHESIZED DIGIT SIX
+  { 0x247A, 3, { 0x0028, 0x0037, 0x0029 } },  // PARENTHESIZED DIGIT SEVEN
+  { 0x247B, 3, { 0x0028, 0x0038, 0x0029 } },  // PARENTHESIZED DIGIT EIGHT
+  { 0x247C, 3, { 0x0028, 0x0039, 0x0029 } },  // PARENTHESIZED DIGIT NINE
+  { 0x247D, 4, { 0x0028, 0x0031, 0x0030, 0x0029 } },  // PARENTHESIZED NUMBER TEN
+  { 0x247E, 4, { 0x0028, 0x0031, 0x0031, 0x0029 } },  // PARENTHESIZED NUMBER ELEVEN
+  { 0x247F, 4, { 0x0028, 0x0031, 0x0032, 0x0029 } },  // PARENTHESIZED NUMBER TWELVE
+  { 0x2480, 4, { 0x0028, 0x0031, 0x0033, 0x0029 } },  // PARENTHESIZED NUMBER THIRTEEN
+  { 0x2481, 4, { 0x0028, 0x0031, 0x0034, 0x0029 } },  // PARENTHESIZED NUMBER FOURTEEN
+  { 0x2482, 4, { 0x0028, 0x0031, 0x0035, 0x0029 } },  // PARENTHESIZED NUMBER FIFTEEN
+  { 0x2483, 4, { 0x0028, 0x0031, 0x0036, 0x0029 } },  // PARENTHESIZED NUMBER SIXTEEN
+  { 0x2484, 4, { 0x0028, 0x0031, 0x0037, 0x0029 } },  // PARENTHESIZED NUMBER SEVENTEEN
+  { 0x2485, 4, { 0x0028, 0x0031, 0x0038, 0x0029 } },  // PARENTHESIZED NUMBER EIGHTEEN
+  { 0x2486, 4, { 0x0028, 0x0031, 0x0039, 0x0029 } },  // PARENTHESIZED NUMBER NINETEEN
+  { 0x2487, 4, { 0x0028, 0x0032, 0x0030, 0x0029 } },  // PARENTHESIZED NUMBER TWENTY
+  { 0x2488, 2, { 0x0031, 0x002E } },  // DIGIT ONE FULL STOP
+  { 0x2489, 2, { 0x0032, 0x002E } },  // DIGIT TWO FULL STOP
+  { 0x248A, 2, { 0x0033, 0x002E } },  // DIGIT THREE FULL STOP
+  { 0x248B, 2, { 0x0034, 0x002E } },  // DIGIT FOUR FULL STOP
+  { 0x248C, 2, { 0x0035, 0x002E } },  // DIGIT FIVE FULL STOP
+  { 0x248D, 2, { 0x0036, 0x002E } },  // DIGIT SIX FULL STOP
+  { 0x248E, 2, { 0x0037, 0x002E } },  // DIGIT SEVEN FULL STOP
+  { 0x248F, 2, { 0x0038, 0x002E } },  // DIGIT EIGHT FULL STOP
+  { 0x2490, 2, { 0x0039, 0x002E } },  // DIGIT NINE FULL STOP
+  { 0x2491, 3, { 0x0031, 0x0030, 0x002E } },  // NUMBER TEN FULL STOP
+  { 0x2492, 3, { 0x0031, 0x0031, 0x002E } },  // NUMBER ELEVEN FULL STOP
+  { 0x2493, 3, { 0x0031, 0x0032, 0x002E } },  // NUMBER TWELVE FULL STOP
+  { 0x2494, 3, { 0x0031, 0x0033, 0x002E } },  // NUMBER THIRTEEN FULL STOP
+  { 0x2495, 3, { 0x0031, 0x0034, 0x002E } },  // NUMBER FOURTEEN FULL STOP
+  { 0x2496, 3, { 0x0031, 0x0035, 0x002E } },  // NUMBER FIFTEEN FULL STOP
+  { 0x2497, 3, { 0x0031, 0x0036, 0x002E } },  // NUMBER SIXTEEN FULL STOP
+  { 0x2498, 3, { 0x0031, 0x0037, 0x002E } },  // NUMBER SEVENTEEN FULL STOP
+  { 0x2499, 3, { 0x0031, 0x0038, 0x002E } },  // NUMBER EIGHTEEN FULL STOP
+  { 0x249A, 3, { 0x0031, 0x0039, 0x002E } },  // NUMBER NINETEEN FULL STOP
+  { 0x249B, 3, { 0x0032, 0x0030, 0x002E } },  // NUMBER TWENTY FULL STOP
+  { 0x249C, 3, { 0x0028, 0x0061, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER A
+  { 0x249D, 3, { 0x0028, 0x0062, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER B
+  { 0x249E, 3, { 0x0028, 0x0063, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER C
+  { 0x249F, 3, { 0x0028, 0x0064, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER D
+  { 0x24A0, 3, { 0x0028, 0x0065, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER E
+  { 0x24A1, 3, { 0x0028, 0x0066, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER F
+  { 0x24A2, 3, { 0x0028, 0x0067, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER G
+  { 0x24A3, 3, { 0x0028, 0x0068, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER H
+  { 0x24A4, 3, { 0x0028, 0x0069, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER I
+  { 0x24A5, 3, { 0x0028, 0x006A, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER J
+  { 0x24A6, 3, { 0x0028, 0x006B, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER K
+  { 0x24A7, 3, { 0x0028, 0x006C, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER L
+  { 0x24A8, 3, { 0x0028, 0x006D, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER M
+  { 0x24A9, 3, { 0x0028, 0x006E, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER N
+  { 0x24AA, 3, { 0x0028, 0x006F, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER O
+  { 0x24AB, 3, { 0x0028, 0x0070, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER P
+  { 0x24AC, 3, { 0x0028, 0x0071, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER Q
+  { 0x24AD, 3, { 0x0028, 0x0072, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER R
+  { 0x24AE, 3, { 0x0028, 0x0073, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER S
+  { 0x24AF, 3, { 0x0028, 0x0074, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER T
+  { 0x24B0, 3, { 0x0028, 0x0075, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER U
+  { 0x24B1, 3, { 0x0028, 0x0076, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER V
+  { 0x24B2, 3, { 0x0028, 0x0077, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER W
+  { 0x24B3, 3, { 0x0028, 0x0078, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER X
+  { 0x24B4, 3, { 0x0028, 0x0079, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER Y
+  { 0x24B5, 3, { 0x0028, 0x007A, 0x0029 } },  // PARENTHESIZED LATIN SMALL LETTER Z
+  { 0x2669, 1, { 0x002A } },  // QUARTER NOTE
+  { 0x266A, 1, { 0x002A } },  // EIGHTH NOTE
+  { 0x266B, 1, { 0x002A } },  // BEAMED EIGHTH NOTES
+  { 0x2A0C, 4, { 0x222B, 0x222B, 0x222B, 0x222B } },  // QUADRUPLE INTEGRAL OPERATOR
+  { 0x2A74, 3, { 0x003A, 0x003A, 0x003D } },  // DOUBLE COLON EQUAL
+  { 0x2A75, 2, { 0x003D, 0x003D } },  // TWO CONSECUTIVE EQUALS SIGNS
+  { 0x2A76, 3, { 0x003D, 0x003D, 0x003D } },  // THREE CONSECUTIVE EQUALS SIGNS
+  { 0x2ADC, 1, { 0x2ADD } },  // FORKING
+  { 0x2C7C, 1, { 0x006A } },  // LATIN SUBSCRIPT SMALL LETTER J
+  { 0x2C7D, 1, { 0x0056 } },  // MODIFIER LETTER CAPITAL V
+  { 0x2D6F, 1, { 0x2D61 } },  // TIFINAGH MODIFIER LETTER LABIALIZATION MARK
+  { 0xFB00, 2, { 0x0066, 0x0066 } },  // LATIN SMALL LIGATURE FF
+  { 0xFB01, 2, { 0x0066, 0x0069 } },  // LATIN SMALL LIGATURE FI
+  { 0xFB02, 2, { 0x0066, 0x006C } },  // LATIN SMALL LIGATURE FL
+  { 0xFB03, 3, { 0x0066, 0x0066, 0x0069 } },  // LATIN SMALL LIGATURE FFI
+  { 0xFB04, 3, { 0x0066, 0x0066, 0x006C } },  // LATIN SMALL LIGATURE FFL
+  { 0xFB05, 2, { 0x017F, 0x0074 } },  // LATIN SMALL LIGATURE LONG S T
+  { 0xFB06, 2, { 0x0073, 0x0074 } },  // LATIN SMALL LIGATURE ST
+  { 0xFB13, 2, { 0x0574, 0x0576 } },  // ARMENIAN SMALL LIGATURE MEN NOW
+  { 0xFB14, 2, { 0x0574, 0x0565 } },  // ARMENIAN SMALL LIGATURE MEN ECH
+  { 0xFB15, 2, { 0x0574, 0x056B } },  // ARMENIAN SMALL LIGATURE MEN INI
+  { 0xFB16, 2, { 0x057E, 0x0576 } },  // ARMENIAN SMALL LIGATURE VEW NOW
+  { 0xFB17, 2, { 0x0574, 0x056D } },  // ARMENIAN SMALL LIGATURE MEN XEH
+  { 0xFB1D, 1, { 0x05D9 } },  // HEBREW LETTER YOD WITH HIRIQ
+  { 0xFB1F, 1, { 0x05F2 } },  // HEBREW LIGATURE YIDDISH YOD YOD PATAH
+  { 0xFB20, 1, { 0x05E2 } },  // HEBREW LETTER ALTERNATIVE AYIN
+  { 0xFB21, 1, { 0x05D0 } },  // HEBREW LETTER WIDE ALEF
+  { 0xFB22, 1, { 0x05D3 } },  // HEBREW LETTER WIDE DALET
+  { 0xFB23, 1, { 0x05D4 } },  // HEBREW LETTER WIDE HE
+  { 0xFB24, 1, { 0x05DB } },  // HEBREW LETTER WIDE KAF
+  { 0xFB25, 1, { 0x05DC } },  // HEBREW LETTER WIDE LAMED
+  { 0xFB26, 1, { 0x05DD } },  // HEBREW LETTER WIDE FINAL MEM
+  { 0xFB27, 1, { 0x05E8 } },  // HEBREW LETTER WIDE RESH
+  { 0xFB28, 1, { 0x05EA } },  // HEBREW LETTER WIDE TAV
+  { 0xFB29, 1, { 0x002B } },  // HEBREW LETTER ALTERNATIVE PLUS SIGN
+  { 0xFB2A, 1, { 0x05E9 } },  // HEBREW LETTER SHIN WITH SHIN DOT
+  { 0xFB2B, 1, { 0x05E9 } },  // HEBREW LETTER SHIN WITH SIN DOT
+  { 0xFB2C, 1, { 0xFB49 } },  // HEBREW LETTER SHIN WITH DAGESH AND SHIN DOT
+  { 0xFB2D, 1, { 0xFB49 } },  // HEBREW LETTER SHIN WITH DAGESH AND SIN DOT
+  { 0xFB2E, 1, { 0x05D0 } },  // HEBREW LETTER ALEF WITH PATAH
+  { 0xFB2F, 1, { 0x05D0 } },  // HEBREW LETTER ALEF WITH QAMATS
+  { 0xFB30, 1, { 0x05D0 } },  // HEBREW LETTER ALEF WITH MAPIQ
+  { 0xFB31, 1, { 0x05D1 } },  // HEBREW LETTER BET WITH DAGESH
+  { 0xFB32, 1, { 0x05D2 } },  // HEBREW LETTER GIMEL WITH DAGESH
+  { 0xFB33, 1, { 0x05D3 } },  // HEBREW LETTER DALET WITH DAGESH
+  { 0xFB34, 1, { 0x05D4 } },  // HEBREW LETTER HE WITH MAPIQ
+  { 0xFB35, 1, { 0x05D5 } },  // HEBREW LETTER VAV WITH DAGESH
+  { 0xFB36, 1, { 0x05D6 } },  // HEBREW LETTER ZAYIN WITH DAGESH
+  { 0xFB38, 1, { 0x05D8 } },  // HEBREW LETTER TET WITH DAGESH
+  { 0xFB39, 1, { 0x05D9 } },  // HEBREW LETTER YOD WITH DAGESH
+  { 0xFB3A, 1, { 0x05DA } },  // HEBREW LETTER FINAL KAF WITH DAGESH
+  { 0xFB3B, 1, { 0x05DB } },  // HEBREW LETTER KAF WITH DAGESH
+  { 0xFB3C, 1, { 0x05DC } },  // HEBREW LETTER LAMED WITH DAGESH
+  { 0xFB3E, 1, { 0x05DE } },  // HEBREW LETTER MEM WITH DAGESH
+  { 0xFB40, 1, { 0x05E0 } },  // HEBREW LETTER NUN WITH DAGESH
+  { 0xFB41, 1, { 0x05E1 } },  // HEBREW LETTER SAMEKH WITH DAGESH
+  { 0xFB43, 1, { 0x05E3 } },  // HEBREW LETTER FINAL PE WITH DAGESH
+  { 0xFB44, 1, { 0x05E4 } },  // HEBREW LETTER PE WITH DAGESH
+  { 0xFB46, 1, { 0x05E6 } },  // HEBREW LETTER TSADI WITH DAGESH
+  { 0xFB47, 1, { 0x05E7 } },  // HEBREW LETTER QOF WITH DAGESH
+  { 0xFB48, 1, { 0x05E8 } },  // HEBREW LETTER RESH WITH DAGESH
+  { 0xFB49, 1, { 0x05E9 } },  // HEBREW LETTER SHIN WITH DAGESH
+  { 0xFB4A, 1, { 0x05EA } },  // HEBREW LETTER TAV WITH DAGESH
+  { 0xFB4B, 1, { 0x05D5 } },  // HEBREW LETTER VAV WITH HOLAM
+  { 0xFB4C, 1, { 0x05D1 } },  // HEBREW LETTER BET WITH RAFE
+  { 0xFB4D, 1, { 0x05DB } },  // HEBREW LETTER KAF WITH RAFE
+  { 0xFB4E, 1, { 0x05E4 } },  // HEBREW LETTER PE WITH RAFE
+  { 0xFB4F, 2, { 0x05D0, 0x05DC } },  // HEBREW LIGATURE ALEF LAMED
+  { 0xFF01, 1, { 0x0021 } },  // FULLWIDTH EXCLAMATION MARK
+  { 0xFF02, 1, { 0x0022 } },  // FULLWIDTH QUOTATION MARK
+  { 0xFF03, 1, { 0x0023 } },  // FULLWIDTH NUMBER SIGN
+  { 0xFF04, 1, { 0x0024 } },  // FULLWIDTH DOLLAR SIGN
+  { 0xFF05, 1, { 0x0025 } },  // FULLWIDTH PERCENT SIGN
+  { 0xFF06, 1, { 0x0026 } },  // FULLWIDTH AMPERSAND
+  { 0xFF07, 1, { 0x0027 } },  // FULLWIDTH APOSTROPHE
+  { 0xFF08, 1, { 0x0028 } },  // FULLWIDTH LEFT PARENTHESIS
+  { 0xFF09, 1, { 0x0029 } },  // FULLWIDTH RIGHT PARENTHESIS
+  { 0xFF0A, 1, { 0x002A } },  // FULLWIDTH ASTERISK
+  { 0xFF0B, 1, { 0x002B } },  // FULLWIDTH PLUS SIGN
+  { 0xFF0C, 1, { 0x002C } },  // FULLWIDTH COMMA
+  { 0xFF0D, 1, { 0x002D } },  // FULLWIDTH HYPHEN-MINUS
+  { 0xFF0E, 1, { 0x002E } },  // FULLWIDTH FULL STOP
+  { 0xFF0F, 1, { 0x002F } },  // FULLWIDTH SOLIDUS
+  { 0xFF10, 1, { 0x0030 } },  // FULLWIDTH DIGIT ZERO
+  { 0xFF11, 1, { 0x0031 } },  // FULLWIDTH DIGIT ONE
+  { 0xFF12, 1, { 0x0032 } },  // FULLWIDTH DIGIT TWO
+  { 0xFF13, 1, { 0x0033 } },  // FULLWIDTH DIGIT THREE
+  { 0xFF14, 1, { 0x0034 } },  // FULLWIDTH DIGIT FOUR
+  { 0xFF15, 1, { 0x0035 } },  // FULLWIDTH DIGIT FIVE
+  { 0xFF16, 1, { 0x0036 } },  // FULLWIDTH DIGIT SIX
+  { 0xFF17, 1, { 0x0037 } },  // FULLWIDTH DIGIT SEVEN
+  { 0xFF18, 1, { 0x0038 } },  // FULLWIDTH DIGIT EIGHT
+  { 0xFF19, 1, { 0x0039 } },  // FULLWIDTH DIGIT NINE
+  { 0xFF1A, 1, { 0x003A } },  // FULLWIDTH COLON
+  { 0xFF1B, 1, { 0x003B } },  // FULLWIDTH SEMICOLON
+  { 0xFF1C, 1, { 0x003C } },  // FULLWIDTH LESS-THAN SIGN
+  { 0xFF1D, 1, { 0x003D } },  // FULLWIDTH EQUALS SIGN
+  { 0xFF1E, 1, { 0x003E } },  // FULLWIDTH GREATER-THAN SIGN
+  { 0xFF1F, 1, { 0x003F } },  // FULLWIDTH QUESTION MARK
+  { 0xFF20, 1, { 0x0040 } },  // FULLWIDTH COMMERCIAL AT
+  { 0xFF21, 1, { 0x0041 } },  // FULLWIDTH LATIN CAPITAL LETTER A
+  { 0xFF22, 1, { 0x0042 } },  // FULLWIDTH LATIN CAPITAL LETTER B
+  { 0xFF23, 1, { 0x0043 } },  // FULLWIDTH LATIN CAPITAL LETTER C
+  { 0xFF24, 1, { 0x0044 } },  // FULLWIDTH LATIN CAPITAL LETTER D
+  { 0xFF25, 1, { 0x0045 } },  // FULLWIDTH LATIN CAPITAL LETTER E
+  { 0xFF26, 1, { 0x0046 } },  // FULLWIDTH LATIN CAPITAL LETTER F
+  { 0xFF27, 1, { 0x0047 } },  // FULLWIDTH LATIN CAPITAL LETTER G
+  { 0xFF28, 1, { 0x0048 } },  // FULLWIDTH LATIN CAPITAL LETTER H
+  { 0xFF29, 1, { 0x0049 } },  // FULLWIDTH LATIN CAPITAL LETTER I
+  { 0xFF2A, 1, { 0x004A } },  // FULLWIDTH LATIN CAPITAL LETTER J
+  { 0xFF2B, 1, { 0x004B } },  // FULLWIDTH LATIN CAPITAL LETTER K
+  { 0xFF2C, 1, { 0x004C } },  // FULLWIDTH LATIN CAPITAL LETTER L
+  { 0xFF2D, 1, { 0x004D } },  // FULLWIDTH LATIN CAPITAL LETTER M
+  { 0xFF2E, 1, { 0x004E } },  // FULLWIDTH LATIN CAPITAL LETTER N
+  { 0xFF2F, 1, { 0x004F } },  // FULLWIDTH LATIN CAPITAL LETTER O
+  { 0xFF30, 1, { 0x0050 } },  // FULLWIDTH LATIN CAPITAL LETTER P
+  { 0xFF31, 1, { 0x0051 } },  // FULLWIDTH LATIN CAPITAL LETTER Q
+  { 0xFF32, 1, { 0x0052 } },  // FULLWIDTH LATIN CAPITAL LETTER R
+  { 0xFF33, 1, { 0x0053 } },  // FULLWIDTH LATIN CAPITAL LETTER S
+  { 0xFF34, 1, { 0x0054 } },  // FULLWIDTH LATIN CAPITAL LETTER T
+  { 0xFF35, 1, { 0x0055 } },  // FULLWIDTH LATIN CAPITAL LETTER U
+  { 0xFF36, 1, { 0x0056 } },  // FULLWIDTH LATIN CAPITAL LETTER V
+  { 0xFF37, 1, { 0x0057 } },  // FULLWIDTH LATIN CAPITAL LETTER W
+  { 0xFF38, 1, { 0x0058 } },  // FULLWIDTH LATIN CAPITAL LETTER X
+  { 0xFF39, 1, { 0x0059 } },  // FULLWIDTH LATIN CAPITAL LETTER Y
+  { 0xFF3A, 1, { 0x005A } },  // FULLWIDTH LATIN CAPITAL LETTER Z
+  { 0xFF3B, 1, { 0x005B } },  // FULLWIDTH LEFT SQUARE BRACKET
+  { 0xFF3C, 1, { 0x005C } },  // FULLWIDTH REVERSE SOLIDUS
+  { 0xFF3D, 1, { 0x005D } },  // FULLWIDTH RIGHT SQUARE BRACKET
+  { 0xFF3E, 1, { 0x005E } },  // FULLWIDTH CIRCUMFLEX ACCENT
+  { 0xFF3F, 1, { 0x005F } },  // FULLWIDTH LOW LINE
+  { 0xFF40, 1, { 0x0060 } },  // FULLWIDTH GRAVE ACCENT
+  { 0xFF41, 1, { 0x0061 } },  // FULLWIDTH LATIN SMALL LETTER A
+  { 0xFF42, 1, { 0x0062 } },  // FULLWIDTH LATIN SMALL LETTER B
+  { 0xFF43, 1, { 0x0063 } },  // FULLWIDTH LATIN SMALL LETTER C
+  { 0xFF44, 1, { 0x0064 } },  // FULLWIDTH LATIN SMALL LETTER D
+  { 0xFF45, 1, { 0x0065 } },  // FULLWIDTH LATIN SMALL LETTER E
+  { 0xFF46, 1, { 0x0066 } },  // FULLWIDTH LATIN SMALL LETTER F
+  { 0xFF47, 1, { 0x0067 } },  // FULLWIDTH LATIN SMALL LETTER G
+  { 0xFF48, 1, { 0x0068 } },  // FULLWIDTH LATIN SMALL LETTER H
+  { 0xFF49, 1, { 0x0069 } },  // FULLWIDTH LATIN SMALL LETTER I
+  { 0xFF4A, 1, { 0x006A } },  // FULLWIDTH LATIN SMALL LETTER J
+  { 0xFF4B, 1, { 0x006B } },  // FULLWIDTH LATIN SMALL LETTER K
+  { 0xFF4C, 1, { 0x006C } },  // FULLWIDTH LATIN SMALL LETTER L
+  { 0xFF4D, 1, { 0x006D } },  // FULLWIDTH LATIN SMALL LETTER M
+  { 0xFF4E, 1, { 0x006E } },  // FULLWIDTH LATIN SMALL LETTER N
+  { 0xFF4F, 1, { 0x006F } },  // FULLWIDTH LATIN SMALL LETTER O
+  { 0xFF50, 1, { 0x0070 } },  // FULLWIDTH LATIN SMALL LETTER P
+  { 0xFF51, 1, { 0x0071 } },  // FULLWIDTH LATIN SMALL LETTER Q
+  { 0xFF52, 1, { 0x0072 } },  // FULLWIDTH LATIN SMALL LETTER R
+  { 0xFF53, 1, { 0x0073 } },  // FULLWIDTH LATIN SMALL LETTER S
+  { 0xFF54, 1, { 0x0074 } },  // FULLWIDTH LATIN SMALL LETTER T
+  { 0xFF55, 1, { 0x0075 } },  // FULLWIDTH LATIN SMALL LETTER U
+  { 0xFF56, 1, { 0x0076 } },  // FULLWIDTH LATIN SMALL LETTER V
+  { 0xFF57, 1, { 0x0077 } },  // FULLWIDTH LATIN SMALL LETTER W
+  { 0xFF58, 1, { 0x0078 } },  // FULLWIDTH LATIN SMALL LETTER X
+  { 0xFF59, 1, { 0x0079 } },  // FULLWIDTH LATIN SMALL LETTER Y
+  { 0xFF5A, 1, { 0x007A } },  // FULLWIDTH LATIN SMALL LETTER Z
+  { 0xFF5B, 1, { 0x007B } },  // FULLWIDTH LEFT CURLY BRACKET
+  { 0xFF5C, 1, { 0x007C } },  // FULLWIDTH VERTICAL LINE
+  { 0xFF5D, 1, { 0x007D } },  // FULLWIDTH RIGHT CURLY BRACKET
+  { 0xFF5E, 1, { 0x007E } },  // FULLWIDTH TILDE
+  { 0xFF5F, 1, { 0x2985 } },  // FULLWIDTH LEFT WHITE PARENTHESIS
+  { 0xFF60, 1, { 0x2986 } },  // FULLWIDTH RIGHT WHITE PARENTHESIS
+  { 0xFF9E, 0, { 0 } },  // HALFWIDTH KATAKANA VOICED SOUND MARK
+  { 0xFF9F, 0, { 0 } },  // HALFWIDTH KATAKANA SEMI-VOICED SOUND MARK
+  { 0xFFE0, 1, { 0x00A2 } },  // FULLWIDTH CENT SIGN
+  { 0xFFE1, 1, { 0x00A3 } },  // FULLWIDTH POUND SIGN
+  { 0xFFE2, 1, { 0x00AC } },  // FULLWIDTH NOT SIGN
+  { 0xFFE3, 1, { 0x00AF } },  // FULLWIDTH MACRON
+  { 0xFFE4, 1, { 0x00A6 } },  // FULLWIDTH BROKEN BAR
+  { 0xFFE5, 1, { 0x00A5 } },  // FULLWIDTH YEN SIGN
+  { 0xFFE6, 1, { 0x20A9 } },  // FULLWIDTH WON SIGN
+  { 0xFFE8, 1, { 0x2502 } },  // HALFWIDTH FORMS LIGHT VERTICAL
+  { 0xFFE9, 1, { 0x2190 } },  // HALFWIDTH LEFTWARDS ARROW
+  { 0xFFEA, 1, { 0x2191 } },  // HALFWIDTH UPWARDS ARROW
+  { 0xFFEB, 1, { 0x2192 } },  // HALFWIDTH RIGHTWARDS ARROW
+  { 0xFFEC, 1, { 0x2193 } },  // HALFWIDTH DOWNWARDS ARROW
+  { 0xFFED, 1, { 0x25A0 } },  // HALFWIDTH BLACK SQUARE
+  { 0xFFEE, 1, { 0x25CB } },  // HALFWIDTH WHITE CIRCLE
+};
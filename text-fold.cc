@@ -0,0 +1,216 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "text-fold.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace {
+struct CombiningClassRange {
+  uint16_t first;
+  uint16_t last;
+  uint8_t combining_class;
+};
+
+struct CompositionPair {
+  uint32_t pair;       // starter << 16 | combining character
+  uint16_t composite;
+};
+
+struct FoldEntry {
+  uint16_t codepoint;
+  uint8_t length;
+  uint16_t fold[4];
+};
+
+#include "text-fold-data.h"
+
+// Hangul syllables compose algorithmically.
+static const uint32_t kHangulSBase = 0xAC00, kHangulLBase = 0x1100,
+  kHangulVBase = 0x1161, kHangulTBase = 0x11A7;
+static const int kHangulLCount = 19, kHangulVCount = 21, kHangulTCount = 28,
+  kHangulNCount = kHangulVCount * kHangulTCount,
+  kHangulSCount = kHangulLCount * kHangulNCount;
+
+// Recursion depth for folds of folds, e.g. ǖ -> ü -> u.
+static const int kMaxFoldDepth = 3;
+}  // namespace
+
+static int CombiningClass(uint32_t cp) {
+  if (cp < 0x300 || cp > 0xFFFF) return 0;
+  const CombiningClassRange *end = kCombiningClasses
+    + sizeof(kCombiningClasses) / sizeof(kCombiningClasses[0]);
+  const CombiningClassRange *found
+    = std::lower_bound(kCombiningClasses, end, cp,
+                       [](const CombiningClassRange &r, uint32_t c) {
+                         return r.last < c;
+                       });
+  if (found == end || found->first > cp) return 0;
+  return found->combining_class;
+}
+
+// Returns the composite of the two, or 0 if there is none.
+static uint32_t ComposePair(uint32_t starter, uint32_t combining) {
+  if (starter >= kHangulLBase && starter < kHangulLBase + kHangulLCount
+      && combining >= kHangulVBase
+      && combining < kHangulVBase + kHangulVCount) {
+    return kHangulSBase + ((starter - kHangulLBase) * kHangulVCount
+                           + (combining - kHangulVBase)) * kHangulTCount;
+  }
+  if (starter >= kHangulSBase && starter < kHangulSBase + kHangulSCount
+      && (starter - kHangulSBase) % kHangulTCount == 0
+      && combining > kHangulTBase
+      && combining < kHangulTBase + kHangulTCount) {
+    return starter + (combining - kHangulTBase);
+  }
+
+  if (starter > 0xFFFF || combining > 0xFFFF) return 0;
+  const uint32_t key = (starter << 16) | combining;
+  const CompositionPair *end = kCompositions
+    + sizeof(kCompositions) / sizeof(kCompositions[0]);
+  const CompositionPair *found
+    = std::lower_bound(kCompositions, end, key,
+                       [](const CompositionPair &p, uint32_t k) {
+                         return p.pair < k;
+                       });
+  if (found == end || found->pair != key) return 0;
+  return found->composite;
+}
+
+std::u32string ComposeCanonical(const std::u32string &text) {
+  std::u32string result;
+  result.reserve(text.size());
+  int starter_pos = -1;    // Position of last starter in result.
+  int last_class = -1;     // Combining class of last character appended.
+  for (const char32_t cp : text) {
+    const int combining_class = CombiningClass(cp);
+    if (starter_pos >= 0
+        && (last_class < combining_class || last_class == 0)) {
+      // Not blocked from the starter: see if they compose.
+      const uint32_t composite = ComposePair(result[starter_pos], cp);
+      if (composite != 0) {
+        result[starter_pos] = composite;
+        continue;
+      }
+    }
+    if (combining_class == 0) {
+      starter_pos = result.size();
+    }
+    last_class = combining_class;
+    result.push_back(cp);
+  }
+  return result;
+}
+
+bool FoldCodepoint(uint32_t codepoint, std::u32string *fold) {
+  if (codepoint < 0x80 || codepoint > 0xFFFF) return false;
+  const FoldEntry *end = kFolds + sizeof(kFolds) / sizeof(kFolds[0]);
+  const FoldEntry *found
+    = std::lower_bound(kFolds, end, codepoint,
+                       [](const FoldEntry &f, uint32_t c) {
+                         return f.codepoint < c;
+                       });
+  if (found == end || found->codepoint != codepoint) return false;
+  fold->assign(found->fold, found->fold + found->length);
+  return true;
+}
+
+// Append the closest to "cp" that the display can show with at most
+// "max_cost" to result. Returns 'false' if there is nothing, in which case
+// nothing is appended.
+static bool AppendDisplayable(uint32_t cp, const GlyphCostFunction &cost,
+                              GlyphCost max_cost, int depth,
+                              std::u32string *result) {
+  if (cost(cp) <= max_cost) {
+    result->push_back(cp);
+    return true;
+  }
+  std::u32string fold;
+  if (depth >= kMaxFoldDepth || !FoldCodepoint(cp, &fold))
+    return false;
+  const size_t rollback = result->size();
+  for (const char32_t c : fold) {
+    if (!AppendDisplayable(c, cost, max_cost, depth + 1, result)) {
+      result->resize(rollback);
+      return false;
+    }
+  }
+  return true;
+}
+
+std::u32string FoldForDisplay(const std::u32string &text,
+                              const GlyphCostFunction &cost,
+                              int custom_budget) {
+  std::u32string result;
+  result.reserve(text.size());
+  for (const char32_t cp : text) {
+    if (AppendDisplayable(cp, cost, GLYPH_CUSTOM, 0, &result))
+      continue;
+    if (CombiningClass(cp) != 0)
+      continue;   // Accent we couldn't compose or show: better without it.
+    result.push_back(cp);   // Leave it to the display to show a substitute.
+  }
+
+  if (custom_budget < 0)
+    return result;
+
+  std::map<uint32_t, int> custom_count;
+  for (const char32_t cp : result) {
+    if (cost(cp) == GLYPH_CUSTOM) custom_count[cp]++;
+  }
+  if ((int) custom_count.size() <= custom_budget)
+    return result;
+
+  // Too many different custom characters. Fold the rarest ones that have a
+  // native fold until we're within budget.
+  std::vector<std::pair<int, uint32_t>> by_frequency;
+  for (const auto &entry : custom_count) {
+    by_frequency.push_back(std::make_pair(entry.second, entry.first));
+  }
+  std::sort(by_frequency.begin(), by_frequency.end());
+  std::map<uint32_t, std::u32string> replacement;
+  int over_budget = custom_count.size() - custom_budget;
+  for (const auto &entry : by_frequency) {
+    if (over_budget <= 0) break;
+    std::u32string fold;
+    std::u32string native;
+    if (FoldCodepoint(entry.second, &fold)) {
+      bool all_native = true;
+      for (const char32_t c : fold) {
+        all_native &= AppendDisplayable(c, cost, GLYPH_NATIVE, 1, &native);
+      }
+      if (!all_native) continue;
+      replacement[entry.second] = native;
+      --over_budget;
+    }
+  }
+  if (replacement.empty())
+    return result;
+
+  std::u32string folded;
+  folded.reserve(result.size());
+  for (const char32_t cp : result) {
+    auto found = replacement.find(cp);
+    if (found != replacement.end()) {
+      folded.append(found->second);
+    } else {
+      folded.push_back(cp);
+    }
+  }
+  return folded;
+}
@@ -0,0 +1,54 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_TEXT_FOLD_
+#define UPNP_DISPLAY_TEXT_FOLD_
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+
+// Preparation of text for small displays: compose characters that arrive
+// decomposed (base letter plus combining accent) and replace characters the
+// display can't show with the closest it can. Meant to run once per change
+// of a value; the tables are generated from the Unicode database.
+
+// How expensive it is to show a character.
+enum GlyphCost {
+  GLYPH_NATIVE,       // Display can show it as-is.
+  GLYPH_CUSTOM,       // Needs one of a limited number of custom characters.
+  GLYPH_UNAVAILABLE,  // Display can't show it.
+};
+typedef std::function<GlyphCost(uint32_t codepoint)> GlyphCostFunction;
+
+// Compose canonically decomposed sequences, so that e.g. "e" followed by a
+// combining acute accent becomes a single "é" (Unicode NFC composition).
+std::u32string ComposeCanonical(const std::u32string &text);
+
+// Replace characters that are unavailable with their fold (accent stripped,
+// compatibility form, ASCII punctuation or transliteration); combining
+// marks that are left over are dropped. If more than "custom_budget"
+// different characters would need custom glyphs, the least frequent of them
+// are folded as well, as long as their fold can be shown natively. A
+// negative budget means unlimited.
+std::u32string FoldForDisplay(const std::u32string &text,
+                              const GlyphCostFunction &cost,
+                              int custom_budget);
+
+// Fold for a single codepoint. Returns 'false' if there is none.
+bool FoldCodepoint(uint32_t codepoint, std::u32string *fold);
+
+#endif  // UPNP_DISPLAY_TEXT_FOLD_
@@ -0,0 +1,210 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "trace-events.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "logging.h"
+
+namespace {
+// Fields are atomic, as they are read while the thread may overwrite them;
+// all accesses are relaxed, the ring's count orders them.
+struct Span {
+  std::atomic<const char*> name;
+  std::atomic<int64_t> start;
+  std::atomic<int64_t> end;
+};
+
+struct Ring {
+  explicit Ring(int capacity)
+    : spans(new Span[capacity]), capacity(capacity), tid(0),
+      thread_name(nullptr), written(0), owner_from(0), in_use(true),
+      next(nullptr) {}
+
+  Span *const spans;
+  const int capacity;
+  std::atomic<int> tid;
+  std::atomic<const char*> thread_name;
+  std::atomic<uint64_t> written;   // Spans complete below this count.
+  // Spans below this count are from a thread that has exited and left the
+  // ring to the current one.
+  std::atomic<uint64_t> owner_from;
+  std::atomic<bool> in_use;
+  Ring *next;
+};
+
+std::atomic<int> ring_capacity(0);
+std::atomic<Ring*> rings(nullptr);   // Never freed; readers may be around.
+thread_local Ring *thread_ring = nullptr;
+
+// libupnp starts and ends threads as it goes; a ring of an exited thread
+// keeps its spans until the next new thread takes it over.
+struct RingOwner {
+  Ring *ring = nullptr;
+  ~RingOwner() {
+    if (ring != nullptr) ring->in_use.store(false, std::memory_order_release);
+    thread_ring = nullptr;
+  }
+};
+thread_local RingOwner ring_owner;
+
+Ring *ThreadRing() {
+  if (thread_ring != nullptr) return thread_ring;
+  const int tid = (int) syscall(SYS_gettid);
+  Ring *ring = nullptr;
+  for (Ring *r = rings.load(std::memory_order_acquire); r; r = r->next) {
+    bool in_use = false;
+    if (r->in_use.compare_exchange_strong(in_use, true,
+                                          std::memory_order_acquire)) {
+      ring = r;
+      break;
+    }
+  }
+  if (ring != nullptr) {
+    // Pairs with the fence in WriteChromeJSON(): a reader that sees the
+    // new tid or name also sees that the owner changed.
+    ring->owner_from.store(ring->written.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    ring->tid.store(tid, std::memory_order_relaxed);
+    ring->thread_name.store(nullptr, std::memory_order_relaxed);
+  } else {
+    ring = new Ring(ring_capacity.load(std::memory_order_relaxed));
+    ring->tid.store(tid, std::memory_order_relaxed);
+    ring->next = rings.load(std::memory_order_relaxed);
+    while (!rings.compare_exchange_weak(ring->next, ring,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+  }
+  ring_owner.ring = ring;
+  thread_ring = ring;
+  return ring;
+}
+
+void WriteName(FILE *out, const char *name) {
+  for (const char *c = name; *c; ++c) {
+    if (*c == '"' || *c == '\\') fputc('\\', out);
+    fputc(*c, out);
+  }
+}
+}  // namespace
+
+std::atomic<bool> TraceSpan::enabled_(false);
+
+void TraceSpan::Enable(int spans_per_thread) {
+  ring_capacity.store(spans_per_thread, std::memory_order_relaxed);
+  enabled_.store(spans_per_thread > 0, std::memory_order_relaxed);
+}
+
+int64_t TraceSpan::Now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+void TraceSpan::SetThreadName(const char *name) {
+  if (!enabled_.load(std::memory_order_relaxed)) return;
+  ThreadRing()->thread_name.store(name, std::memory_order_relaxed);
+}
+
+void TraceSpan::Record(const char *name, int64_t start, int64_t end) {
+  Ring *const ring = ThreadRing();
+  const uint64_t index = ring->written.load(std::memory_order_relaxed);
+  Span &span = ring->spans[index % ring->capacity];
+  // A reader that sees any of the stores below also sees "written" at
+  // least at "index", so it knows this slot is being overwritten.
+  std::atomic_thread_fence(std::memory_order_release);
+  span.name.store(name, std::memory_order_relaxed);
+  span.start.store(start, std::memory_order_relaxed);
+  span.end.store(end, std::memory_order_relaxed);
+  ring->written.store(index + 1, std::memory_order_release);
+}
+
+bool TraceSpan::WriteChromeJSON(const char *filename) {
+  FILE *out = fopen(filename, "w");
+  if (out == NULL) {
+    LOG(kLogError, "%s: %s", filename, strerror(errno));
+    return false;
+  }
+  fprintf(out, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+  const char *separator = "\n";
+  const int pid = getpid();
+  struct Copy { const char *name; int64_t start, end; };
+  std::vector<Copy> copies;
+  for (Ring *ring = rings.load(std::memory_order_acquire); ring != NULL;
+       ring = ring->next) {
+    const uint64_t owner_from
+      = ring->owner_from.load(std::memory_order_acquire);
+    const int tid = ring->tid.load(std::memory_order_relaxed);
+    const char *thread_name
+      = ring->thread_name.load(std::memory_order_relaxed);
+
+    // Copy first, then see how far the thread got meanwhile: spans it may
+    // have overwritten, or is about to, are dropped.
+    const uint64_t written = ring->written.load(std::memory_order_acquire);
+    const uint64_t first = written > (uint64_t) ring->capacity
+      ? written - ring->capacity : 0;
+    copies.clear();
+    for (uint64_t i = first; i < written; ++i) {
+      const Span &span = ring->spans[i % ring->capacity];
+      copies.push_back({ span.name.load(std::memory_order_relaxed),
+                         span.start.load(std::memory_order_relaxed),
+                         span.end.load(std::memory_order_relaxed) });
+    }
+    // Pairs with the fences in Record() and ThreadRing(): spans overwritten
+    // while copying show up in "written_after", a new owner in owner_from.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t written_after
+      = ring->written.load(std::memory_order_acquire);
+    if (ring->owner_from.load(std::memory_order_relaxed) != owner_from)
+      continue;  // Taken over by a new thread meanwhile.
+    const uint64_t valid_from = written_after + 1 > (uint64_t) ring->capacity
+      ? written_after + 1 - ring->capacity : 0;
+
+    if (thread_name != NULL) {
+      fprintf(out, "%s{\"name\": \"thread_name\", \"ph\": \"M\", "
+              "\"pid\": %d, \"tid\": %d, \"args\": {\"name\": \"",
+              separator, pid, tid);
+      WriteName(out, thread_name);
+      fprintf(out, "\"}}");
+      separator = ",\n";
+    }
+    for (uint64_t i = std::max({first, valid_from, owner_from}); i < written;
+         ++i) {
+      const Copy &span = copies[i - first];
+      fprintf(out, "%s{\"name\": \"", separator);
+      WriteName(out, span.name);
+      fprintf(out, "\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, "
+              "\"pid\": %d, \"tid\": %d}",
+              span.start / 1e3, (span.end - span.start) / 1e3,
+              pid, tid);
+      separator = ",\n";
+    }
+  }
+  fprintf(out, "\n]}\n");
+  fclose(out);
+  return true;
+}
@@ -0,0 +1,66 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_TRACE_EVENTS_H
+#define UPNP_DISPLAY_TRACE_EVENTS_H
+
+#include <stdint.h>
+
+#include <atomic>
+
+// Records where time goes as spans with begin and duration, to be viewed
+// in chrome://tracing or Perfetto.
+//
+// Each thread writes to its own ring buffer that keeps the most recent
+// spans, without locks; when tracing is off, a span costs one load.
+//
+//   void Foo() {
+//     TraceSpan span("Foo");   // Until the end of the scope.
+//     ...
+//   }
+class TraceSpan {
+public:
+  // "name" has to stay valid forever, e.g. a string literal.
+  explicit TraceSpan(const char *name)
+    : name_(name),
+      start_(enabled_.load(std::memory_order_relaxed) ? Now() : -1) {}
+  ~TraceSpan() {
+    if (start_ >= 0) Record(name_, start_, Now());
+  }
+
+  // Starts recording; every thread keeps its last "spans_per_thread".
+  static void Enable(int spans_per_thread);
+
+  // Names the calling thread in the trace, e.g. "display".
+  static void SetThreadName(const char *name);
+
+  // Writes all recorded spans in the Chrome trace event format. Can be
+  // called while other threads keep recording.
+  static bool WriteChromeJSON(const char *filename);
+
+private:
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan &operator=(const TraceSpan&) = delete;
+
+  static int64_t Now();
+  static void Record(const char *name, int64_t start, int64_t end);
+
+  static std::atomic<bool> enabled_;
+
+  const char *const name_;
+  const int64_t start_;    // -1 if not tracing.
+};
+
+#endif  // UPNP_DISPLAY_TRACE_EVENTS_H
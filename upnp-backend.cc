@@ -0,0 +1,41 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "upnp-backend.h"
+
+namespace {
+class LibUpnp : public UpnpBackend {
+public:
+  int DownloadXmlDoc(const char *url, IXML_Document **doc) override {
+    return UpnpDownloadXmlDoc(url, doc);
+  }
+  int Subscribe(UpnpClient_Handle client, const char *event_url,
+                int *timeout, Upnp_SID sid) override {
+    return UpnpSubscribe(client, event_url, timeout, sid);
+  }
+  int SendAction(UpnpClient_Handle client, const char *action_url,
+                 const char *service_type, IXML_Document *action,
+                 IXML_Document **response) override {
+    return UpnpSendAction(client, action_url, service_type, NULL, action,
+                          response);
+  }
+};
+}  // namespace
+
+UpnpBackend *LibUpnpBackend() {
+  static LibUpnp instance;
+  return &instance;
+}
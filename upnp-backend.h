@@ -0,0 +1,43 @@
+// -*- mode: c++; c-basic-offset: 2; indent-tabs-mode: nil; -*-
+//  This file is part of UPnP LCD Display
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef UPNP_DISPLAY_UPNP_BACKEND_H
+#define UPNP_DISPLAY_UPNP_BACKEND_H
+
+#include <upnp.h>
+
+// The calls the control point makes to renderers. Together with the
+// callbacks of the library, told to Received(), this is all that comes in
+// from the network, so it can be recorded and played back (event-log.h).
+class UpnpBackend {
+public:
+  virtual ~UpnpBackend() {}
+
+  // Same as the libupnp functions of the same name.
+  virtual int DownloadXmlDoc(const char *url, IXML_Document **doc) = 0;
+  virtual int Subscribe(UpnpClient_Handle client, const char *event_url,
+                        int *timeout, Upnp_SID sid) = 0;
+  virtual int SendAction(UpnpClient_Handle client, const char *action_url,
+                         const char *service_type, IXML_Document *action,
+                         IXML_Document **response) = 0;
+
+  // Called with every callback from the library before it is handled.
+  virtual void Received(Upnp_EventType_e, const void *) {}
+};
+
+// The libupnp functions themselves.
+UpnpBackend *LibUpnpBackend();
+
+#endif  // UPNP_DISPLAY_UPNP_BACKEND_H
@@ -19,22 +19,44 @@
 #include "upnp-display.h"
 
 #include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <stdlib.h>
 #include <time.h>
 
 #include <ithread.h>
 
+#include "logging.h"
+#include "metrics.h"
 #include "printer.h"
 #include "renderer-state.h"
+#include "scheduler.h"
+#include "trace-events.h"
 
-// Time between display updates.
-// This influences scroll speed and 'pause' blinking.
+// Rates of the display animations; each runs at its own period. A frame
+// is only drawn when one of them changed something, and those that
+// coincide are drawn as one frame.
 // Note, too fast scrolling looks blurry on cheap displays.
-static const int kDisplayUpdateMillis = 400;
+static const int kScrollMillis = 250;
+static const int kBlinkMillis = 500;       // 'pause' blinking, VFD animation.
+static const int kPositionMillis = 1000;   // Asking renderer for play time.
+static const int kKeyScanMillis = 20;
+
+// A frame shown later than this after its tasks were due is an overrun; it
+// would hold up the next sub-frame of smooth scrolling.
+static const int kFrameDeadlineMillis = 50;
+
+static int64_t MonotonicNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
 
 // We do the signal receiving the classic static way, as creating callbacks to
 // c functions is more readable than with c++ methods :)
@@ -43,59 +65,249 @@ static void SigReceiver(int) {
   signal_received = true;
 }
 
+static volatile bool latency_dump_requested = false;
+static void LatencyDumpRequest(int) {
+  latency_dump_requested = true;
+}
+
 UPnPDisplay::UPnPDisplay(const std::string &friendly_name, Printer *printer,
                          int screensave_timeout)
   : player_match_name_(friendly_name),
     printer_(printer), screensave_timeout_(screensave_timeout),
-    current_state_(NULL) {
+    current_state_(NULL), scheduler_(NULL), redraw_(false),
+    scroll_step_(false), time_redraw_at_(-1),
+    loop_monitor_(kFrameDeadlineMillis), dump_running_(false) {
   ithread_mutex_init(&mutex_, NULL);
   signal(SIGTERM, &SigReceiver);
   signal(SIGINT, &SigReceiver);
+  signal(SIGUSR1, &LatencyDumpRequest);
+}
+
+// Writing files can take a while, and the display thread may be realtime;
+// it only copies the statistics.
+void UPnPDisplay::StartDump() {
+  if (dump_thread_.joinable()) dump_thread_.join();   // Done already.
+  dump_running_ = true;
+  dump_thread_ = std::thread([this, latency = latency_,
+                              loop = loop_monitor_]() {
+      struct sched_param p;
+      p.sched_priority = 0;
+      pthread_setschedparam(pthread_self(), SCHED_OTHER, &p);
+      WriteLatency(latency, loop);
+      if (!trace_file_.empty())
+        TraceSpan::WriteChromeJSON(trace_file_.c_str());
+      dump_running_ = false;
+    });
+}
+
+void UPnPDisplay::WriteLatency(const PipelineLatency &latency,
+                               const LoopMonitor &loop) const {
+  FILE *out = stderr;
+  if (!latency_file_.empty()) {
+    out = fopen(latency_file_.c_str(), "w");
+    if (out == NULL) {
+      LOG(kLogError, "%s: %s", latency_file_.c_str(), strerror(errno));
+      return;
+    }
+  }
+  fprintf(out, "{\"events\": ");
+  latency.WriteJSON(out);
+  fprintf(out, ", \"loop\": ");
+  loop.WriteJSON(out);
+  fprintf(out, "}\n");
+  if (out != stderr) fclose(out);
 }
 
 void UPnPDisplay::Loop() {
+  Scheduler scheduler;
+  if (!scheduler.Init())
+    return;
+  scheduler_ = &scheduler;
+  TraceSpan::SetThreadName("display");
 
-  time_t last_update = 0;
+  redraw_ = true;
+  scroll_step_ = false;
+  scheduler.Every(kScrollMillis, [this]() {
+      TraceSpan span("ScrollTick");
+      printer_->ScrollTick();
+      redraw_ = scroll_step_ = true;
+    });
+  scheduler.Every(kBlinkMillis, [this]() {
+      TraceSpan span("BlinkTick");
+      printer_->BlinkTick();
+      redraw_ = true;
+    });
+  scheduler.After(0, [this]() { SyncPosition(); });
+  if (printer_->has_keys()) {
+    scheduler.Every(kKeyScanMillis, [this]() {
+        // Keys act on the renderer, so keep it from being removed meanwhile.
+        ithread_mutex_lock(&mutex_);
+        if (current_state_ != NULL) {
+          TraceSpan span("PollKeys");
+          printer_->PollKeys(current_state_);
+        }
+        ithread_mutex_unlock(&mutex_);
+      });
+  }
+  scheduler.SetBatchDone([this]() {
+      loop_monitor_.WakeUp(scheduler_->batch_due_nanos(),
+                           scheduler_->batch_woke_nanos());
+      if (latency_dump_requested && !dump_running_) {
+        latency_dump_requested = false;
+        StartDump();
+      }
+      if (!redraw_) return;
+      const bool scroll_step = scroll_step_;
+      redraw_ = scroll_step_ = false;
+      if (!DrawFrame() || !scroll_step) return;
+      // Smoothly scrolling displays get their sub-frames in between.
+      const int sub_frames = printer_->SubFrames(kScrollMillis);
+      for (int step = 1; step <= sub_frames; ++step) {
+        scheduler_->After(step * kScrollMillis / (sub_frames + 1),
+                          [this, step, sub_frames]() {
+                            TraceSpan span("PrintSubFrame");
+                            const int64_t started = MonotonicNanos();
+                            printer_->PrintSubFrame(step, sub_frames);
+                            // Composed and written out in one go.
+                            loop_monitor_.Frame(
+                              scheduler_->batch_due_nanos(),
+                              scheduler_->batch_woke_nanos(),
+                              started, started, MonotonicNanos());
+                          });
+      }
+    });
 
   signal_received = false;
-  while (!signal_received) {
+  scheduler.Run(&signal_received);
+  scheduler_ = NULL;
+  if (dump_thread_.joinable()) dump_thread_.join();
 
-    usleep(kDisplayUpdateMillis * 1000);
-    const time_t now = time(NULL);
+  printer_->BeginFrame();
+  printer_->goodBye();
+  printer_->EndFrame();
+}
 
-    last_update = 0;
-    bool renderer_available = false;
+void UPnPDisplay::SyncPosition() {
+  TraceSpan span("SyncPosition");
+  bool have_renderer = false;
+  bool playing = false;
+  std::string position;
+  const int64_t sent = MonotonicNanos();
+  ithread_mutex_lock(&mutex_);
+  if (current_state_ != NULL) {
+    have_renderer = true;
+    current_state_->GetPositionInfo();
+    position = current_state_->GetVar("RelTime");
+    playing = current_state_->GetVar("TransportState") == "PLAYING";
+  }
+  ithread_mutex_unlock(&mutex_);
+  const int64_t received = MonotonicNanos();
 
-    ithread_mutex_lock(&mutex_);
+  if (have_renderer) {
+    media_clock_.Sync(ParseUPnPTime(position), playing, sent, received);
+  }
+  redraw_ = true;
+  PlanTimeRedraw();
 
-    if (current_state_ != NULL) {
-      renderer_available = true;
-      printer_->fillVars(current_state_);
+  // Ask again about a period later, right when we expect the second to
+  // change: the answer tells on which side of it we are, which halves the
+  // uncertainty of the clock.
+  const int64_t rollover = media_clock_.NextRolloverAfter(
+    received + kPositionMillis * 1000000LL / 2);
+  if (rollover > 0) {
+    scheduler_->At(rollover, [this]() { SyncPosition(); });
+  } else {
+    scheduler_->After(kPositionMillis, [this]() { SyncPosition(); });
+  }
+}
 
-      last_update = current_state_->last_event_update();
-    }
-    ithread_mutex_unlock(&mutex_);
+void UPnPDisplay::PlanTimeRedraw() {
+  if (!printer_->shows_play_time()) return;
+  const int64_t at = media_clock_.NextRolloverAfter(MonotonicNanos());
+  if (at < 0 || at == time_redraw_at_) return;
+  time_redraw_at_ = at;
+  scheduler_->At(at, [this, at]() {
+      if (at != time_redraw_at_) return;   // Planned again since.
+      redraw_ = true;
+      PlanTimeRedraw();
+    });
+}
+
+static const MetricCounter frames_drawn(
+  "upnp_display_frames_drawn_total", "Frames composed and written out.");
+static const MetricCounter frames_skipped(
+  "upnp_display_frames_skipped_total",
+  "Frames not drawn as the screen saver was on.");
+
+bool UPnPDisplay::DrawFrame() {
+  TraceSpan span("DrawFrame");
+  const time_t now = time(NULL);
+  const int64_t now_nanos = MonotonicNanos();
+  time_t last_update = 0;
+  bool renderer_available = false;
+  EventTimestamps event;
+  bool new_event = false;
 
-    if (screensave_timeout_ > 0 && last_update > 0 &&
-        (now - last_update) > screensave_timeout_) {
-      printer_->SaveScreen();
-      continue;
+  ithread_mutex_lock(&mutex_);
+
+  if (current_state_ != NULL) {
+    renderer_available = true;
+    // Before reading the variables: an event published while they are read
+    // might not be in this frame, and belongs to the next one.
+    last_update = current_state_->last_event_update();
+    new_event = current_state_->TakeEventTimestamps(&event);
+    {
+      TraceSpan fill_span("fillVars");
+      printer_->fillVars(current_state_);
     }
 
+    // Events tell about pause before the next position report does.
+    if (current_state_->GetVar("TransportState") != "PLAYING")
+      media_clock_.Freeze(now_nanos);
+  }
+  ithread_mutex_unlock(&mutex_);
+
+  // Between the position reports of the renderer, the time comes from
+  // following its clock.
+  if (renderer_available && media_clock_.valid())
+    printer_->SetPlayTime(media_clock_.SecondsAt(now_nanos));
+
+  if (screensave_timeout_ > 0 && last_update > 0 &&
+      (now - last_update) > screensave_timeout_) {
+    printer_->SaveScreen();
+    frames_skipped.Add();
+    return false;
+  }
+
+  {
+    TraceSpan compose_span("Compose");
+    printer_->BeginFrame();
     if (!renderer_available)
       printer_->noRendererPrint();
     else
       printer_->rendererPrint( current_state_ );
-
-  } // while loop
-
-  printer_->goodBye();
+  }
+  const int64_t composed = MonotonicNanos();
+  {
+    TraceSpan output_span("EndFrame");
+    printer_->EndFrame();   // Displays write out everything before returning.
+  }
+  const int64_t shown = MonotonicNanos();
+  if (new_event) latency_.Record(event, composed, shown);
+  // The first frame is drawn before the scheduler ran anything.
+  if (scheduler_->batch_due_nanos() > 0) {
+    loop_monitor_.Frame(scheduler_->batch_due_nanos(),
+                        scheduler_->batch_woke_nanos(),
+                        now_nanos, composed, shown);
+  }
+  frames_drawn.Add();
+  return true;
 }
 
 void UPnPDisplay::AddRenderer(const std::string &uuid,
                               RendererState *state) {
-  printf("%s: connected (uuid=%s)\n",            // not to LCD, different thread
-         state->friendly_name().c_str(), uuid.c_str());
+  LOG(kLogInfo, "%s: connected (uuid=%s)",  // not to LCD, different thread
+      state->friendly_name().c_str(), uuid.c_str());
   ithread_mutex_lock(&mutex_);
   if (current_state_ == NULL
       && (player_match_name_.empty()
@@ -108,7 +320,7 @@ void UPnPDisplay::AddRenderer(const std::string &uuid,
 }
 
 void UPnPDisplay::RemoveRenderer(const std::string &uuid) {
-  printf("disconnect (uuid=%s)\n", uuid.c_str()); // not to LCD, different thread
+  LOG(kLogInfo, "disconnect (uuid=%s)", uuid.c_str());  // not to LCD, different thread
   ithread_mutex_lock(&mutex_);
   if (current_state_ != NULL && uuid == uuid_) {
     current_state_ = NULL;
@@ -18,12 +18,20 @@
 #ifndef UPNP_DISPLAY_H
 #define UPNP_DISPLAY_H
 
+#include <stdint.h>
+
+#include <atomic>
 #include <string>
+#include <thread>
 
+#include "latency-stats.h"
+#include "loop-monitor.h"
+#include "media-clock.h"
 #include "observer.h"
 #include <ithread.h>
 
 class Printer;
+class Scheduler;
 
 class UPnPDisplay : public ControllerObserver {
 public:
@@ -36,6 +44,14 @@ public:
   // Main Loop. Only exits on catching SIGTERM or SIGINT (Ctrl-c)
   void Loop();
 
+  // On SIGUSR1, the latency from renderer events until they are shown and
+  // the timing of the display loop are written as JSON to this file; to
+  // stderr if not set.
+  void set_latency_file(const std::string &file) { latency_file_ = file; }
+
+  // If tracing, SIGUSR1 also writes the trace as Chrome JSON to this file.
+  void set_trace_file(const std::string &file) { trace_file_ = file; }
+
   // -- Implementation of ControllerObserver interface.
 
   // Receive notification of new renderer added.
@@ -45,6 +61,20 @@ public:
   virtual void RemoveRenderer(const std::string &uuid);
 
 private:
+  // Draw the current state. Returns 'false' if the screen saver is on.
+  bool DrawFrame();
+
+  // Ask the renderer for the play position and plan the next time to ask.
+  void SyncPosition();
+
+  // Plan a frame for when the shown play time changes next.
+  void PlanTimeRedraw();
+
+  // Writes the latency statistics and the trace on a thread of normal
+  // priority, from a copy of the statistics.
+  void StartDump();
+  void WriteLatency(const PipelineLatency &latency,
+                    const LoopMonitor &loop) const;
 
   const std::string player_match_name_;
   Printer *const printer_;
@@ -53,6 +83,19 @@ private:
 
   std::string uuid_;
   RendererState *current_state_;
+
+  // State of Loop(); only used from its thread.
+  Scheduler *scheduler_;
+  bool redraw_;                 // A task changed what is to be shown.
+  bool scroll_step_;            // ...and scrollers moved.
+  MediaClock media_clock_;
+  int64_t time_redraw_at_;      // Next planned frame for the play time.
+  PipelineLatency latency_;
+  LoopMonitor loop_monitor_;
+  std::string latency_file_;
+  std::string trace_file_;
+  std::thread dump_thread_;
+  std::atomic<bool> dump_running_;
 };
 
 #endif  // UPNP_DISPLAY_H
@@ -18,56 +18,230 @@
 #ifndef UPNP_DISPLAY_UTF8_H
 #define UPNP_DISPLAY_UTF8_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <type_traits>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  include <arm_neon.h>
+#  define UTF8_ASCII_BLOCK_NEON 1
+#elif defined(__SSE2__)
+#  include <emmintrin.h>
+#  define UTF8_ASCII_BLOCK_SSE2 1
+#endif
+
+// Emitted for every malformed or truncated sequence.
+static const uint32_t kUnicodeReplacementCharacter = 0xFFFD;
+
+// Decodes the remainder of a sequence starting with the non-ASCII byte
+// "lead"; "it" points to the byte following it. Use utf8_next_codepoint().
+template <typename byte_iterator, typename end_iterator>
+uint32_t utf8_decode_multibyte(uint32_t lead,
+                               byte_iterator &it, const end_iterator &end) {
+  if (lead < 0xC2) {
+    return kUnicodeReplacementCharacter;   // stray continuation or overlong.
+  }
+
+  if (lead < 0xE0) {
+    if (it == end) return kUnicodeReplacementCharacter;
+    const uint8_t b1 = *it;
+    if ((b1 & 0xC0) != 0x80) return kUnicodeReplacementCharacter;
+    ++it;
+    return ((lead & 0x1F) << 6) | (b1 & 0x3F);
+  }
+
+  if (lead < 0xF0) {
+    if (it == end) return kUnicodeReplacementCharacter;
+    const uint8_t b1 = *it;
+    if ((b1 & 0xC0) != 0x80
+        || (lead == 0xE0 && b1 < 0xA0)     // overlong
+        || (lead == 0xED && b1 > 0x9F)) {  // UTF-16 surrogates
+      return kUnicodeReplacementCharacter;
+    }
+    if (++it == end) return kUnicodeReplacementCharacter;
+    const uint8_t b2 = *it;
+    if ((b2 & 0xC0) != 0x80) return kUnicodeReplacementCharacter;
+    ++it;
+    return ((lead & 0x0F) << 12) | ((b1 & 0x3F) << 6) | (b2 & 0x3F);
+  }
+
+  if (lead < 0xF5) {
+    if (it == end) return kUnicodeReplacementCharacter;
+    const uint8_t b1 = *it;
+    if ((b1 & 0xC0) != 0x80
+        || (lead == 0xF0 && b1 < 0x90)     // overlong
+        || (lead == 0xF4 && b1 > 0x8F)) {  // beyond U+10FFFF
+      return kUnicodeReplacementCharacter;
+    }
+    if (++it == end) return kUnicodeReplacementCharacter;
+    const uint8_t b2 = *it;
+    if ((b2 & 0xC0) != 0x80) return kUnicodeReplacementCharacter;
+    if (++it == end) return kUnicodeReplacementCharacter;
+    const uint8_t b3 = *it;
+    if ((b3 & 0xC0) != 0x80) return kUnicodeReplacementCharacter;
+    ++it;
+    return (((lead & 0x07) << 18) | ((b1 & 0x3F) << 12)
+            | ((b2 & 0x3F) << 6) | (b3 & 0x3F));
+  }
+
+  return kUnicodeReplacementCharacter;   // 0xF5..0xFF never appear in UTF-8.
+}
 
 // Utility function that reads UTF-8 encoded codepoints from byte iterator.
-// No error checking, we assume string is UTF-8 clean.
-template <typename byte_iterator>
-uint32_t utf8_next_codepoint(byte_iterator &it) {
-  uint32_t cp = *it++;
-  if (cp < 0x80) {
-    return cp;   // iterator already incremented.
+// Never reads at or beyond "end". Malformed input (stray continuation bytes,
+// overlong forms, surrogates, values beyond U+10FFFF or sequences truncated
+// by the end of the string) is returned as U+FFFD; the iterator then skips
+// the maximal invalid subpart, so decoding always makes progress.
+template <typename byte_iterator, typename end_iterator>
+inline uint32_t utf8_next_codepoint(byte_iterator &it,
+                                    const end_iterator &end) {
+  const uint32_t lead = (uint8_t) *it++;
+  if (lead < 0x80) {
+    return lead;   // iterator already incremented.
   }
-  else if ((cp & 0xE0) == 0xC0) {
-    cp = ((cp & 0x1F) << 6) + (*it & 0x3F);
+  return utf8_decode_multibyte(lead, it, end);
+}
+
+// Returns the number of leading bytes in [begin, end) that are 7-bit ASCII.
+// Looks at 16 bytes at a time with NEON or SSE2, 8 bytes otherwise.
+inline size_t utf8_ascii_prefix(const char *begin, const char *end) {
+  static const uint64_t kHighBits = 0x8080808080808080ULL;
+  const char *p = begin;
+#if defined(UTF8_ASCII_BLOCK_NEON)
+  while (end - p >= 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+    const uint8x8_t folded = vorr_u8(vget_low_u8(v), vget_high_u8(v));
+    if (vget_lane_u64(vreinterpret_u64_u8(folded), 0) & kHighBits)
+      break;
+    p += 16;
   }
-  else if ((cp & 0xF0) == 0xE0) {
-    cp = ((cp & 0x0F) << 12) + ((*it & 0x3F) << 6);
-    cp += (*++it & 0x3F);
+#elif defined(UTF8_ASCII_BLOCK_SSE2)
+  while (end - p >= 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    if (_mm_movemask_epi8(v) != 0)
+      break;
+    p += 16;
   }
-  else if ((cp & 0xF8) == 0xF0) {
-    cp = ((cp & 0x07) << 18) + ((*it & 0x3F) << 12);
-    cp += (*++it & 0x3F) << 6;
-    cp += (*++it & 0x3F);
+#endif
+  while (end - p >= 8) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));  // unaligned load; compiles to one move.
+    word &= kHighBits;
+    if (word) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      return (p - begin) + (__builtin_ctzll(word) >> 3);
+#else
+      break;
+#endif
+    }
+    p += 8;
   }
-  else if ((cp & 0xFC) == 0xF8) {
-    cp = ((cp & 0x03) << 24) + ((*it & 0x3F) << 18);
-    cp += (*++it & 0x3F) << 12;
-    cp += (*++it & 0x3F) << 6;
-    cp += (*++it & 0x3F);
+  while (p < end && (uint8_t)*p < 0x80) {
+    ++p;
   }
-  else if ((cp & 0xFE) == 0xFC) {
-    cp = ((cp & 0x01) << 30) + ((*it & 0x3F) << 24);
-    cp += (*++it & 0x3F) << 18;
-    cp += (*++it & 0x3F) << 12;
-    cp += (*++it & 0x3F) << 6;
-    cp += (*++it & 0x3F);
+  return p - begin;
+}
+
+// An ASCII run is looked at in blocks only if at least this many bytes are
+// left and the byte following an ASCII character is ASCII as well; single
+// spaces and punctuation between multibyte characters, as in Cyrillic or
+// CJK titles, are cheaper to take one by one.
+static const ptrdiff_t kUtf8AsciiBlockMinBytes = 8;
+
+inline bool utf8_ascii_block_ahead(const char *it, const char *end) {
+  return end - it >= kUtf8AsciiBlockMinBytes && (uint8_t)*it < 0x80;
+}
+
+// Number of characters in a contiguous buffer. Long ASCII runs, which is what
+// most metadata consists of, are counted in blocks instead of one by one.
+inline int utf8_character_count(const char *begin, const char *end) {
+  int result = 0;
+  const char *it = begin;
+  while (it != end) {
+    const uint32_t lead = (uint8_t) *it++;
+    ++result;
+    if (lead >= 0x80) {
+      utf8_decode_multibyte(lead, it, end);
+    } else if (utf8_ascii_block_ahead(it, end)) {
+      const size_t ascii = utf8_ascii_prefix(it, end);
+      result += ascii;
+      it += ascii;
+    }
   }
-  ++it;
-  return cp;
+  return result;
 }
 
 template <typename byte_iterator>
 int utf8_character_count(const byte_iterator &begin,
                          const byte_iterator &end) {
+  // String iterators point into contiguous memory; count there in blocks.
+  if constexpr (std::is_same<byte_iterator,
+                             std::string::const_iterator>::value
+                || std::is_same<byte_iterator, std::string::iterator>::value) {
+    if (begin == end) return 0;
+    const char *const data = &*begin;
+    return utf8_character_count(data, data + (end - begin));
+  }
   int result = 0;
-  for (byte_iterator it = begin; it != end; utf8_next_codepoint(it)) {
+  for (byte_iterator it = begin; it != end; utf8_next_codepoint(it, end)) {
     ++result;
   }
   return result;
 }
 
 inline int utf8_len(const std::string& str) {
-    return utf8_character_count(str.begin(), str.end());
+  return utf8_character_count(str.data(), str.data() + str.size());
+}
+
+// Decode the whole string to codepoints. Long ASCII runs are widened in bulk.
+inline std::u32string utf8_decode(const std::string &str) {
+  std::u32string result;
+  result.reserve(str.size());
+  const char *it = str.data();
+  const char *const end = it + str.size();
+  while (it != end) {
+    const uint32_t lead = (uint8_t) *it++;
+    if (lead >= 0x80) {
+      result.push_back(utf8_decode_multibyte(lead, it, end));
+      continue;
+    }
+    result.push_back(lead);
+    if (utf8_ascii_block_ahead(it, end)) {
+      const size_t ascii = utf8_ascii_prefix(it, end);
+      result.append(it, it + ascii);
+      it += ascii;
+    }
+  }
+  return result;
+}
+
+inline void utf8_append_codepoint(uint32_t cp, std::string *out) {
+  if (cp < 0x80) {
+    out->push_back(cp);
+  } else if (cp < 0x800) {
+    out->push_back(0xC0 | (cp >> 6));
+    out->push_back(0x80 | (cp & 0x3F));
+  } else if (cp < 0x10000) {
+    out->push_back(0xE0 | (cp >> 12));
+    out->push_back(0x80 | ((cp >> 6) & 0x3F));
+    out->push_back(0x80 | (cp & 0x3F));
+  } else {
+    out->push_back(0xF0 | (cp >> 18));
+    out->push_back(0x80 | ((cp >> 12) & 0x3F));
+    out->push_back(0x80 | ((cp >> 6) & 0x3F));
+    out->push_back(0x80 | (cp & 0x3F));
+  }
+}
+
+inline std::string utf8_encode(const std::u32string &text) {
+  std::string result;
+  result.reserve(text.size());
+  for (const char32_t cp : text) {
+    utf8_append_codepoint(cp, &result);
+  }
+  return result;
 }
 #endif  // UPNP_DISPLAY_UTF8_H
@@ -4,13 +4,15 @@
 #include <iostream>
 #include <ctime>
 #include <chrono>
+#include <algorithm>
 
 #include "vfd-display.h"
 #include "pt6312_commands.h"
+#include "trace-events.h"
 
 VFDDisplay::VFDDisplay(const std::string& match_name, const std::string& def_file_path) : Printer(match_name),
           display(DisplayDef(def_file_path)),
-	  vfd(&display), data_scroller("  "),
+	  vfd(&display), data_scroller(U"  "),
 	  groupForTime(0), groupForData(0xFF) {}
 
 static inline bool findGroupForData( uint8_t& groupForData,
@@ -64,14 +66,21 @@ bool VFDDisplay::Init() {
    return initialized_;
 }
 
+void VFDDisplay::updateDisplay() {
+   TraceSpan span("VFD updateDisplay");
+   vfd.updateDisplay();
+}
+
 void VFDDisplay::Print(int where, const std::string& what) {
    assert(initialized_);  // call Init() first.
+   TraceSpan span("VFD Print");
 
    display.resetGroup( groupForData );
    display.setDigits( groupForData, what, 0 );
 }
 
 static std::vector<KeyId> keysBuffer;  // Buffer containing current pressed keys
+static std::vector<KeyId> keysBefore;  // Keys pressed at the previous scan
 
 void VFDDisplay::noRendererPrint() {
 
@@ -101,7 +110,7 @@ void VFDDisplay::printClock() {
    display.setDigits( groupForTime, timebuffer, posTimeIni );
    //display.setDots( groupForTime, posTimeIni + 1 );
 
-   vfd.updateDisplay();
+   updateDisplay();
 }
 
 void VFDDisplay::printPlayingTime() {
@@ -153,7 +162,7 @@ void VFDDisplay::clearPlayingTime() {
    }
 }
 
-void VFDDisplay::rendererPrint( RendererState* current_state_ ) {
+void VFDDisplay::rendererPrint( RendererState* ) {
 
    assert(initialized_);  // call Init() first.
 
@@ -210,10 +219,39 @@ void VFDDisplay::rendererPrint( RendererState* current_state_ ) {
       printClock();
    }
 
+   // Print info if playing
+   if (playing) {
+
+      static const std::u32string pausetxt(U"PAUSE");
+      static const std::u32string playtxt(U"PLAY");
+      const std::u32string& ref = pause ? pausetxt : playtxt;
+      data_scroller.SetValue( ref, display.getNumberOfDigitsOnGroup( groupForData ) );
+      Print( 0, data_scroller.GetScrolledContent() );
+   }
+
+   updateDisplay();
+}
+
+void VFDDisplay::ScrollTick() {
+   data_scroller.NextTick();
+}
+
+void VFDDisplay::BlinkTick() {
+   blink_flag = !blink_flag;
+}
+
+void VFDDisplay::PollKeys( RendererState* current_state_ ) {
+
+   assert(initialized_);  // call Init() first.
+
    uint32_t raw_keys = vfd.readKeys();
    display.getKeys( keysBuffer, raw_keys );
 
+   // Keys are scanned much faster than they are released; only act when
+   // they go down.
    for (KeyId k:keysBuffer) {
+         if (std::find(keysBefore.begin(), keysBefore.end(), k) != keysBefore.end())
+            continue;
          //std::string ks;
 	 if (k == KeyId::KEY_PLAY)
             current_state_->Play(); //TEST
@@ -227,26 +265,11 @@ void VFDDisplay::rendererPrint( RendererState* current_state_ ) {
 	 else if (k == KeyId::KEY_NEXT) ks = "NEXT";
 	 else if (k == KeyId::KEY_EJECT) ks = "EJECT"; */
    }
-
-   // Print info if playing
-   if (playing) {
-
-      static std::string pausetxt("PAUSE");
-      static std::string playtxt("PLAY");
-      std::string& ref = pause ? pausetxt : playtxt;
-      data_scroller.SetValue( ref, display.getNumberOfDigitsOnGroup( groupForData ) );
-      Print( 0, data_scroller.GetScrolledContent() );
- 
-      data_scroller.NextTick();
-   }
-
-   vfd.updateDisplay();
-
-   blink_flag = !blink_flag;
+   keysBefore = keysBuffer;
 }
 
 void VFDDisplay::goodBye() {
    display.clearData();
-   vfd.updateDisplay();
+   updateDisplay();
 }
 
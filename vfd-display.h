@@ -12,9 +12,15 @@ public:
 
    bool Init();
 
+   using Printer::Print;
    virtual void Print(int where, const std::string& what);
    virtual void noRendererPrint();
    virtual void rendererPrint( RendererState* current_state_ );
+   virtual void ScrollTick();
+   virtual void BlinkTick();
+   virtual bool has_keys() const { return true; }
+   virtual bool shows_play_time() const { return true; }
+   virtual void PollKeys( RendererState* current_state_ );
    virtual void goodBye();
 
 private:
@@ -36,6 +42,7 @@ private:
    void printClock();
    void printTime( const uint8_t groupToPrint, int time, bool isHms );
    void clearPlayingTime();
+   void updateDisplay();   // Sends the display buffer to the VFD.
 
    bool blink_flag;  // Changes on every tick
 